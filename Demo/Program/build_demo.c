@@ -0,0 +1,143 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Program/build_demo: throughput of each sorting method
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Constructs a list of random tuples, and then times GrB_Matrix_build, and
+// GrB_Matrix_setElement followed by GrB_wait, with 1, 2, 4, ... nthreads_max
+// threads, for each GxB_BUILD_SORT method.  The throughput is reported in
+// millions of tuples per second.  Usage:
+//
+//  build_demo scale edgefactor
+//
+// The matrix has n = 2^scale rows and columns and edgefactor*n tuples.  The
+// defaults are scale = 20 and edgefactor = 16.
+
+// macro used by OK(...) to free workspace if an error occurs
+#define FREE_ALL                            \
+    GrB_Matrix_free (&A) ;                  \
+    GrB_Matrix_free (&C [0]) ;              \
+    GrB_Matrix_free (&C [1]) ;              \
+    if (I != NULL) free (I) ;               \
+    if (J != NULL) free (J) ;               \
+    if (X != NULL) free (X) ;               \
+    GrB_finalize ( ) ;
+
+#include "graphblas_demos.h"
+#if defined ( _OPENMP )
+#include <omp.h>
+#endif
+
+int main (int argc, char **argv)
+{
+    GrB_Matrix A = NULL, C [2] = { NULL, NULL } ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *X = NULL ;
+    GrB_Info info ;
+
+    OK (GrB_init (GrB_NONBLOCKING)) ;
+    int nthreads_max ;
+    OK (GxB_Global_Option_get (GxB_GLOBAL_NTHREADS, &nthreads_max)) ;
+    fprintf (stderr, "build_demo: nthreads_max %d\n", nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // get the problem size
+    //--------------------------------------------------------------------------
+
+    int scale = (argc > 1) ? atoi (argv [1]) : 20 ;
+    int edgefactor = (argc > 2) ? atoi (argv [2]) : 16 ;
+    GrB_Index n = ((GrB_Index) 1) << scale ;
+    GrB_Index nedges = edgefactor * n ;
+    printf ("random tuples: n %" PRIu64 ", tuples %" PRIu64 "\n", n, nedges) ;
+
+    //--------------------------------------------------------------------------
+    // construct the tuples
+    //--------------------------------------------------------------------------
+
+    I = (GrB_Index *) malloc (nedges * sizeof (GrB_Index)) ;
+    J = (GrB_Index *) malloc (nedges * sizeof (GrB_Index)) ;
+    X = (double    *) malloc (nedges * sizeof (double)) ;
+    CHECK (I != NULL && J != NULL && X != NULL, GrB_OUT_OF_MEMORY) ;
+
+    simple_rand_seed (1) ;
+    for (GrB_Index e = 0 ; e < nedges ; e++)
+    {
+        I [e] = simple_rand_i ( ) % n ;
+        J [e] = simple_rand_i ( ) % n ;
+        X [e] = simple_rand_x ( ) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // time each method with 1, 2, 4, ... nthreads_max threads
+    //--------------------------------------------------------------------------
+
+    char *method_name [2] = { "mergesort", "radix sort" } ;
+    int methods [2] = { GxB_BUILD_SORT_MERGE, GxB_BUILD_SORT_RADIX } ;
+    double t_merge [2][64] ;
+
+    for (int kmethod = 0 ; kmethod < 2 ; kmethod++)
+    {
+        printf ("\nGxB_BUILD_SORT: %s\n", method_name [kmethod]) ;
+        OK (GxB_Global_Option_set (GxB_BUILD_SORT, methods [kmethod])) ;
+        int k = 0 ;
+        for (int nthreads = 1 ; k < 64 ; nthreads *= 2, k++)
+        {
+            if (nthreads > nthreads_max) nthreads = nthreads_max ;
+            OK (GxB_Global_Option_set (GxB_GLOBAL_NTHREADS, nthreads)) ;
+            for (int op = 0 ; op < 2 ; op++)
+            {
+                #if defined ( _OPENMP )
+                double t = omp_get_wtime ( ) ;
+                #endif
+                OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+                if (op == 0)
+                {
+                    // A = sparse (I,J,X)
+                    OK (GrB_Matrix_build_FP64 (A, I, J, X, nedges,
+                        GrB_PLUS_FP64)) ;
+                }
+                else
+                {
+                    // A(i,j) = x for each tuple, then assemble them
+                    for (GrB_Index e = 0 ; e < nedges ; e++)
+                    {
+                        OK (GrB_Matrix_setElement_FP64 (A, X [e], I [e],
+                            J [e])) ;
+                    }
+                    OK (GrB_Matrix_wait (&A)) ;
+                }
+                #if defined ( _OPENMP )
+                t = omp_get_wtime ( ) - t ;
+                if (kmethod == 0) t_merge [op][k] = t ;
+                printf ("%-8s nthreads %3d time: %12.6f tuples/sec: %8.2f "
+                    "million, speedup vs mergesort %8.2f\n",
+                    (op == 0) ? "build" : "setElem", nthreads, t,
+                    1e-6 * nedges / t, t_merge [op][k] / t) ;
+                #endif
+
+                // check the result against the first one computed
+                if (C [op] == NULL)
+                {
+                    C [op] = A ;
+                    A = NULL ;
+                }
+                else
+                {
+                    bool same = false ;
+                    OK (isequal (&same, A, C [op], NULL)) ;
+                    CHECK (same, GrB_PANIC) ;
+                    OK (GrB_Matrix_free (&A)) ;
+                }
+            }
+            if (nthreads == nthreads_max) break ;
+        }
+    }
+
+    OK (GxB_Global_Option_set (GxB_BUILD_SORT, GxB_BUILD_SORT_AUTO)) ;
+    FREE_ALL ;
+}
+
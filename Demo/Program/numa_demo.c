@@ -0,0 +1,148 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Program/numa_demo: parallel scaling for each NUMA policy
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Constructs a large random sparse matrix A, and then times C=A*A, C=A+A',
+// and s=sum(A) with 1, 2, 4, ... nthreads_max threads, for each of the
+// GxB_NUMA_POLICY settings.  The policy is applied when memory is allocated,
+// so A is rebuilt for each policy.  On a multi-socket system, the scaling
+// past the first socket depends on where the pages of A reside, relative to
+// the threads that use them.  The threads should be bound to the cores, with
+// (for example):
+//
+//  OMP_PROC_BIND=spread OMP_PLACES=cores numa_demo scale edgefactor
+//
+// The matrix has n = 2^scale rows and columns and about edgefactor*n
+// entries.  The defaults are scale = 20 and edgefactor = 16.
+
+// macro used by OK(...) to free workspace if an error occurs
+#define FREE_ALL                            \
+    GrB_Matrix_free (&A) ;                  \
+    GrB_Matrix_free (&C) ;                  \
+    if (I != NULL) free (I) ;               \
+    if (J != NULL) free (J) ;               \
+    if (X != NULL) free (X) ;               \
+    GrB_finalize ( ) ;
+
+#include "graphblas_demos.h"
+#if defined ( _OPENMP )
+#include <omp.h>
+#endif
+
+int main (int argc, char **argv)
+{
+    GrB_Matrix A = NULL, C = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *X = NULL ;
+    GrB_Info info ;
+
+    OK (GrB_init (GrB_NONBLOCKING)) ;
+    int nthreads_max ;
+    OK (GxB_Global_Option_get (GxB_GLOBAL_NTHREADS, &nthreads_max)) ;
+    fprintf (stderr, "numa_demo: nthreads_max %d\n", nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // get the problem size
+    //--------------------------------------------------------------------------
+
+    int scale = (argc > 1) ? atoi (argv [1]) : 20 ;
+    int edgefactor = (argc > 2) ? atoi (argv [2]) : 16 ;
+    GrB_Index n = ((GrB_Index) 1) << scale ;
+    GrB_Index nedges = edgefactor * n ;
+    printf ("random matrix: n %" PRIu64 ", entries %" PRIu64 "\n",
+        n, nedges) ;
+
+    //--------------------------------------------------------------------------
+    // construct the tuples
+    //--------------------------------------------------------------------------
+
+    I = (GrB_Index *) malloc (nedges * sizeof (GrB_Index)) ;
+    J = (GrB_Index *) malloc (nedges * sizeof (GrB_Index)) ;
+    X = (double    *) malloc (nedges * sizeof (double)) ;
+    CHECK (I != NULL && J != NULL && X != NULL, GrB_OUT_OF_MEMORY) ;
+
+    simple_rand_seed (1) ;
+    for (GrB_Index e = 0 ; e < nedges ; e++)
+    {
+        I [e] = simple_rand_i ( ) % n ;
+        J [e] = simple_rand_i ( ) % n ;
+        X [e] = simple_rand_x ( ) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // time each operation for each NUMA policy
+    //--------------------------------------------------------------------------
+
+    char *policy_name [3] = { "default", "interleave", "by task" } ;
+    int policies [3] = { GxB_NUMA_DEFAULT, GxB_NUMA_INTERLEAVE,
+        GxB_NUMA_BY_TASK } ;
+
+    for (int kpolicy = 0 ; kpolicy < 3 ; kpolicy++)
+    {
+
+        //----------------------------------------------------------------------
+        // build A with all threads, for this policy
+        //----------------------------------------------------------------------
+
+        printf ("\nNUMA policy: %s\n", policy_name [kpolicy]) ;
+        OK (GxB_Global_Option_set (GxB_NUMA_POLICY, policies [kpolicy])) ;
+        OK (GxB_Global_Option_set (GxB_GLOBAL_NTHREADS, nthreads_max)) ;
+        OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+        OK (GrB_Matrix_build_FP64 (A, I, J, X, nedges, GrB_PLUS_FP64)) ;
+
+        //----------------------------------------------------------------------
+        // time each operation with 1, 2, 4, ... nthreads_max threads
+        //----------------------------------------------------------------------
+
+        double t1 [3] = { 0, 0, 0 } ;
+        for (int nthreads = 1 ; ; nthreads *= 2)
+        {
+            if (nthreads > nthreads_max) nthreads = nthreads_max ;
+            OK (GxB_Global_Option_set (GxB_GLOBAL_NTHREADS, nthreads)) ;
+            for (int op = 0 ; op < 3 ; op++)
+            {
+                #if defined ( _OPENMP )
+                double t = omp_get_wtime ( ) ;
+                #endif
+                double sum = 0 ;
+                switch (op)
+                {
+                    case 0 :    // C = A*A, with saxpy3
+                        OK (GrB_Matrix_new (&C, GrB_FP64, n, n)) ;
+                        OK (GrB_mxm (C, NULL, NULL,
+                            GrB_PLUS_TIMES_SEMIRING_FP64, A, A, NULL)) ;
+                        OK (GrB_Matrix_free (&C)) ;
+                        break ;
+                    case 1 :    // C = A+A'
+                        OK (GrB_Matrix_new (&C, GrB_FP64, n, n)) ;
+                        OK (GrB_Matrix_eWiseAdd_BinaryOp (C, NULL, NULL,
+                            GrB_PLUS_FP64, A, A, GrB_DESC_T1)) ;
+                        OK (GrB_Matrix_free (&C)) ;
+                        break ;
+                    default :   // sum = sum (A)
+                        OK (GrB_Matrix_reduce_FP64 (&sum, NULL,
+                            GrB_PLUS_MONOID_FP64, A, NULL)) ;
+                        break ;
+                }
+                #if defined ( _OPENMP )
+                t = omp_get_wtime ( ) - t ;
+                if (nthreads == 1) t1 [op] = t ;
+                printf ("%-6s nthreads %3d time: %12.6f speedup %8.2f\n",
+                    (op == 0) ? "A*A" : ((op == 1) ? "A+A'" : "sum"),
+                    nthreads, t, t1 [op] / t) ;
+                #endif
+            }
+            if (nthreads == nthreads_max) break ;
+        }
+
+        OK (GrB_Matrix_free (&A)) ;
+    }
+
+    OK (GxB_Global_Option_set (GxB_NUMA_POLICY, GxB_NUMA_DEFAULT)) ;
+    FREE_ALL ;
+}
@@ -0,0 +1,130 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Program/powerlaw_demo: C=A*A for an R-MAT power-law graph
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Constructs a synthetic power-law graph with the R-MAT generator, and then
+// computes C=A*A with 1 to nthreads_max threads, to measure the parallel
+// efficiency of GrB_mxm.  The R-MAT graph has a few hub vertices of very
+// high degree, so a single vector of C=A*A can dominate the work.  This is
+// handled by the ultra-fine tasks in saxpy3, which split the work for a
+// single A(:,k)*B(k,j) across many threads.
+//
+//  powerlaw_demo scale edgefactor
+//
+// The graph has n = 2^scale nodes and about edgefactor*n edges.  The
+// defaults are scale = 16 and edgefactor = 16.
+
+// macro used by OK(...) to free workspace if an error occurs
+#define FREE_ALL                            \
+    GrB_Matrix_free (&A) ;                  \
+    GrB_Matrix_free (&C) ;                  \
+    if (I != NULL) free (I) ;               \
+    if (J != NULL) free (J) ;               \
+    if (X != NULL) free (X) ;               \
+    GrB_finalize ( ) ;
+
+#include "graphblas_demos.h"
+#if defined ( _OPENMP )
+#include <omp.h>
+#endif
+
+// R-MAT probabilities of the four quadrants (d = 1-a-b-c)
+#define RMAT_A 0.57
+#define RMAT_B 0.19
+#define RMAT_C 0.19
+
+int main (int argc, char **argv)
+{
+    GrB_Matrix A = NULL, C = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *X = NULL ;
+    GrB_Info info ;
+
+    OK (GrB_init (GrB_NONBLOCKING)) ;
+    int nthreads_max ;
+    OK (GxB_Global_Option_get (GxB_GLOBAL_NTHREADS, &nthreads_max)) ;
+    fprintf (stderr, "powerlaw_demo: nthreads_max %d\n", nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // get the problem size
+    //--------------------------------------------------------------------------
+
+    int scale = (argc > 1) ? atoi (argv [1]) : 16 ;
+    int edgefactor = (argc > 2) ? atoi (argv [2]) : 16 ;
+    GrB_Index n = ((GrB_Index) 1) << scale ;
+    GrB_Index nedges = edgefactor * n ;
+    printf ("R-MAT graph: scale %d, n %" PRIu64 ", edges %" PRIu64 "\n",
+        scale, n, nedges) ;
+
+    //--------------------------------------------------------------------------
+    // construct the R-MAT graph
+    //--------------------------------------------------------------------------
+
+    I = (GrB_Index *) malloc (nedges * sizeof (GrB_Index)) ;
+    J = (GrB_Index *) malloc (nedges * sizeof (GrB_Index)) ;
+    X = (double    *) malloc (nedges * sizeof (double)) ;
+    CHECK (I != NULL && J != NULL && X != NULL, GrB_OUT_OF_MEMORY) ;
+
+    simple_rand_seed (1) ;
+    for (GrB_Index e = 0 ; e < nedges ; e++)
+    {
+        // descend the quadrants of the adjacency matrix, one bit at a time
+        GrB_Index i = 0, j = 0 ;
+        for (int bit = 0 ; bit < scale ; bit++)
+        {
+            double r = simple_rand_x ( ) ;
+            i = (i << 1) | (r >= RMAT_A + RMAT_B) ;
+            j = (j << 1) | ((r >= RMAT_A && r < RMAT_A + RMAT_B) ||
+                            (r >= RMAT_A + RMAT_B + RMAT_C)) ;
+        }
+        I [e] = i ;
+        J [e] = j ;
+        X [e] = 1 ;
+    }
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_build_FP64 (A, I, J, X, nedges, GrB_PLUS_FP64)) ;
+    free (I) ; I = NULL ;
+    free (J) ; J = NULL ;
+    free (X) ; X = NULL ;
+
+    GrB_Index nvals ;
+    OK (GrB_Matrix_nvals (&nvals, A)) ;
+    printf ("nnz (A): %" PRIu64 "\n", nvals) ;
+
+    //--------------------------------------------------------------------------
+    // C = A*A with 1 to nthreads_max threads
+    //--------------------------------------------------------------------------
+
+    printf ("\nC=A*A with the PLUS_TIMES semiring:\n") ;
+    double t1 = 0 ;
+    for (int nthreads = 1 ; nthreads <= nthreads_max ; nthreads++)
+    {
+        OK (GxB_Global_Option_set (GxB_GLOBAL_NTHREADS, nthreads)) ;
+        OK (GrB_Matrix_new (&C, GrB_FP64, n, n)) ;
+        #if defined ( _OPENMP )
+        double t = omp_get_wtime ( ) ;
+        #endif
+        OK (GrB_mxm (C, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A,
+            NULL)) ;
+        #if defined ( _OPENMP )
+        t = omp_get_wtime ( ) - t ;
+        if (nthreads == 1) t1 = t ;
+        printf ("nthreads %3d time: %12.6f speedup %8.2f efficiency %6.2f\n",
+            nthreads, t, t1/t, t1/(t*nthreads)) ;
+        #endif
+        if (nthreads == nthreads_max)
+        {
+            OK (GrB_Matrix_nvals (&nvals, C)) ;
+            printf ("nnz (C): %" PRIu64 "\n", nvals) ;
+        }
+        OK (GrB_Matrix_free (&C)) ;
+    }
+
+    FREE_ALL ;
+}
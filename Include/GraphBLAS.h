@@ -2666,6 +2666,13 @@ GrB_Info GxB_Matrix_type    // get the type of a matrix
     const GrB_Matrix A      // matrix to query
 ) ;
 
+GB_PUBLIC
+GrB_Info GxB_Matrix_memoryUsage     // return # of bytes used for a matrix
+(
+    size_t *size,           // # of bytes used by the matrix A
+    const GrB_Matrix A      // matrix to query
+) ;
+
 GB_PUBLIC
 GrB_Info GrB_Matrix_free    // free a matrix
 (
@@ -3390,7 +3397,7 @@ GrB_Info GrB_Matrix_extractTuples           // [I,J,X] = find (A)
 //
 // GxB_AxB_METHOD: this is a hint to SuiteSparse:GraphBLAS on which algorithm
 //      it should use to compute C=A*B, in GrB_mxm, GrB_mxv, and GrB_vxm.
-//      SuiteSparse:GraphBLAS has four different heuristics, and the default
+//      SuiteSparse:GraphBLAS has five different heuristics, and the default
 //      method (GxB_DEFAULT) selects between them automatically.  The complete
 //      rule is in the User Guide.  The brief discussion here assumes all
 //      matrices are stored by column.  All methods compute the same result,
@@ -3417,6 +3424,10 @@ GrB_Info GrB_Matrix_extractTuples           // [I,J,X] = find (A)
 //          present, very sparse, and not complemented, or when C is a dense
 //          vector or matrix, or when C is small.
 //
+//      GxB_AxB_OUTER: computes C=A*B' as a sum of outer products, C = sum_k
+//          A(:,k)*B(:,k)', without forming B'.  Useful only for C=A*B' when
+//          the work is small compared with the size of B.  Ignored otherwise.
+//
 // GxB_SORT: GrB_mxm and other methods may return a matrix in a 'jumbled'
 //      state, with indices out of order.  The sort is left pending.  Some
 //      methods can tolerate jumbled matrices on input, so this can be faster.
@@ -3426,6 +3437,18 @@ GrB_Info GrB_Matrix_extractTuples           // [I,J,X] = find (A)
 //      the resulting matrix C (but not always; this is just a hint).  If
 //      GrB_init is called with GrB_BLOCKING mode, the sort will always be
 //      done, and this setting has no effect.
+//
+// GxB_IMPORT: controls how the GxB_*_import functions use the arrays given to
+//      them by the user application.  With GxB_DEFAULT, the arrays are moved
+//      into the new matrix and become owned by GraphBLAS.  With
+//      GxB_SHALLOW_IMPORT, the arrays remain owned by the user application,
+//      and the new matrix is a read-only view of them (see GxB_*_import).
+//
+// GxB_COMPRESSION: selects how GxB_Matrix_serialize compresses the integer
+//      arrays that hold the pattern of the matrix.  With GxB_DEFAULT or
+//      GxB_COMPRESSION_VARINT, they are compressed in parallel with a
+//      delta/variable-length integer encoding.  With GxB_COMPRESSION_NONE,
+//      they are copied into the blob as-is, which is faster but larger.
 
 // The following are enumerated values in both the GrB_Desc_Field and the
 // GxB_Option_Field for global options.  They are defined with the same integer
@@ -3456,7 +3479,9 @@ typedef enum
     GxB_DESCRIPTOR_GPU_CHUNK   = GxB_GPU_CHUNK,
 
     GxB_AxB_METHOD = 1000,  // descriptor for selecting C=A*B algorithm
-    GxB_SORT = 35           // control sort in GrB_mxm
+    GxB_SORT = 35,          // control sort in GrB_mxm
+    GxB_COMPRESSION = 36,   // select compression for GxB_Matrix_serialize
+    GxB_IMPORT = 37         // control how GxB_*_import uses the user arrays
 }
 GrB_Desc_Field ;
 
@@ -3484,7 +3509,15 @@ typedef enum
     GxB_AxB_GUSTAVSON = 1001,   // gather-scatter saxpy method
     GxB_AxB_DOT       = 1003,   // dot product
     GxB_AxB_HASH      = 1004,   // hash-based saxpy method
-    GxB_AxB_SAXPY     = 1005    // saxpy method (any kind)
+    GxB_AxB_SAXPY     = 1005,   // saxpy method (any kind)
+    GxB_AxB_OUTER     = 1006,   // outer product method, for C=A*B' only
+
+    // for GxB_IMPORT only:
+    GxB_SHALLOW_IMPORT = 3001,  // import a read-only view of the user arrays
+
+    // for GxB_COMPRESSION only:
+    GxB_COMPRESSION_NONE   = 4000,  // no compression
+    GxB_COMPRESSION_VARINT = 4001   // delta/varint compression (the default)
 }
 GrB_Desc_Value ;
 
@@ -3622,6 +3655,8 @@ typedef enum            // for global options or matrix options
     GxB_HYPER_SWITCH = 0,   // defines switch to hypersparse (a double value)
     GxB_BITMAP_SWITCH = 34, // defines switch to bitmap (a double value)
     GxB_FORMAT = 1,         // defines CSR/CSC format: GxB_BY_ROW or GxB_BY_COL
+    GxB_INDEX32_CONTROL = 46,   // 32-bit integer control; see below
+    GxB_BITMAP_PACK_CONTROL = 48,   // packed bitmap control; see below
 
     //------------------------------------------------------------
     // for GxB_Global_Option_get only:
@@ -3640,6 +3675,13 @@ typedef enum            // for global options or matrix options
     GxB_API_DATE = 17,              // date of the API (char *)
     GxB_API_ABOUT = 18,             // about the API (char *)
     GxB_API_URL = 19,               // URL for the API (char *)
+    GxB_PLAN_CACHE_HITS = 41,       // # of saxpy3 plan cache hits (int64_t)
+    GxB_PLAN_CACHE_MISSES = 42,     // # of saxpy3 plan cache misses (int64_t)
+    GxB_AxB_COST_PREDICTED = 44,    // predicted time of last GrB_mxm (double)
+    GxB_AxB_COST_ACTUAL = 45,       // measured time of last GrB_mxm (double)
+    GxB_MEMORY_POOL_HITS = 51,      // # of blocks reused from the pool
+    GxB_MEMORY_POOL_MISSES = 52,    // # of blocks not found in the pool
+    GxB_MEMORY_POOL_SIZE = 53,      // # of bytes held in the pool (int64_t)
 
     //------------------------------------------------------------
     // for GxB_Global_Option_get/set only:
@@ -3654,12 +3696,23 @@ typedef enum            // for global options or matrix options
 
     GxB_BURBLE = 99,    // diagnostic output (bool *)
 
+    GxB_PLAN_CACHE = 40,    // cache saxpy3 task schedules (bool)
+    GxB_AxB_COST_MODEL = 43,    // select GrB_mxm methods by cost model (bool)
+    GxB_MEMORY_POOL = 50,       // max # of bytes in the memory pool (int64_t)
+    GxB_MEMORY_FIRST_TOUCH = 54,    // clear large blocks in parallel (bool)
+    GxB_MEMORY_HUGE_PAGES = 55,     // use huge pages for large blocks (bool)
+    GxB_NUMA_POLICY = 56,           // placement of large blocks; see below
+    GxB_BUILD_SORT = 57,            // sorting method for GrB_Matrix_build
+    GxB_PENDING_RUN_SIZE = 58,      // size of sorted runs of pending tuples
+
     //------------------------------------------------------------
     // for GxB_Matrix_Option_get only:
     //------------------------------------------------------------
 
     GxB_SPARSITY_STATUS = 33,       // hyper, sparse, bitmap or full (1,2,4,8)
     GxB_IS_HYPER = 6,               // deprecated; use GxB_SPARSITY_STATUS
+    GxB_INDEX32_STATUS = 47,        // true if held in 32-bit integers (bool)
+    GxB_BITMAP_PACK_STATUS = 49,    // true if a packed bitmap (bool)
 
     //------------------------------------------------------------
     // for GxB_Matrix_Option_get/set only:
@@ -3740,6 +3793,92 @@ GB_PUBLIC const double GxB_HYPER_DEFAULT ;
 // for how A should be stored (hypersparse, sparse, bitmap, or full, or any
 // combination).
 
+// GxB_INDEX32_CONTROL can be one of these 3 values:
+#define GxB_INDEX32_AUTO    0   // 32-bit integers for large matrices that fit
+#define GxB_INDEX32_ALWAYS  1   // 32-bit integers whenever the matrix fits
+#define GxB_INDEX32_NEVER   2   // 64-bit integers only
+
+// GxB_Matrix_Option_set (A, GxB_INDEX32_CONTROL, icontrol) controls how the
+// pattern of a sparse or hypersparse matrix A is held.  Its row and column
+// indices can be held in 32-bit integers if its dimensions are less than
+// 2^31, and its vector pointers if it has fewer than 2^31 entries.  This
+// halves the memory used by the pattern of the matrix.  A matrix is converted
+// when it is built by GrB_Matrix_build, when GrB_wait is called, and when this
+// option is set.  With GxB_INDEX32_AUTO (the default), only matrices with at
+// least a million entries are converted.  GraphBLAS operations work with
+// 64-bit integers, so the matrix is converted back when it is next used (other
+// than by GrB_*_nvals, GrB_*_extractElement, and GxB_*_fprint), and it can
+// be converted again with GrB_wait.
+//
+// GxB_Matrix_Option_get (A, GxB_INDEX32_STATUS, &is32) returns true if the
+// pattern of A is currently held in 32-bit integers.
+
+// GxB_BITMAP_PACK_CONTROL can be one of these 3 values:
+#define GxB_BITMAP_PACK_AUTO    0   // pack large bitmaps
+#define GxB_BITMAP_PACK_ALWAYS  1   // pack all bitmaps
+#define GxB_BITMAP_PACK_NEVER   2   // one byte per position only
+
+// GxB_Matrix_Option_set (A, GxB_BITMAP_PACK_CONTROL, pcontrol) controls how
+// the pattern of a bitmap matrix A is held.  The bitmap normally uses one byte
+// for each position in the matrix, but it can be packed into one bit per
+// position, which reduces its size by a factor of 8.  A bitmap matrix is
+// packed when GrB_wait is called and when this option is set.  With
+// GxB_BITMAP_PACK_AUTO (the default), only bitmaps with at least a million
+// positions are packed.  GraphBLAS operations work with the unpacked bitmap,
+// so the matrix is unpacked when it is next used (other than by GrB_*_nvals,
+// GrB_*_extractElement, and GxB_*_fprint), and it can be packed again with
+// GrB_wait.
+//
+// GxB_Matrix_Option_get (A, GxB_BITMAP_PACK_STATUS, &is_packed) returns true
+// if A is a bitmap matrix that is currently packed.
+
+// GxB_NUMA_POLICY can be one of these 3 values:
+#define GxB_NUMA_DEFAULT        0   // pages placed by the operating system
+#define GxB_NUMA_INTERLEAVE     1   // pages interleaved across all threads
+#define GxB_NUMA_BY_TASK        2   // pages placed with the thread's task
+
+// GxB_Global_Option_set (GxB_NUMA_POLICY, policy) controls where the pages of
+// large blocks of memory are placed on a NUMA system, relative to the threads
+// that use them.  With GxB_NUMA_DEFAULT, each page is placed by the operating
+// system when it is first touched.  With GxB_NUMA_INTERLEAVE, the pages of
+// each large block are touched round-robin by all threads when the block is
+// allocated, which spreads the block evenly across the NUMA nodes.  With
+// GxB_NUMA_BY_TASK, each thread touches a contiguous part of the block, and
+// the kernels that slice a matrix by its entries use one task per thread, so
+// that each task works on the part of the matrix in its own NUMA node.  The
+// threads themselves are bound to cores by the OpenMP runtime (see
+// OMP_PROC_BIND and OMP_PLACES).
+
+// GxB_BUILD_SORT can be one of these 3 values:
+#define GxB_BUILD_SORT_AUTO     0   // selected for each problem (default)
+#define GxB_BUILD_SORT_MERGE    1   // always use the mergesort
+#define GxB_BUILD_SORT_RADIX    2   // use the radix sort when possible
+
+// GxB_Global_Option_set (GxB_BUILD_SORT, method) controls how the tuples are
+// sorted by GrB_Matrix_build, GrB_Vector_build, and by GrB_wait when it
+// assembles the pending tuples of a matrix.  The radix sort packs each (i,j)
+// index pair into a single integer key, and takes time proportional to the
+// number of tuples times the number of bits in the largest key.  It is
+// faster than the mergesort when the matrix dimensions are modest relative
+// to the number of tuples, which is the typical case.  With the default,
+// GxB_BUILD_SORT_AUTO, the method is selected for each problem from the
+// number of tuples and the dimensions of the matrix.  The radix sort cannot
+// be used if the packed keys would need more than 63 bits; the mergesort is
+// used in that case even with GxB_BUILD_SORT_RADIX.  The results are
+// identical for all methods.
+
+// GxB_Global_Option_set (GxB_PENDING_RUN_SIZE, int64_t run_size) controls how
+// the pending tuples of a matrix are held, as they are added by setElement and
+// GrB_assign.  By default (run_size = 0), they are held in the order they are
+// added, and GrB_wait sorts them all at once.  If run_size is positive, every
+// run_size tuples are sorted as they are added, and the sorted runs are merged
+// incrementally, so that GrB_wait only needs to sort the last run and merge
+// the others.  This spreads the cost of sorting the tuples across the calls to
+// setElement, and reduces the time taken by each GrB_wait for an application
+// that streams entries into a matrix and calls GrB_wait periodically.  A
+// run_size of about 64K tuples is a good choice.  The results are identical
+// for any run_size.
+
 // GxB_HYPER_SWITCH:
 //      If the matrix or vector structure can be sparse or hypersparse, the
 //      GxB_HYPER_SWITCH parameter controls when each of these structures are
@@ -3867,10 +4006,47 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
 //
 //      GxB_set (GxB_BURBLE, bool burble) ;
 //      GxB_get (GxB_BURBLE, bool *burble) ;
+//
+//      GxB_set (GxB_PLAN_CACHE, bool plan_cache) ;
+//      GxB_get (GxB_PLAN_CACHE, bool *plan_cache) ;
+//
+//      GxB_set (GxB_AxB_COST_MODEL, bool cost_model) ;
+//      GxB_get (GxB_AxB_COST_MODEL, bool *cost_model) ;
+//
+//      GxB_set (GxB_MEMORY_POOL, int64_t limit) ;
+//      GxB_get (GxB_MEMORY_POOL, int64_t *limit) ;
+//
+//      GxB_set (GxB_MEMORY_FIRST_TOUCH, bool first_touch) ;
+//      GxB_get (GxB_MEMORY_FIRST_TOUCH, bool *first_touch) ;
+//
+//      GxB_set (GxB_MEMORY_HUGE_PAGES, bool huge_pages) ;
+//      GxB_get (GxB_MEMORY_HUGE_PAGES, bool *huge_pages) ;
+//
+//      GxB_set (GxB_NUMA_POLICY, policy) ;
+//      GxB_get (GxB_NUMA_POLICY, int *policy) ;
+//
+//      GxB_set (GxB_BUILD_SORT, method) ;
+//      GxB_get (GxB_BUILD_SORT, int *method) ;
+//
+//      GxB_set (GxB_PENDING_RUN_SIZE, int64_t run_size) ;
+//      GxB_get (GxB_PENDING_RUN_SIZE, int64_t *run_size) ;
+//
+//      GxB_set (GxB_INDEX32_CONTROL, icontrol) ;
+//      GxB_get (GxB_INDEX32_CONTROL, int *icontrol) ;
+//
+//      GxB_set (GxB_BITMAP_PACK_CONTROL, pcontrol) ;
+//      GxB_get (GxB_BITMAP_PACK_CONTROL, int *pcontrol) ;
 
 // To get global options that can be queried but not modified:
 //
 //      GxB_get (GxB_MODE, GrB_Mode *mode) ;
+//      GxB_get (GxB_PLAN_CACHE_HITS, int64_t *hits) ;
+//      GxB_get (GxB_PLAN_CACHE_MISSES, int64_t *misses) ;
+//      GxB_get (GxB_AxB_COST_PREDICTED, double *predicted) ;
+//      GxB_get (GxB_AxB_COST_ACTUAL, double *actual) ;
+//      GxB_get (GxB_MEMORY_POOL_HITS, int64_t *hits) ;
+//      GxB_get (GxB_MEMORY_POOL_MISSES, int64_t *misses) ;
+//      GxB_get (GxB_MEMORY_POOL_SIZE, int64_t *size) ;
 
 // To set/get a matrix option:
 //
@@ -3891,6 +4067,14 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
 //      GxB_get (GrB_Matrix A, GxB_SPARSITY_CONTROL, int *scontrol) ;
 //
 //      GxB_get (GrB_Matrix A, GxB_SPARSITY_STATUS, int *sparsity) ;
+//
+//      GxB_set (GrB_Matrix A, GxB_INDEX32_CONTROL, icontrol) ;
+//      GxB_get (GrB_Matrix A, GxB_INDEX32_CONTROL, int *icontrol) ;
+//      GxB_get (GrB_Matrix A, GxB_INDEX32_STATUS, bool *is32) ;
+//
+//      GxB_set (GrB_Matrix A, GxB_BITMAP_PACK_CONTROL, pcontrol) ;
+//      GxB_get (GrB_Matrix A, GxB_BITMAP_PACK_CONTROL, int *pcontrol) ;
+//      GxB_get (GrB_Matrix A, GxB_BITMAP_PACK_STATUS, bool *is_packed) ;
 
 // To set/get a vector option or status:
 //
@@ -3906,6 +4090,14 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
 //      GxB_get (GrB_Vector v, GxB_SPARSITY_CONTROL, int *scontrol) ;
 //
 //      GxB_get (GrB_Vector v, GxB_SPARSITY_STATUS, int *sparsity) ;
+//
+//      GxB_set (GrB_Vector v, GxB_INDEX32_CONTROL, icontrol) ;
+//      GxB_get (GrB_Vector v, GxB_INDEX32_CONTROL, int *icontrol) ;
+//      GxB_get (GrB_Vector v, GxB_INDEX32_STATUS, bool *is32) ;
+//
+//      GxB_set (GrB_Vector v, GxB_BITMAP_PACK_CONTROL, pcontrol) ;
+//      GxB_get (GrB_Vector v, GxB_BITMAP_PACK_CONTROL, int *pcontrol) ;
+//      GxB_get (GrB_Vector v, GxB_BITMAP_PACK_STATUS, bool *is_packed) ;
 
 // To set/get a descriptor field:
 //
@@ -3942,6 +4134,14 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
 //
 //      GxB_set (GrB_Descriptor d, GxB_SORT, sort) ;
 //      GxB_get (GrB_Descriptor d, GxB_SORT, int *sort) ;
+//
+//      GxB_set (GrB_Descriptor d, GxB_IMPORT, GxB_DEFAULT) ;
+//      GxB_set (GrB_Descriptor d, GxB_IMPORT, GxB_SHALLOW_IMPORT) ;
+//      GxB_get (GrB_Descriptor d, GxB_IMPORT, GrB_Desc_Value *v) ;
+//
+//      GxB_set (GrB_Descriptor d, GxB_COMPRESSION, GxB_COMPRESSION_NONE) ;
+//      GxB_set (GrB_Descriptor d, GxB_COMPRESSION, GxB_COMPRESSION_VARINT) ;
+//      GxB_get (GrB_Descriptor d, GxB_COMPRESSION, GrB_Desc_Value *v) ;
 
 #if GxB_STDC_VERSION >= 201112L
 #define GxB_set(arg1,...)                                   \
@@ -8076,6 +8276,18 @@ GrB_Info GxB_Scalar_fprint          // print and check a GxB_Scalar
 // as NULL, GxB_Vector_import returns v as NULL, and the user input arrays are
 // neither modified nor freed.  They are still owned by the user application.
 
+// If the GxB_IMPORT field of the descriptor is GxB_SHALLOW_IMPORT, the import
+// does not take ownership of the user arrays.  The pointers to them are left
+// unchanged, and the new matrix or vector is a read-only view of their content,
+// created in O(1) time with no copying.  The arrays need not have been
+// allocated by malloc; they may be read-only memory, such as a file mapped by
+// mmap.  GraphBLAS never writes to them, nor frees them.  If the matrix is
+// later modified (as the output of an operation, by GrB_*_setElement,
+// GrB_*_removeElement, GrB_*_resize, and so on), or exported, GraphBLAS first
+// makes its own copy of the content (copy-on-write).  The user application
+// must not modify or free the arrays until the matrix has been freed or
+// exported.
+
 //------------------------------------------------------------------------------
 // GxB_Matrix_import_CSR: import a CSR matrix
 //------------------------------------------------------------------------------
@@ -8611,6 +8823,124 @@ GrB_Info GxB_Vector_export_Full   // export and free a full vector
 // modify A, the GxB_Vector_export does not modify v, and the user arrays are
 // returned as NULL.
 
+//==============================================================================
+// GxB_Matrix_serialize/deserialize: write/read a matrix to/from a blob
+//==============================================================================
+
+// GxB_Matrix_serialize copies the content of a matrix into a single block of
+// memory (a "blob"), which the user application can write to a file or send
+// to another process.  GxB_Matrix_deserialize constructs a new matrix from
+// the blob.  The matrix is held in the blob in its native format: its type,
+// dimensions, CSR/CSC format, sparsity structure (hypersparse, sparse,
+// bitmap, or full), sparsity control, and the iso property are all preserved.
+// Any pending work on A is finished first.  The blob is allocated with the
+// same malloc function used by GraphBLAS, and the user application must free
+// it with the corresponding free function, as for GxB_*_export.
+
+// The integer arrays that hold the pattern of the matrix are compressed, as
+// selected by the GxB_COMPRESSION field of the descriptor.  The numerical
+// values are not compressed.  The blob is held in the byte order of the
+// machine that created it.
+
+// GxB_Matrix_deserialize checks the blob before returning the matrix, and
+// returns GrB_INVALID_OBJECT if it is invalid.  If the blob holds a matrix of
+// a user-defined type, the same type must be passed to GxB_Matrix_deserialize;
+// otherwise the type may be NULL, in which case the type in the blob is used.
+
+// Example:
+//
+//      void *blob ;
+//      GrB_Index blob_size ;
+//      GxB_Matrix_serialize (&blob, &blob_size, A, NULL) ;
+//      fwrite (blob, 1, blob_size, f) ;
+//      ...
+//      GxB_Matrix_deserialize (&C, NULL, blob, blob_size, NULL) ;
+//      free (blob) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_serialize       // serialize a GrB_Matrix to a blob
+(
+    // output:
+    void **blob_handle,             // the blob, allocated on output
+    GrB_Index *blob_size_handle,    // size of the blob, in bytes
+    // input:
+    GrB_Matrix A,                   // matrix to serialize
+    const GrB_Descriptor desc       // descriptor to select compression method
+                                    // and to control # of threads used
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_deserialize     // deserialize blob into a GrB_Matrix
+(
+    // output:
+    GrB_Matrix *C,                  // output matrix created from the blob
+    // input:
+    GrB_Type type,                  // type of C; required if the blob holds a
+                                    // matrix of user-defined type, and may be
+                                    // NULL otherwise
+    const void *blob,               // the blob
+    GrB_Index blob_size,            // size of the blob, in bytes
+    const GrB_Descriptor desc       // to control # of threads used
+) ;
+
+//==============================================================================
+// GxB_Matrix_mmap_write/mmap: file-backed matrices
+//==============================================================================
+
+// GxB_Matrix_mmap_write writes a matrix to a file, in the same layout as an
+// uncompressed blob from GxB_Matrix_serialize, but with each part of the
+// matrix aligned to a page of the file.  Any pending work on A is finished,
+// and A is converted to 64-bit integers and an unpacked bitmap, if needed.
+// The matrix is written directly from A, with no extra memory.
+
+// GxB_Matrix_mmap maps such a file read-only into memory, and returns a new
+// matrix C that refers to the file, rather than a copy of it.  The pages of
+// the file are read by the operating system only as they are accessed, so C
+// can be larger than the memory of the machine, and used as an input to
+// GrB_mxv, GrB_reduce, and other methods.  GrB_mxv and GrB_reduce read the
+// file ahead of the computation, in large requests, as their tasks proceed.
+// Any method that modifies C first copies it into memory.  C is freed with
+// GrB_Matrix_free, which also unmaps the file.  The file must not be modified
+// while C exists.
+
+// The header of the file is checked, but the rest of the file is trusted, as
+// it is for GxB_SHALLOW_IMPORT.  GxB_Matrix_deserialize may be used to read a
+// copy of the file into memory, with a full check.  If the file holds a
+// compressed blob from GxB_Matrix_serialize, GxB_Matrix_mmap constructs C in
+// memory instead.  On systems without mmap, GxB_Matrix_mmap reads the entire
+// file into memory.  The file is held in the byte order of the machine that
+// created it.
+
+// Example:
+//
+//      GxB_Matrix_mmap_write ("A.grb", A, NULL) ;
+//      GrB_Matrix_free (&A) ;
+//      ...
+//      GxB_Matrix_mmap (&A, NULL, "A.grb", NULL) ;
+//      GrB_mxv (w, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, u, NULL) ;
+//      GrB_Matrix_free (&A) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_mmap_write      // write a GrB_Matrix to a file
+(
+    const char *filename,           // name of the file to write
+    GrB_Matrix A,                   // matrix to write
+    const GrB_Descriptor desc       // to control # of threads used
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_mmap            // map a file into a GrB_Matrix
+(
+    // output:
+    GrB_Matrix *C,                  // output matrix mapped from the file
+    // input:
+    GrB_Type type,                  // type of C; required if the file holds a
+                                    // matrix of user-defined type, and may be
+                                    // NULL otherwise
+    const char *filename,           // name of the file to map
+    const GrB_Descriptor desc       // to control # of threads used
+) ;
+
 //==============================================================================
 // CUDA memory management (DRAFT: in progress, do not use)
 //==============================================================================
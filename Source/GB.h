@@ -106,7 +106,9 @@ bool GB_aliased             // determine if A and B are aliased
     GrB_Matrix B            // input B matrix
 ) ;
 
-// matrices returned to the user are never shallow; internal matrices may be
+// internal matrices may be shallow, and so may a matrix imported with the
+// GxB_SHALLOW_IMPORT descriptor; all other matrices returned to the user are
+// never shallow
 GB_PUBLIC                       // used by the MATLAB interface
 bool GB_is_shallow              // true if any component of A is shallow
 (
@@ -523,6 +525,13 @@ GrB_Info GB_dup2            // make an exact copy of a matrix
     GB_Context Context
 ) ;
 
+// copy the shallow components of A before it is modified in-place
+GrB_Info GB_unshallow           // copy all shallow components of A
+(
+    GrB_Matrix A,               // matrix to modify, in-place
+    GB_Context Context
+) ;
+
 void GB_memcpy                  // parallel memcpy
 (
     void *dest,                 // destination
@@ -855,6 +864,73 @@ void GB_free_memory
 #define GB_REALLOC(p,nnew,nold,type,ok) \
     p = (type *) GB_realloc_memory (nnew, nold, sizeof (type), (void *) p, ok)
 
+// large blocks (see GxB_MEMORY_FIRST_TOUCH and GxB_MEMORY_HUGE_PAGES)
+
+#define GB_FIRST_TOUCH_MIN (1024*1024)      // smallest block to prepare
+#define GB_HUGE_PAGE_SIZE (2*1024*1024)     // smallest block for huge pages
+#define GB_PAGE_SIZE 4096                   // stride for touching pages
+
+// true if the NUMA policy is valid (see GxB_NUMA_POLICY)
+#define GB_NUMA_POLICY_OK(policy)                                       \
+    ((policy) == GxB_NUMA_DEFAULT || (policy) == GxB_NUMA_INTERLEAVE || \
+     (policy) == GxB_NUMA_BY_TASK)
+
+// # of tasks per thread for kernels that slice their work by entries.  With
+// GxB_NUMA_BY_TASK, each thread does a single task, on the part of the
+// matrix it first touched.
+#define GB_NUMA_NTASKS(k) \
+    ((GB_Global_numa_policy_get ( ) == GxB_NUMA_BY_TASK) ? 1 : (k))
+
+// true if the sorting method for GB_builder is valid (see GxB_BUILD_SORT)
+#define GB_BUILD_SORT_OK(method)                                            \
+    ((method) == GxB_BUILD_SORT_AUTO || (method) == GxB_BUILD_SORT_MERGE || \
+     (method) == GxB_BUILD_SORT_RADIX)
+
+void GB_first_touch
+(
+    void *p,                // block of memory to prepare
+    size_t size,            // size of the block, in bytes
+    bool clear              // if true, set the block to zero
+) ;
+
+// read-ahead for a task of a kernel that streams through a matrix held in a
+// file mapping (see GxB_Matrix_mmap); nothing is done for any other matrix
+void GB_mmap_readahead
+(
+    const GrB_Matrix A,     // matrix that may be held in a file mapping
+    const int64_t *Slice,   // task schedule of size ntasks+1, or NULL
+    bool Slice_by_vector,   // if true, Slice holds vectors, not entries
+    int tid,                // task about to start
+    int ntasks,             // # of tasks in the schedule
+    int nthreads            // # of threads executing the tasks
+) ;
+
+// workspace that may be recycled through the memory pool (see GxB_MEMORY_POOL)
+
+#define GB_POOL_HEADER 16   // bytes at the start of each block of workspace
+#define GB_POOL_KMIN 8      // smallest block in the pool is 2^8 bytes
+
+void *GB_pool_malloc        // pointer to allocated block of memory
+(
+    size_t nitems,          // number of items to allocate
+    size_t size_of_item,    // sizeof each item
+    bool do_calloc          // if true, set the block to zero
+) ;
+
+void GB_pool_free
+(
+    void *p                 // pointer to block of memory to free
+) ;
+
+#define GB_FREE_POOL(p)                                     \
+{                                                           \
+    GB_pool_free ((void *) p) ;                             \
+    (p) = NULL ;                                            \
+}
+
+#define GB_MALLOC_POOL(n,type) (type *) GB_pool_malloc (n, sizeof (type), false)
+#define GB_CALLOC_POOL(n,type) (type *) GB_pool_malloc (n, sizeof (type), true)
+
 void GB_Matrix_free             // free a matrix
 (
     GrB_Matrix *matrix_handle   // handle of matrix to free
@@ -1210,10 +1286,12 @@ GrB_Info GB_unjumble        // unjumble a matrix
 #define GB_ANY_PENDING_WORK(A) \
     (GB_PENDING (A) || GB_ZOMBIES (A) || GB_JUMBLED (A))
 
-// wait if condition holds
+// wait if condition holds; a matrix with 32-bit integers is always converted
+// back to 64-bit integers, and a packed bitmap is always unpacked, which is
+// done by GB_Matrix_wait
 #define GB_WAIT_IF(condition,A)                                         \
 {                                                                       \
-    if (condition)                                                      \
+    if ((condition) || GB_INDEX32 (A) || GB_BITMAP_PACKED (A))          \
     {                                                                   \
         GrB_Info info ;                                                 \
         GB_OK (GB_Matrix_wait ((GrB_Matrix) A, Context)) ;              \
@@ -1233,6 +1311,12 @@ GrB_Info GB_unjumble        // unjumble a matrix
 // ensure A is not jumbled
 #define GB_MATRIX_WAIT_IF_JUMBLED(A) GB_WAIT_IF (GB_JUMBLED (A), A)
 
+// the pattern of a matrix may have changed
+#define GB_PATTERN_CHANGED(A)                                           \
+{                                                                       \
+    (A)->pattern_version = GB_Global_pattern_version_next ( ) ;         \
+}
+
 // true if a matrix has no entries; zombies OK
 #define GB_IS_EMPTY(A) ((GB_NNZ (A) == 0) && !GB_PENDING (A))
 
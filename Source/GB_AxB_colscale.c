@@ -160,7 +160,7 @@ GrB_Info GB_AxB_colscale            // C = A*D, column scale with diagonal D
     int64_t anvec = A->nvec ;
     GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
     int nthreads = GB_nthreads (anz + anvec, chunk, nthreads_max) ;
-    int ntasks = (nthreads == 1) ? 1 : (32 * nthreads) ;
+    int ntasks = (nthreads == 1) ? 1 : (GB_NUMA_NTASKS (32) * nthreads) ;
 
     //--------------------------------------------------------------------------
     // slice the entries for each task
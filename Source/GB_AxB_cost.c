@@ -0,0 +1,461 @@
+//------------------------------------------------------------------------------
+// GB_AxB_cost: estimate the run time of each method for C=A*B
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// See GB_AxB_cost.h for a description of the cost model.  All functions here
+// are CSR/CSC agnostic; the comments assume all matrices are held by column.
+// The estimates are coarse: they are based only on the dimensions of the
+// matrices, and the number of entries and non-empty vectors in each, not on
+// the actual patterns.  They are meant only to rank the methods for a given
+// problem, so each estimate only counts the work that differs between the
+// methods.
+
+#include "GB_AxB_cost.h"
+#include "GB_sort.h"
+
+//------------------------------------------------------------------------------
+// GB_cost_parallel: time for work done by all threads
+//------------------------------------------------------------------------------
+
+// work is the # of basic operations, and t is the time it takes one thread
+// to do all of them.
+
+static inline double GB_cost_parallel (double work, double t,
+    GB_Context Context)
+{
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (work, chunk, nthreads_max) ;
+    return (t / nthreads) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_cost_nvec: # of non-empty vectors of a matrix
+//------------------------------------------------------------------------------
+
+static inline double GB_cost_nvec (const GrB_Matrix A, GB_Context Context)
+{
+    if (GB_IS_BITMAP (A) || GB_IS_FULL (A))
+    {
+        return ((double) A->vdim) ;
+    }
+    if (A->nvec_nonempty < 0)
+    {
+        A->nvec_nonempty = GB_nvec_nonempty (A, Context) ;
+    }
+    return ((double) A->nvec_nonempty) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_cost_dot: time for one dot product per entry of C, times cnz
+//------------------------------------------------------------------------------
+
+static double GB_cost_dot (double cnz, const GrB_Matrix A,
+    const GrB_Matrix B, GB_Context Context)
+{
+
+    double anz = GB_NNZ (A) ;
+    double bnz = GB_NNZ (B) ;
+    double adeg = anz / GB_IMAX (GB_cost_nvec (A, Context), 1) ;
+    double bdeg = bnz / GB_IMAX (GB_cost_nvec (B, Context), 1) ;
+    bool A_is_dense = GB_IS_BITMAP (A) || GB_IS_FULL (A) ;
+    bool B_is_dense = GB_IS_BITMAP (B) || GB_IS_FULL (B) ;
+
+    double work, t ;
+    if (A_is_dense && B_is_dense)
+    {
+        // each dot product scans all of A(:,i) and B(:,j)
+        work = cnz * A->vlen ;
+        t = work * GB_Global_axb_cost_get (GB_AXB_COST_STREAM) ;
+    }
+    else if (A_is_dense)
+    {
+        // each entry of B(:,j) is used to look up A(k,i)
+        work = cnz * bdeg ;
+        t = work * GB_Global_axb_cost_get (GB_AXB_COST_GATHER) ;
+    }
+    else if (B_is_dense)
+    {
+        // each entry of A(:,i) is used to look up B(k,j)
+        work = cnz * adeg ;
+        t = work * GB_Global_axb_cost_get (GB_AXB_COST_GATHER) ;
+    }
+    else
+    {
+        // A(:,i) and B(:,j) are merged
+        work = cnz * (adeg + bdeg) ;
+        t = work * GB_Global_axb_cost_get (GB_AXB_COST_STREAM) ;
+    }
+    return (GB_cost_parallel (work, t, Context)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_cost_transpose: time to compute A'
+//------------------------------------------------------------------------------
+
+double GB_AxB_cost_transpose        // time to compute A'
+(
+    const GrB_Matrix A,
+    GB_Context Context
+)
+{
+    double anz = GB_NNZ_HELD (A) ;
+    double t = anz * GB_Global_axb_cost_get (GB_AXB_COST_TRANSPOSE)
+        + A->vlen * GB_Global_axb_cost_get (GB_AXB_COST_STREAM) ;
+    return (GB_cost_parallel (anz + A->vlen, t, Context)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_cost_dot2: time to compute C=A'*B via dot2
+//------------------------------------------------------------------------------
+
+// C is bitmap, of size anvec-by-bnvec, and each entry is computed with a
+// single dot product.
+
+double GB_AxB_cost_dot2             // time to compute C=A'*B via dot2
+(
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    GB_Context Context
+)
+{
+    double cnz = GB_cost_nvec (A, Context) * GB_cost_nvec (B, Context) ;
+    double t_bitmap = GB_cost_parallel (cnz,
+        cnz * GB_Global_axb_cost_get (GB_AXB_COST_STREAM), Context) ;
+    return (t_bitmap + GB_cost_dot (cnz, A, B, Context)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_cost_dot3: time to compute C<M>=A'*B via dot3
+//------------------------------------------------------------------------------
+
+// One dot product is computed for each entry in the mask.
+
+double GB_AxB_cost_dot3             // time to compute C<M>=A'*B via dot3
+(
+    const GrB_Matrix M,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    GB_Context Context
+)
+{
+    return (GB_cost_dot ((double) GB_NNZ (M), A, B, Context)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_cost_saxpy: time to compute C=A*B via saxpy
+//------------------------------------------------------------------------------
+
+// If A_transpose is true, then C=A'*B is computed by first transposing A, and
+// then computing C=(A')*B, and likewise for B_transpose.  The # of flops is
+// estimated by assuming the entries of A and B are uniformly distributed.  A
+// bitmap C is scanned in its entirety.  A sparse C is computed by saxpy3,
+// which uses Gustavson's method for dense columns of C and a hash table for
+// sparse columns, and then gathers the pattern of C.  If C_sparsity is zero,
+// the time for the faster of the two is returned, but a bitmap C is only
+// considered if A or B are bitmap or full.
+
+double GB_AxB_cost_saxpy            // time to compute C=A*B via saxpy
+(
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_transpose,         // if true, A' is transposed first
+    const bool B_transpose,         // if true, B' is transposed first
+    const int C_sparsity,           // GxB_BITMAP, GxB_SPARSE, or 0 if either
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // get the problem size
+    //--------------------------------------------------------------------------
+
+    double m = (A_transpose) ? A->vdim : A->vlen ;  // # of rows of C
+    double k = (A_transpose) ? A->vlen : A->vdim ;  // inner dimension
+    double n = (B_transpose) ? B->vlen : B->vdim ;  // # of columns of C
+    double anz = GB_NNZ (A) ;
+    double bnz = GB_NNZ (B) ;
+    double bnvec = (B_transpose) ? GB_IMIN (n, bnz) : GB_cost_nvec (B, Context);
+    double flops = anz * bnz / GB_IMAX (k, 1) ;
+    double cnz = GB_IMIN (flops, m * n) ;
+
+    //--------------------------------------------------------------------------
+    // time for the transposes
+    //--------------------------------------------------------------------------
+
+    double t = 0 ;
+    if (A_transpose) t += GB_AxB_cost_transpose (A, Context) ;
+    if (B_transpose) t += GB_AxB_cost_transpose (B, Context) ;
+
+    //--------------------------------------------------------------------------
+    // time for a bitmap C
+    //--------------------------------------------------------------------------
+
+    // scatter into the bitmap C, which is cleared and scanned once
+    double t_bitmap = GB_cost_parallel (m * n + flops,
+        m * n * GB_Global_axb_cost_get (GB_AXB_COST_STREAM) +
+        flops * GB_Global_axb_cost_get (GB_AXB_COST_SCATTER), Context) ;
+
+    //--------------------------------------------------------------------------
+    // time for a sparse C
+    //--------------------------------------------------------------------------
+
+    // saxpy3 uses Gustavson's method if the flop count of C(:,j) is a large
+    // fraction of its length, and the hash method otherwise
+    double cjflops = flops / GB_IMAX (bnvec, 1) ;
+    int kind = (16 * cjflops > m) ? GB_AXB_COST_SCATTER : GB_AXB_COST_HASH ;
+    double t_sparse = GB_cost_parallel (flops + cnz,
+        flops * GB_Global_axb_cost_get (kind) +
+        2 * cnz * GB_Global_axb_cost_get (GB_AXB_COST_STREAM), Context) ;
+
+    //--------------------------------------------------------------------------
+    // return the result
+    //--------------------------------------------------------------------------
+
+    bool bitmap_ok = GB_IS_BITMAP (A) || GB_IS_FULL (A) ||
+                     GB_IS_BITMAP (B) || GB_IS_FULL (B) ;
+    if (C_sparsity == GxB_BITMAP)
+    { 
+        return (t + t_bitmap) ;
+    }
+    else if (C_sparsity == 0 && bitmap_ok)
+    { 
+        return (t + GB_IMIN (t_bitmap, t_sparse)) ;
+    }
+    else
+    { 
+        return (t + t_sparse) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_cost_outer: time to compute C=A*B' via outer products
+//------------------------------------------------------------------------------
+
+double GB_AxB_cost_outer            // time to compute C=A*B' via outer
+(
+    const double flops,             // # of tuples A(i,k)*B(j,k)
+    GB_Context Context
+)
+{
+    // each tuple is constructed, and then sorted and assembled by GB_builder
+    double t = flops * (GB_Global_axb_cost_get (GB_AXB_COST_STREAM) +
+        GB_Global_axb_cost_get (GB_AXB_COST_BUILD)) ;
+    return (GB_cost_parallel (flops, t, Context)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_cost_scale: time to compute C=A*D or C=D*B
+//------------------------------------------------------------------------------
+
+double GB_AxB_cost_scale            // time for C=A*D or C=D*B
+(
+    const GrB_Matrix A,             // the matrix that is not diagonal
+    GB_Context Context
+)
+{
+    // the pattern of A is copied into C, and each value is scaled
+    double anz = GB_NNZ (A) ;
+    double t = 2 * anz * GB_Global_axb_cost_get (GB_AXB_COST_STREAM) ;
+    return (GB_cost_parallel (anz, t, Context)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_cost_calibrate: measure the coefficients of the cost model
+//------------------------------------------------------------------------------
+
+// Each kind of basic operation is timed with a single thread on arrays of
+// size 2^20, which is typically larger than the L2 cache.  The random indices
+// are given by a fixed linear congruential generator, so the benchmark does
+// the same work each time.  If OpenMP is not available to time the kernels,
+// or if out of memory, the default coefficients are kept.  The coefficients
+// are measured only the first time the cost model is enabled.
+
+#define GB_CALIBRATE_N      (1 << 20)
+#define GB_CALIBRATE_TRIALS 3
+
+static bool GB_cost_calibrated = false ;
+
+#undef  GB_FREE_WORK
+#define GB_FREE_WORK        \
+{                           \
+    GB_FREE (Index) ;       \
+    GB_FREE (Flag) ;        \
+    GB_FREE (Key) ;         \
+    GB_FREE (X) ;           \
+    GB_FREE (W) ;           \
+}
+
+void GB_AxB_cost_calibrate (void)
+{
+
+    #if defined ( _OPENMP )
+
+    if (GB_cost_calibrated)
+    { 
+        // the coefficients have already been measured
+        return ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the workspace
+    //--------------------------------------------------------------------------
+
+    const int64_t n = GB_CALIBRATE_N ;
+    const int64_t hmask = 2*n - 1 ;                 // hash table of size 2n
+    int64_t *GB_RESTRICT Index = GB_MALLOC (n, int64_t) ;
+    int64_t *GB_RESTRICT Flag  = GB_MALLOC (2*n, int64_t) ;
+    int64_t *GB_RESTRICT Key   = GB_MALLOC (n, int64_t) ;
+    double  *GB_RESTRICT X     = GB_MALLOC (n, double) ;
+    double  *GB_RESTRICT W     = GB_MALLOC (2*n, double) ;
+    if (Index == NULL || Flag == NULL || Key == NULL || X == NULL || W == NULL)
+    {
+        // out of memory: keep the default coefficients
+        GB_FREE_WORK ;
+        return ;
+    }
+
+    uint64_t seed = 1 ;
+    for (int64_t p = 0 ; p < n ; p++)
+    {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL ;
+        Index [p] = (int64_t) ((seed >> 33) % n) ;
+        X [p] = (double) (p % 7) ;
+        W [p] = 0 ;
+    }
+
+    //--------------------------------------------------------------------------
+    // time each kind of operation
+    //--------------------------------------------------------------------------
+
+    double tmin [GB_AXB_COST_N] ;
+    for (int kind = 0 ; kind < GB_AXB_COST_N ; kind++)
+    {
+        tmin [kind] = INFINITY ;
+    }
+
+    volatile double result = 0 ;
+    for (int trial = 0 ; trial < GB_CALIBRATE_TRIALS ; trial++)
+    {
+        double s = 0, t ;
+
+        // stream: W = W + X
+        t = GB_OPENMP_GET_WTIME ;
+        for (int64_t p = 0 ; p < n ; p++)
+        {
+            W [p] += X [p] ;
+        }
+        t = GB_OPENMP_GET_WTIME - t ;
+        tmin [GB_AXB_COST_STREAM] = GB_IMIN (tmin [GB_AXB_COST_STREAM], t) ;
+
+        // gather: s += X (Index)
+        t = GB_OPENMP_GET_WTIME ;
+        for (int64_t p = 0 ; p < n ; p++)
+        {
+            s += X [Index [p]] ;
+        }
+        t = GB_OPENMP_GET_WTIME - t ;
+        tmin [GB_AXB_COST_GATHER] = GB_IMIN (tmin [GB_AXB_COST_GATHER], t) ;
+
+        // scatter: Gustavson's workspace, as used by saxpy3
+        memset (Flag, 0, n * sizeof (int64_t)) ;
+        t = GB_OPENMP_GET_WTIME ;
+        for (int64_t p = 0 ; p < n ; p++)
+        {
+            int64_t i = Index [p] ;
+            if (Flag [i] != trial + 1)
+            {
+                Flag [i] = trial + 1 ;
+                W [i] = X [p] ;
+            }
+            else
+            {
+                W [i] += X [p] ;
+            }
+        }
+        t = GB_OPENMP_GET_WTIME - t ;
+        tmin [GB_AXB_COST_SCATTER] = GB_IMIN (tmin [GB_AXB_COST_SCATTER], t) ;
+
+        // hash: linear probing, as used by saxpy3
+        memset (Flag, 0, 2*n * sizeof (int64_t)) ;
+        t = GB_OPENMP_GET_WTIME ;
+        for (int64_t p = 0 ; p < n ; p++)
+        {
+            int64_t i = Index [p] ;
+            int64_t i1 = i + 1 ;
+            int64_t h = (i * 257) & hmask ;
+            while (Flag [h] != 0 && Flag [h] != i1)
+            {
+                h = (h + 1) & hmask ;
+            }
+            if (Flag [h] == 0)
+            {
+                Flag [h] = i1 ;
+                W [h] = X [p] ;
+            }
+            else
+            {
+                W [h] += X [p] ;
+            }
+        }
+        t = GB_OPENMP_GET_WTIME - t ;
+        tmin [GB_AXB_COST_HASH] = GB_IMIN (tmin [GB_AXB_COST_HASH], t) ;
+
+        // transpose: bucket sort of the entries by their index
+        memset (Flag, 0, (n+1) * sizeof (int64_t)) ;
+        t = GB_OPENMP_GET_WTIME ;
+        for (int64_t p = 0 ; p < n ; p++)
+        {
+            Flag [Index [p]]++ ;
+        }
+        GB_cumsum (Flag, n, NULL, 1) ;
+        for (int64_t p = 0 ; p < n ; p++)
+        {
+            int64_t pC = Flag [Index [p]]++ ;
+            Key [pC] = p ;
+            W [pC] = X [p] ;
+        }
+        t = GB_OPENMP_GET_WTIME - t ;
+        tmin [GB_AXB_COST_TRANSPOSE] =
+            GB_IMIN (tmin [GB_AXB_COST_TRANSPOSE], t) ;
+
+        // build: sort the tuples, as done by GB_builder
+        memcpy (Key, Index, n * sizeof (int64_t)) ;
+        t = GB_OPENMP_GET_WTIME ;
+        GB_qsort_1a (Key, n) ;
+        t = GB_OPENMP_GET_WTIME - t ;
+        tmin [GB_AXB_COST_BUILD] = GB_IMIN (tmin [GB_AXB_COST_BUILD], t) ;
+
+        result += s + W [Key [n/2]] ;
+    }
+
+    //--------------------------------------------------------------------------
+    // set the coefficients: time per operation
+    //--------------------------------------------------------------------------
+
+    for (int kind = 0 ; kind < GB_AXB_COST_N ; kind++)
+    {
+        double c = tmin [kind] / n ;
+        c = GB_IMAX (c, 1e-12) ;
+        c = GB_IMIN (c, 1e-6) ;
+        GB_Global_axb_cost_set (kind, c) ;
+    }
+    GB_cost_calibrated = true ;
+
+    GBURBLE ("(cost model: stream %.3g gather %.3g scatter %.3g hash %.3g "
+        "transpose %.3g build %.3g ns) ",
+        1e9 * GB_Global_axb_cost_get (GB_AXB_COST_STREAM),
+        1e9 * GB_Global_axb_cost_get (GB_AXB_COST_GATHER),
+        1e9 * GB_Global_axb_cost_get (GB_AXB_COST_SCATTER),
+        1e9 * GB_Global_axb_cost_get (GB_AXB_COST_HASH),
+        1e9 * GB_Global_axb_cost_get (GB_AXB_COST_TRANSPOSE),
+        1e9 * GB_Global_axb_cost_get (GB_AXB_COST_BUILD)) ;
+
+    GB_FREE_WORK ;
+    #endif
+}
+
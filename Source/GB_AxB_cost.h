@@ -0,0 +1,83 @@
+//------------------------------------------------------------------------------
+// GB_AxB_cost.h: cost model for selecting the method for C=A*B
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// When enabled with GxB_set (GxB_AxB_COST_MODEL, true), GB_AxB_meta and
+// GB_AxB_saxpy_sparsity estimate the run time of each candidate method for
+// C=A*B (dot2, saxpy3 with a sparse or bitmap C, outer product, and the
+// explicit transpose that some of them need), and select the fastest one when
+// the method is not specified by the descriptor.  Otherwise, the fixed
+// heuristics in GB_AxB_dot2_control, GB_AxB_outer_control, and
+// GB_AxB_saxpy_sparsity are used.
+
+// Each estimate is a count of basic operations of a few kinds, each weighted
+// by a coefficient: the time one thread takes for one such operation on this
+// host.  The coefficients are measured by GB_AxB_cost_calibrate when the
+// cost model is enabled.  The estimate is then divided by the number of
+// threads that will be used.
+
+#ifndef GB_AXB_COST_H
+#define GB_AXB_COST_H
+#include "GB.h"
+
+// kinds of basic operations, and the indices of their coefficients
+#define GB_AXB_COST_STREAM      0   // read or write an array in order
+#define GB_AXB_COST_GATHER      1   // read from a dense vector at random
+#define GB_AXB_COST_SCATTER     2   // update a dense workspace at random
+#define GB_AXB_COST_HASH        3   // update a hash table at random
+#define GB_AXB_COST_TRANSPOSE   4   // move one entry in a bucket transpose
+#define GB_AXB_COST_BUILD       5   // sort and assemble one tuple
+#define GB_AXB_COST_N           6   // # of coefficients
+
+void GB_AxB_cost_calibrate (void) ;     // measure the coefficients
+
+double GB_AxB_cost_transpose        // time to compute A'
+(
+    const GrB_Matrix A,
+    GB_Context Context
+) ;
+
+double GB_AxB_cost_dot2             // time to compute C=A'*B via dot2
+(
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    GB_Context Context
+) ;
+
+double GB_AxB_cost_dot3             // time to compute C<M>=A'*B via dot3
+(
+    const GrB_Matrix M,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    GB_Context Context
+) ;
+
+double GB_AxB_cost_saxpy            // time to compute C=A*B via saxpy
+(
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_transpose,         // if true, A' is transposed first
+    const bool B_transpose,         // if true, B' is transposed first
+    const int C_sparsity,           // GxB_BITMAP, GxB_SPARSE, or 0 if either
+    GB_Context Context
+) ;
+
+double GB_AxB_cost_outer            // time to compute C=A*B' via outer
+(
+    const double flops,             // # of tuples A(i,k)*B(j,k)
+    GB_Context Context
+) ;
+
+double GB_AxB_cost_scale            // time for C=A*D or C=D*B
+(
+    const GrB_Matrix A,             // the matrix that is not diagonal
+    GB_Context Context
+) ;
+
+#endif
+
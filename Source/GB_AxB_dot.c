@@ -29,8 +29,10 @@
 // input.  The mask M is optional.
 
 // If C is computed in-place, Chandle is ignored, and the result is computed in
-// C_in instead.  This case requires the accum operator to match the monoid of
-// the semiring.
+// C_in instead.  For GB_AxB_dot4 (C dense), this case requires the accum
+// operator to match the monoid of the semiring.  GB_AxB_dot2 can also compute
+// a bitmap or full C_in in-place, if accum matches the monoid, or if accum is
+// NULL and the prior content of C_in is not needed (see GB_AxB_meta).
 
 // The semiring defines C=A*B.  flipxy modifies how the semiring multiply
 // operator is applied.  If false, then fmult(aik,bkj) is computed.  If true,
@@ -47,6 +49,7 @@ GrB_Info GB_AxB_dot                 // dot product (multiple methods)
 (
     GrB_Matrix *Chandle,            // output matrix, NULL on input
     GrB_Matrix C_in,                // input/output matrix, if done in-place
+    const GrB_BinaryOp accum,       // accum for C_in+=A*B, or NULL if C_in=A*B
     GrB_Matrix M,                   // optional mask matrix
     const bool Mask_comp,           // if true, use !M
     const bool Mask_struct,         // if true, use the only structure of M
@@ -104,7 +107,12 @@ GrB_Info GB_AxB_dot                 // dot product (multiple methods)
     if (A->vlen == 0)
     { 
         // no work to do; C is an empty matrix, normally hypersparse
-        if (C_in != NULL) return (GrB_SUCCESS) ;
+        if (C_in != NULL && accum != NULL)
+        { 
+            // C_in += 0 leaves C_in unchanged
+            (*done_in_place) = true ;
+            return (GrB_SUCCESS) ;
+        }
         return (GB_new (Chandle, // auto sparsity, new header
             semiring->add->op->ztype, A->vdim, B->vdim, GB_Ap_calloc, true,
             GxB_AUTO_SPARSITY, GB_Global_hyper_switch_get ( ), 1, Context)) ;
@@ -162,12 +170,19 @@ GrB_Info GB_AxB_dot                 // dot product (multiple methods)
     }
 
     //--------------------------------------------------------------------------
-    // general case: C<M>=A'*B, C<!M>=A'B*, or C=A'*B, not in-place
+    // general case: C<M>=A'*B, C<!M>=A'B*, or C=A'*B, possibly in-place
     //--------------------------------------------------------------------------
 
+    // dot2 can compute C_in in-place if it is bitmap or full, and if A and B
+    // are not hypersparse (in which case C is computed as a packed bitmap
+    // matrix and then unpacked into a new sparse/hypersparse matrix)
+    bool dot2_in_place = (C_in != NULL)
+        && (GB_IS_BITMAP (C_in) || GB_IS_FULL (C_in))
+        && !GB_IS_HYPERSPARSE (A) && !GB_IS_HYPERSPARSE (B) ;
+
     (*mask_applied) = (M != NULL) ; // mask applied if present
-    (*done_in_place) = false ;      // TODO: allow dot2 to work in-place
-    return (GB_AxB_dot2 (Chandle, M, Mask_comp, Mask_struct, A, B, semiring,
-        flipxy, Context)) ;
+    (*done_in_place) = dot2_in_place ;
+    return (GB_AxB_dot2 (Chandle, (dot2_in_place) ? C_in : NULL, accum,
+        M, Mask_comp, Mask_struct, A, B, semiring, flipxy, Context)) ;
 }
 
@@ -11,12 +11,17 @@
 // hyper if A or B are hypersparse.  The C<M>=A'*B dot product when C is sparse
 // is computed by GB_AxB_dot3.  This method handles the case when C is bitmap.
 
-// TODO:  this is slower than it could be if A and B are both bitmap, when
-// A->vlen is large, and likely if A and B are both either bitmap or full.
-// This is because the inner loop is a simple full/bitmap dot product, across
-// the entire input vectors.  No tiling is used, so cache performance is not
-// as good as it could be.  For large problems, C=(A')*B is faster with
-// the saxpy3 method, as compared to this method with C=A'*B.
+// If C_in is present, C is computed in-place: C_in<#M>+=A'*B if accum is
+// present (and matches the monoid), or C_in=A'*B if accum is NULL.  C_in must
+// be bitmap or full, its type must match the monoid, and A and B must not be
+// hypersparse.  The prior entries of C_in are accumulated into the result by
+// the kernels, so no temporary matrix is allocated.
+
+// If A and B are both bitmap or full and A->vlen is large, a full-length dot
+// product for each C(i,j) has poor cache performance, since A(:,i) is reloaded
+// from memory for each j.  In this case, with no mask, the dot products are
+// tiled (see Template/GB_AxB_dot2_tiled_template.c), so that a panel of A' is
+// reused from cache for many vectors of B.
 
 #include "GB_mxm.h"
 #include "GB_subref.h"
@@ -38,7 +43,9 @@
 GB_PUBLIC   // accessed by the MATLAB tests in GraphBLAS/Test only
 GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
 (
-    GrB_Matrix *Chandle,            // output matrix
+    GrB_Matrix *Chandle,            // output matrix, if not done in-place
+    GrB_Matrix C_in,                // input/output matrix, if done in-place
+    const GrB_BinaryOp accum,       // accum for C_in+=A*B, or NULL if C_in=A*B
     const GrB_Matrix M_in,          // mask matrix for C<!M>=A'*B, may be NULL
     const bool Mask_comp,           // if true, use !M
     const bool Mask_struct,         // if true, use the only structure of M
@@ -75,6 +82,13 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
 
     ASSERT_SEMIRING_OK (semiring, "semiring for numeric A'*B", GB0) ;
 
+    ASSERT_MATRIX_OK_OR_NULL (C_in, "C_in for dot2 A'*B", GB0) ;
+    ASSERT (C_in == NULL || GB_IS_BITMAP (C_in) || GB_IS_FULL (C_in)) ;
+    ASSERT (C_in == NULL || C_in->type == semiring->add->op->ztype) ;
+    ASSERT (C_in == NULL ||
+        (!GB_IS_HYPERSPARSE (A_in) && !GB_IS_HYPERSPARSE (B_in))) ;
+    ASSERT (accum == NULL || accum == semiring->add->op) ;
+
     (*Chandle) = NULL ;
     GrB_Matrix M, M2 = NULL ;
     int64_t *GB_RESTRICT A_slice = NULL ;
@@ -251,15 +265,39 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
     // allocate C
     //--------------------------------------------------------------------------
 
-    // if M is sparse/hyper, then calloc C->b; otherwise use malloc
     bool M_is_sparse_or_hyper = (M != NULL) &&
         (GB_IS_SPARSE (M) || GB_IS_HYPERSPARSE (M)) ;
-    GrB_Type ctype = add->op->ztype ;
-    GB_OK (GB_new_bix (Chandle, // bitmap, new header
-        ctype, cvlen, cvdim, GB_Ap_malloc, true,
-        GxB_BITMAP, M_is_sparse_or_hyper, B->hyper_switch, cnvec, cnz, true,
-        Context)) ;
-    GrB_Matrix C = (*Chandle) ;
+    GrB_Matrix C = NULL ;
+
+    if (C_in != NULL)
+    {
+        // use C_in in-place; its entries are kept if accum is present
+        ASSERT (C_in->vlen == cvlen && C_in->vdim == cvdim) ;
+        if (GB_IS_FULL (C_in))
+        { 
+            // all entries of C_in are present; the bitmap is all ones
+            GB_OK (GB_convert_full_to_bitmap (C_in, Context)) ;
+        }
+        C = C_in ;
+        if (accum == NULL)
+        { 
+            // C_in=A'*B: the prior entries of C_in are discarded.  Cb need not
+            // be cleared, since the kernels overwrite all of Cb when C->nvals
+            // is zero on input.
+            C->nvals = 0 ;
+        }
+        GB_PATTERN_CHANGED (C) ;
+    }
+    else
+    { 
+        // if M is sparse/hyper, then calloc C->b; otherwise use malloc
+        GrB_Type ctype = add->op->ztype ;
+        GB_OK (GB_new_bix (Chandle, // bitmap, new header
+            ctype, cvlen, cvdim, GB_Ap_malloc, true,
+            GxB_BITMAP, M_is_sparse_or_hyper, B->hyper_switch, cnvec, cnz,
+            true, Context)) ;
+        C = (*Chandle) ;
+    }
 
 // ttt = omp_get_wtime ( ) - ttt ;
 // GB_Global_timing_add (18, ttt) ;
@@ -271,9 +309,7 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
 
     if (M_is_sparse_or_hyper)
     { 
-        // FUTURE:: could just set Cb [pC] = 2 since Cb has just been calloc'd.
-        // However, in the future, this method might be able to modify C on
-        // input, in which case C->b will not be all zero.
+        // C->b is not all zero if C is computed in-place.
 
         int mthreads = GB_nthreads (GB_NNZ (M) + M->nvec, chunk, nthreads_max) ;
         int mtasks = (mthreads == 1) ? 1 : (8 * mthreads) ;
@@ -293,9 +329,9 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
             mthreads, mtasks, Context) ;
         // the bitmap of C now contains:
         //  Cb (i,j) = 0:   cij not present, mij zero
-        //  Cb (i,j) = 1:   cij present, mij zero           (not used yet)
+        //  Cb (i,j) = 1:   cij present, mij zero           (if in-place)
         //  Cb (i,j) = 2:   cij not present, mij 1
-        //  Cb (i,j) = 3:   cij present, mij 1              (not used yet)
+        //  Cb (i,j) = 3:   cij present, mij 1              (if in-place)
     }
 
     //--------------------------------------------------------------------------
@@ -358,6 +394,18 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
     ASSERT_MATRIX_OK (C, "dot2: C = A'*B output", GB0) ;
     ASSERT (!GB_ZOMBIES (C)) ;
 
+    if (C_in != NULL)
+    {
+        // C_in has been computed in-place
+        if (C->nvals == cnz)
+        { 
+            // all entries of C_in are present; it may become full again
+            GB_bitmap_assign_to_full (C, nthreads_max) ;
+        }
+        ASSERT_MATRIX_OK (C, "dot2: C_in+=A'*B output", GB0) ;
+        return (GrB_SUCCESS) ;
+    }
+
     //--------------------------------------------------------------------------
     // unpack C if A or B are hypersparse
     //--------------------------------------------------------------------------
@@ -449,6 +497,9 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
         C->p = Cp ; Cp = NULL ;
         C->h = Ch ; Ch = NULL ;
         C->i = Ci ; Ci = NULL ;
+        C->p_size = (cvdim+1) * sizeof (int64_t) ;
+        C->h_size = (C->h == NULL) ? 0 : (cvdim * sizeof (int64_t)) ;
+        C->i_size = cnz * sizeof (int64_t) ;
         C->nzombies = cnz - C->nvals ;
         C->vdim = cvdim_final ;
         C->vlen = cvlen_final ;
@@ -459,6 +510,7 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
 
         // free the bitmap
         GB_FREE (C->b) ;
+        C->b_size = 0 ;
 
         // C is now sparse or hypersparse
         ASSERT_MATRIX_OK (C, "dot2: unpacked C", GB0) ;
@@ -18,9 +18,7 @@
 // matrix C passed in from the user (C_in).
 
 // The method is chosen automatically:  a gather/scatter saxpy method
-// (Gustavson), or a dot product method.
-
-// FUTURE:: an outer-product method for C=A*B'
+// (Gustavson), a dot product method, or an outer product method for C=A*B'.
 
 #define GB_FREE_ALL             \
 {                               \
@@ -115,33 +113,46 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     //      the monoid of the semiring.  C_replace must be false, or
     //      effectively false.
     //
-    //      TODO:  if C is full and accum is not present, it can be quickly
-    //      converted to bitmap and then done in-place.
+    //      If C is full and accum is not present, it can be converted to
+    //      bitmap and then done in-place by GB_AxB_saxpy (see below).
+    //
+    // If C is bitmap or full:
     //
-    // If C is bitmap:
+    //      C can be computed in-place by GB_AxB_saxpy or GB_AxB_dot2 if its
+    //      type is the same as the semiring monoid, and either:
     //
-    //      C can be computed in-place if its type is the same as the semiring
-    //      monoid.  The accum must not be present, or if present it must match
-    //      the semiring monoid.  C_replace can be true or false.
+    //      the accum is present and matches the monoid, and C_replace is false
+    //      or effectively false (C<#M>+=A*B), or
     //
-    //      TODO: modify GB_AxB_dot2 so it can compute C in-place,
-    //      or add a bitmap dot product method.  Also modify GB_AxB_saxpy
-    //      so it can compute a C bitmap in-place.
+    //      the accum is not present and the prior content of C is not needed:
+    //      there is no mask, or C has no entries (C=A*B).
     //
-    // In both cases, C must not be transposed, nor can it be aliased with any
+    //      A full C is converted to bitmap first.  For GB_AxB_dot, a full C
+    //      is handled by the dense case above, which requires the accum.
+    //
+    // In all cases, C must not be transposed, nor can it be aliased with any
     // input matrix.
 
-    bool can_do_in_place = false ;
+    bool can_do_in_place = false ;      // for GB_AxB_dot
+    bool saxpy_in_place = false ;       // for GB_AxB_saxpy
 
     if (C_in != NULL)
     { 
+        if (GB_IS_BITMAP (C_in) || GB_IS_FULL (C_in))
+        { 
+            // check if C can be computed in-place as a bitmap matrix
+            ASSERT (!GB_PENDING (C_in)) ; // no pending tuples in bitmap/full
+            ASSERT (!GB_ZOMBIES (C_in)) ; // bitmap/full never has zombies
+            bool type_ok = (C_in->type == semiring->add->op->ztype) ;
+            saxpy_in_place = type_ok &&
+                ((accum == semiring->add->op && (M_in == NULL || !C_replace))
+              || (accum == NULL && (M_in == NULL || GB_NNZ (C_in) == 0))) ;
+        }
+
         if (GB_IS_BITMAP (C_in))
-        {
+        { 
             // C is bitmap
-            ASSERT (!GB_PENDING (C_in)) ; // no pending tuples in bitmap
-            ASSERT (!GB_ZOMBIES (C_in)) ; // bitmap never has zombies
-            can_do_in_place = (C_in->type == semiring->add->op->ztype)
-                && ((accum == NULL) || (accum == semiring->add->op)) ;
+            can_do_in_place = saxpy_in_place ;
         }
         else if (accum != NULL)
         { 
@@ -287,21 +298,21 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     // explicitly transpose the mask
     //--------------------------------------------------------------------------
 
-    // all uses of GB_transpose below:
-    // transpose: typecast, no op, not in-place
+    // all uses of GB_transpose_cast below:
+    // transpose: typecast, no op, not in-place.  If the values of the
+    // transposed matrix are not used, only its pattern is computed.
 
     GrB_Matrix M ;
     bool M_transposed ;
 
-    // TODO: if Mask_struct is true, do not create values of MT = M'
-
     if (M_transpose && M_in != NULL)
     { 
         // MT = M_in' also typecasting to boolean.  It is not freed here
-        // unless an error occurs, but is returned to the caller.
+        // unless an error occurs, but is returned to the caller.  If the
+        // mask is structural, the values of MT are not computed.
         GBURBLE ("(M transpose) ") ;
-        GB_OK (GB_transpose (&MT, GrB_BOOL, C_is_csc, M_in,
-            NULL, NULL, NULL, false, Context)) ;
+        GB_OK (GB_transpose_cast (&MT, GrB_BOOL, C_is_csc, M_in, Mask_struct,
+            Context)) ;
         M = MT ;
         M_transposed = true ;
     }
@@ -318,15 +329,17 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     // check additional conditions for in-place computation of C
     //--------------------------------------------------------------------------
 
-    if (can_do_in_place)
+    if (can_do_in_place || saxpy_in_place)
     {
         // C cannot be done in-place if it is aliased with any input matrix.
-        // Also cannot compute C in-place if it is to be transposed.
+        // Also cannot compute C in-place if it is to be transposed, or if its
+        // content is shallow (see GB_unshallow).
         bool C_aliased = GB_aliased (C_in, M) || GB_aliased (C_in, A) ||
             GB_aliased (C_in, B) ;
-        if (C_transpose || C_aliased)
+        if (C_transpose || C_aliased || GB_is_shallow (C_in))
         { 
             can_do_in_place = false ;
+            saxpy_in_place = false ;
         }
 
         // TODO: A and B can be transposed below, so this check should be
@@ -357,9 +370,8 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     // typecast A and B when transposing them, if needed
     //--------------------------------------------------------------------------
 
-    // TODO: if A is pattern, do not compute values of AT = A'
-    // TODO: if B is pattern, do not compute values of BT = B'
-    // use constant-valued matrices for AT and BT, with type GrB_BOOL.
+    // If the multiply operator does not depend on the values of A (or B),
+    // then only the pattern of AT = A' (or BT = B') is computed.
 
     GB_Opcode opcode = semiring->multiply->opcode  ;
     bool op_is_positional = GB_OPCODE_IS_POSITIONAL (opcode) ;
@@ -412,8 +424,17 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     #define GB_USE_COLSCALE 1
     #define GB_USE_DOT      2
     #define GB_USE_SAXPY    3
+    #define GB_USE_OUTER    4
     int axb_method = GB_USE_SAXPY ;
 
+    // If the cost model is enabled, the run time of the method is predicted
+    // and then measured.  The prediction also selects the method for A'*B and
+    // A*B', if not selected by the descriptor.
+    bool cost_model = GB_Global_axb_cost_model_get ( ) ;
+    double t_predicted = 0, t_outer = 0 ;
+    double t_start = (cost_model) ? GB_OPENMP_GET_WTIME : 0 ;
+    #define GB_PREDICT(t) { if (cost_model) t_predicted += (t) ; }
+
     if (atrans)
     {
 
@@ -430,8 +451,8 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
             // with the swap_rule as defined above, this case will never occur.
             // The code is left here in case swap_rule changes in the future.
             ASSERT (GB_DEAD_CODE) ;
-            GB_OK (GB_transpose (&BT, btype_required, true, B,
-                NULL, NULL, NULL, false, Context)) ;
+            GB_OK (GB_transpose_cast (&BT, btype_required, true, B,
+                B_is_pattern, Context)) ;
             B = BT ;
         }
 
@@ -478,6 +499,18 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
                 // C<M>=A'*B uses the masked dot product method (dot3)
                 axb_method = GB_USE_DOT ;
             }
+            else if (cost_model)
+            {
+                // C=A'*B or C<!M>=A'*B: use dot2 if faster than saxpy
+                double t_dot = GB_AxB_cost_dot2 (A, B, Context) ;
+                double t_saxpy = GB_AxB_cost_saxpy (A, B, true, false, 0,
+                    Context) ;
+                GBURBLE ("(cost: dot %g saxpy %g) ", t_dot, t_saxpy) ;
+                if (t_dot < t_saxpy)
+                { 
+                    axb_method = GB_USE_DOT ;
+                }
+            }
             else if (GB_AxB_dot2_control (A, B, Context))
             {
                 // C=A'*B or C<!M>=A'B* can efficiently use the dot2 method
@@ -498,8 +531,9 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         if (axb_method == GB_USE_COLSCALE || axb_method == GB_USE_SAXPY)
         {
             // AT = A'
-            GB_OK (GB_transpose (&AT, atype_required, true, A,
-                NULL, NULL, NULL, false, Context)) ;
+            GB_PREDICT (GB_AxB_cost_transpose (A, Context)) ;
+            GB_OK (GB_transpose_cast (&AT, atype_required, true, A,
+                A_is_pattern, Context)) ;
             // do not use colscale if AT is now bitmap
             if (GB_IS_BITMAP (AT))
             { 
@@ -516,6 +550,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
             case GB_USE_ROWSCALE : 
                 // C = D*B using rowscale
                 GBURBLE ("C%s=A'*B, rowscale ", M_str) ;
+                GB_PREDICT (GB_AxB_cost_scale (B, Context)) ;
                 GB_OK (GB_AxB_rowscale (Chandle, A, B, semiring, flipxy,
                     Context)) ;
                 break ;
@@ -523,6 +558,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
             case GB_USE_COLSCALE : 
                 // C = A'*D using colscale
                 GBURBLE ("C%s=A'*B, colscale (transposed %s) ", M_str, A_str) ;
+                GB_PREDICT (GB_AxB_cost_scale (AT, Context)) ;
                 GB_OK (GB_AxB_colscale (Chandle, AT, B, semiring, flipxy,
                     Context)) ;
                 break ;
@@ -531,16 +567,22 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
                 // C<M>=A'*B via dot, or C_in<M>+=A'*B if in-place
                 GBURBLE ("C%s=A'*B, %sdot_product ", M_str,
                     (M != NULL && !Mask_comp) ? "masked_" : "") ;
+                GB_PREDICT ((M != NULL && !Mask_comp) ?
+                    GB_AxB_cost_dot3 (M, A, B, Context) :
+                    GB_AxB_cost_dot2 (A, B, Context)) ;
                 GB_OK (GB_AxB_dot (Chandle, (can_do_in_place) ? C_in : NULL,
-                    M, Mask_comp, Mask_struct, A, B, semiring, flipxy,
+                    accum, M, Mask_comp, Mask_struct, A, B, semiring, flipxy,
                     mask_applied, done_in_place, Context)) ;
                 break ;
 
             default : 
                 // C = A'*B via saxpy: Gustavson + Hash method
                 GBURBLE ("C%s=A'*B, saxpy (transposed %s) ", M_str, A_str) ;
-                GB_OK (GB_AxB_saxpy (Chandle, M, Mask_comp, Mask_struct,
-                    AT, B, semiring, flipxy, mask_applied, AxB_method, do_sort,
+                GB_PREDICT (GB_AxB_cost_saxpy (AT, B, false, false, 0,
+                    Context)) ;
+                GB_OK (GB_AxB_saxpy (Chandle, (saxpy_in_place) ? C_in : NULL,
+                    accum, M, Mask_comp, Mask_struct, AT, B, semiring, flipxy,
+                    mask_applied, done_in_place, AxB_method, do_sort,
                     Context)) ;
                 break ;
         }
@@ -572,16 +614,23 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
             // only use the dot product method if explicitly requested
             axb_method = GB_USE_DOT ;
         }
+        else if (GB_AxB_outer_control (M, A, B, semiring, AxB_method,
+            &t_outer, Context))
+        { 
+            // C=A*B' via outer products, without forming B'
+            axb_method = GB_USE_OUTER ;
+        }
 
         //----------------------------------------------------------------------
         // BT = B'
         //----------------------------------------------------------------------
 
-        if (axb_method != GB_USE_COLSCALE)
+        if (axb_method != GB_USE_COLSCALE && axb_method != GB_USE_OUTER)
         {
             // BT = B'
-            GB_OK (GB_transpose (&BT, btype_required, true, B,
-                NULL, NULL, NULL, false, Context)) ;
+            GB_PREDICT (GB_AxB_cost_transpose (B, Context)) ;
+            GB_OK (GB_transpose_cast (&BT, btype_required, true, B,
+                B_is_pattern, Context)) ;
             // do not use rowscale if BT is now bitmap
             if (axb_method == GB_USE_ROWSCALE && GB_IS_BITMAP (BT))
             { 
@@ -598,6 +647,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
             case GB_USE_COLSCALE : 
                 // C = A*D
                 GBURBLE ("C%s=A*B', colscale ", M_str) ;
+                GB_PREDICT (GB_AxB_cost_scale (A, Context)) ;
                 GB_OK (GB_AxB_colscale (Chandle, A, B, semiring, flipxy,
                     Context)) ;
                 break ;
@@ -605,6 +655,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
             case GB_USE_ROWSCALE : 
                 // C = D*B'
                 GBURBLE ("C%s=A*B', rowscale (transposed %s) ", M_str, B_str) ;
+                GB_PREDICT (GB_AxB_cost_scale (BT, Context)) ;
                 GB_OK (GB_AxB_rowscale (Chandle, A, BT, semiring, flipxy,
                     Context)) ;
                 break ;
@@ -613,18 +664,33 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
                 // C<M>=A*B' via dot product, or C_in<M>+=A*B' if in-place
                 GBURBLE ("C%s=A*B', dot_product (transposed %s) "
                     "(transposed %s) ", M_str, A_str, B_str) ;
-                GB_OK (GB_transpose (&AT, atype_required, true, A,
-                    NULL, NULL, NULL, false, Context)) ;
+                GB_PREDICT (GB_AxB_cost_transpose (A, Context)) ;
+                GB_OK (GB_transpose_cast (&AT, atype_required, true, A,
+                    A_is_pattern, Context)) ;
+                GB_PREDICT ((M != NULL && !Mask_comp) ?
+                    GB_AxB_cost_dot3 (M, AT, BT, Context) :
+                    GB_AxB_cost_dot2 (AT, BT, Context)) ;
                 GB_OK (GB_AxB_dot (Chandle, (can_do_in_place) ? C_in : NULL,
-                    M, Mask_comp, Mask_struct, AT, BT, semiring, flipxy,
+                    accum, M, Mask_comp, Mask_struct, AT, BT, semiring, flipxy,
                     mask_applied, done_in_place, Context)) ;
                 break ;
 
+            case GB_USE_OUTER : 
+                // C = A*B' via outer products; the mask is applied later
+                GBURBLE ("C%s=A*B', outer_product ", M_str) ;
+                GB_PREDICT (t_outer) ;
+                GB_OK (GB_AxB_outer (Chandle, A, B, semiring, flipxy,
+                    Context)) ;
+                break ;
+
             default : 
                 // C = A*B' via saxpy: Gustavson + Hash method
                 GBURBLE ("C%s=A*B', saxpy (transposed %s) ", M_str, B_str) ;
-                GB_OK (GB_AxB_saxpy (Chandle, M, Mask_comp, Mask_struct,
-                    A, BT, semiring, flipxy, mask_applied, AxB_method, do_sort,
+                GB_PREDICT (GB_AxB_cost_saxpy (A, BT, false, false, 0,
+                    Context)) ;
+                GB_OK (GB_AxB_saxpy (Chandle, (saxpy_in_place) ? C_in : NULL,
+                    accum, M, Mask_comp, Mask_struct, A, BT, semiring, flipxy,
+                    mask_applied, done_in_place, AxB_method, do_sort,
                     Context)) ;
                 break ;
         }
@@ -643,6 +709,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         { 
             // C = A*D, column scale
             GBURBLE ("C%s=A*B, colscale ", M_str) ;
+            GB_PREDICT (GB_AxB_cost_scale (A, Context)) ;
             GB_OK (GB_AxB_colscale (Chandle, A, B, semiring, flipxy, Context)) ;
         }
         else if (allow_scale && M == NULL
@@ -651,6 +718,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         { 
             // C = D*B, row scale
             GBURBLE ("C%s=A*B, rowscale ", M_str) ;
+            GB_PREDICT (GB_AxB_cost_scale (B, Context)) ;
             GB_OK (GB_AxB_rowscale (Chandle, A, B, semiring, flipxy, Context)) ;
         }
         else if (AxB_method == GxB_AxB_DOT)
@@ -658,23 +726,41 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
             // C<M>=A*B via dot product, or C_in<M>+=A*B if in-place.
             // only use the dot product method if explicitly requested
             GBURBLE ("C%s=A*B', dot_product (transposed %s) ", M_str, A_str) ;
-            GB_OK (GB_transpose (&AT, atype_required, true, A,
-                NULL, NULL, NULL, false, Context)) ;
+            GB_PREDICT (GB_AxB_cost_transpose (A, Context)) ;
+            GB_OK (GB_transpose_cast (&AT, atype_required, true, A,
+                A_is_pattern, Context)) ;
+            GB_PREDICT ((M != NULL && !Mask_comp) ?
+                GB_AxB_cost_dot3 (M, AT, B, Context) :
+                GB_AxB_cost_dot2 (AT, B, Context)) ;
             GB_OK (GB_AxB_dot (Chandle, (can_do_in_place) ? C_in : NULL,
-                M, Mask_comp, Mask_struct, AT, B, semiring, flipxy,
+                accum, M, Mask_comp, Mask_struct, AT, B, semiring, flipxy,
                 mask_applied, done_in_place, Context)) ;
         }
         else
         { 
             // C = A*B via saxpy: Gustavson + Hash method
             GBURBLE ("C%s=A*B, saxpy ", M_str) ;
-            GB_OK (GB_AxB_saxpy (Chandle, M, Mask_comp, Mask_struct,
-                A, B, semiring, flipxy, mask_applied, AxB_method, do_sort,
+            GB_PREDICT (GB_AxB_cost_saxpy (A, B, false, false, 0, Context)) ;
+            GB_OK (GB_AxB_saxpy (Chandle, (saxpy_in_place) ? C_in : NULL,
+                accum, M, Mask_comp, Mask_struct, A, B, semiring, flipxy,
+                mask_applied, done_in_place, AxB_method, do_sort,
                 Context)) ;
         }
     }
 
     if (M_transposed) { GBURBLE ("(M transposed) ") ; }
+
+    //--------------------------------------------------------------------------
+    // record the predicted and actual time
+    //--------------------------------------------------------------------------
+
+    if (cost_model)
+    { 
+        double t_actual = GB_OPENMP_GET_WTIME - t_start ;
+        GB_Global_axb_cost_telemetry_set (t_predicted, t_actual) ;
+        GBURBLE ("(cost model: predicted %g sec, actual %g sec) ",
+            t_predicted, t_actual) ;
+    }
     if ((M != NULL) && !(*mask_applied)) { GBURBLE ("(mask later) ") ; }
 
     //--------------------------------------------------------------------------
@@ -0,0 +1,259 @@
+//------------------------------------------------------------------------------
+// GB_AxB_outer: compute C=A*B' via outer products
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C = A*B' is computed as a sum of rank-1 outer products, C = sum_k
+// A(:,k)*B(:,k)', without forming B'.  All three matrices are treated as if
+// they were CSC; this method is CSR/CSC agnostic.  For each k, every pair of
+// entries A(i,k) and B(j,k) contributes one tuple (i,j,t) with t =
+// A(i,k)*B(j,k).  The tuples are then assembled into C by GB_builder, with
+// the monoid of the semiring as the dup operator, so that tuples with the same
+// (i,j) are summed.
+
+// This method is used by GB_AxB_meta for C=A*B' if selected by
+// GB_AxB_outer_control, either because the total work is small compared with
+// the cost of transposing B, or because the user requested it via
+// GxB_AxB_METHOD = GxB_AxB_OUTER.  The mask is not applied; GB_mxm applies it
+// later.
+
+// A and B must be sparse or hypersparse, and they can be jumbled.  The
+// multiply operator must have a function pointer (positional operators, and
+// the implicit FIRST operator used by GB_reduce_to_vector, are not handled).
+// The output matrix C is hypersparse on output; GB_accum_mask conforms it to
+// its final sparsity structure.
+
+#include "GB_mxm.h"
+#include "GB_build.h"
+
+#define GB_FREE_WORK                \
+{                                   \
+    GB_FREE (Work) ;                \
+    GB_FREE (I_work) ;              \
+    GB_FREE (J_work) ;              \
+    GB_FREE (S_work) ;              \
+}
+
+GrB_Info GB_AxB_outer               // C=A*B', outer product method
+(
+    GrB_Matrix *Chandle,            // output matrix
+    const GrB_Matrix A,             // input matrix
+    const GrB_Matrix B,             // input matrix
+    const GrB_Semiring semiring,    // semiring that defines C=A*B'
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (Chandle != NULL) ;
+    ASSERT_MATRIX_OK (A, "A for outer A*B'", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for outer A*B'", GB0) ;
+    ASSERT (!GB_ZOMBIES (A)) ;
+    ASSERT (GB_JUMBLED_OK (A)) ;
+    ASSERT (!GB_PENDING (A)) ;
+    ASSERT (!GB_ZOMBIES (B)) ;
+    ASSERT (GB_JUMBLED_OK (B)) ;
+    ASSERT (!GB_PENDING (B)) ;
+    ASSERT (!GB_IS_BITMAP (A) && !GB_IS_FULL (A)) ;
+    ASSERT (!GB_IS_BITMAP (B) && !GB_IS_FULL (B)) ;
+    ASSERT (A->vdim == B->vdim) ;
+    ASSERT_SEMIRING_OK (semiring, "semiring for outer A*B'", GB0) ;
+    ASSERT (semiring->multiply->function != NULL) ;
+
+    (*Chandle) = NULL ;
+    int64_t *GB_RESTRICT Work = NULL ;
+    int64_t *I_work = NULL ;
+    int64_t *J_work = NULL ;
+    GB_void *S_work = NULL ;
+
+    GBURBLE ("(outer %s=%s*%s') ",
+        GB_sparsity_char (GxB_HYPERSPARSE),
+        GB_sparsity_char_matrix (A),
+        GB_sparsity_char_matrix (B)) ;
+
+    //--------------------------------------------------------------------------
+    // get the semiring operators
+    //--------------------------------------------------------------------------
+
+    GrB_BinaryOp mult = semiring->multiply ;
+    GrB_Monoid add = semiring->add ;
+    ASSERT (mult->ztype == add->op->ztype) ;
+    GrB_Type ctype = add->op->ztype ;
+    GxB_binary_function fmult = mult->function ;
+
+    bool A_is_pattern, B_is_pattern ;
+    GB_AxB_pattern (&A_is_pattern, &B_is_pattern, flipxy, mult->opcode) ;
+
+    size_t csize = ctype->size ;
+    size_t asize = A_is_pattern ? 0 : A->type->size ;
+    size_t bsize = B_is_pattern ? 0 : B->type->size ;
+
+    // flipxy false: aik = (xtype) A(i,k) and bjk = (ytype) B(j,k)
+    // flipxy true:  aik = (ytype) A(i,k) and bjk = (xtype) B(j,k)
+    size_t aik_size = flipxy ? mult->ytype->size : mult->xtype->size ;
+    size_t bjk_size = flipxy ? mult->xtype->size : mult->ytype->size ;
+    GB_cast_function cast_A = A_is_pattern ? NULL : GB_cast_factory
+        ((flipxy ? mult->ytype : mult->xtype)->code, A->type->code) ;
+    GB_cast_function cast_B = B_is_pattern ? NULL : GB_cast_factory
+        ((flipxy ? mult->xtype : mult->ytype)->code, B->type->code) ;
+
+    //--------------------------------------------------------------------------
+    // get A and B
+    //--------------------------------------------------------------------------
+
+    const int64_t *GB_RESTRICT Ap = A->p ;
+    const int64_t *GB_RESTRICT Ah = A->h ;
+    const int64_t *GB_RESTRICT Ai = A->i ;
+    const GB_void *GB_RESTRICT Ax = (GB_void *) A->x ;
+    const int64_t anvec = A->nvec ;
+
+    const int64_t *GB_RESTRICT Bp = B->p ;
+    const int64_t *GB_RESTRICT Bh = B->h ;
+    const int64_t *GB_RESTRICT Bi = B->i ;
+    const GB_void *GB_RESTRICT Bx = (GB_void *) B->x ;
+    const int64_t bnvec = B->nvec ;
+    const int64_t bvlen = B->vlen ;
+    const bool B_is_hyper = GB_IS_HYPERSPARSE (B) ;
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads to use
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (GB_NNZ (A) + GB_NNZ (B) + anvec, chunk,
+        nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // count the tuples for each outer product A(:,k)*B(:,k)'
+    //--------------------------------------------------------------------------
+
+    Work = GB_MALLOC (anvec + 1, int64_t) ;
+    if (Work == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    int64_t kA ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (kA = 0 ; kA < anvec ; kA++)
+    {
+        const int64_t k = GBH (Ah, kA) ;
+        int64_t pleft = 0, pB_start, pB_end ;
+        GB_lookup (B_is_hyper, Bh, Bp, bvlen, &pleft, bnvec-1, k,
+            &pB_start, &pB_end) ;
+        Work [kA] = (Ap [kA+1] - Ap [kA]) * (pB_end - pB_start) ;
+    }
+
+    int64_t e ;
+    GB_cumsum (Work, anvec, NULL, nthreads) ;
+    e = Work [anvec] ;
+
+    //--------------------------------------------------------------------------
+    // allocate the tuples
+    //--------------------------------------------------------------------------
+
+    I_work = GB_MALLOC (GB_IMAX (e, 1), int64_t) ;
+    J_work = GB_MALLOC (GB_IMAX (e, 1), int64_t) ;
+    S_work = GB_MALLOC (GB_IMAX (e, 1) * csize, GB_void) ;
+    if (I_work == NULL || J_work == NULL || S_work == NULL)
+    {
+        // out of memory
+        GB_FREE_WORK ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the tuples of each outer product
+    //--------------------------------------------------------------------------
+
+    int work_nthreads = GB_nthreads (e, chunk, nthreads_max) ;
+
+    #pragma omp parallel for num_threads(work_nthreads) schedule(dynamic,1)
+    for (kA = 0 ; kA < anvec ; kA++)
+    {
+        const int64_t k = GBH (Ah, kA) ;
+        int64_t pleft = 0, pB_start, pB_end ;
+        GB_lookup (B_is_hyper, Bh, Bp, bvlen, &pleft, bnvec-1, k,
+            &pB_start, &pB_end) ;
+        const int64_t pA_start = Ap [kA] ;
+        const int64_t pA_end = Ap [kA+1] ;
+        int64_t t = Work [kA] ;
+        GB_void aik [GB_VLA(aik_size)] ;
+        GB_void bjk [GB_VLA(bjk_size)] ;
+        for (int64_t pB = pB_start ; pB < pB_end ; pB++)
+        {
+            // bjk = B(j,k)
+            const int64_t j = Bi [pB] ;
+            if (!B_is_pattern) cast_B (bjk, Bx +(pB*bsize), bsize) ;
+            for (int64_t pA = pA_start ; pA < pA_end ; pA++, t++)
+            {
+                // aik = A(i,k)
+                if (!A_is_pattern) cast_A (aik, Ax +(pA*asize), asize) ;
+                // tuple (i,j,aik*bjk)
+                I_work [t] = Ai [pA] ;
+                J_work [t] = j ;
+                if (flipxy)
+                {
+                    fmult (S_work +(t*csize), bjk, aik) ;
+                }
+                else
+                {
+                    fmult (S_work +(t*csize), aik, bjk) ;
+                }
+            }
+        }
+    }
+
+    GB_FREE (Work) ;
+
+    //--------------------------------------------------------------------------
+    // C = sum of the tuples, via the monoid
+    //--------------------------------------------------------------------------
+
+    // GB_builder transplants or frees I_work, J_work, and S_work
+    info = GB_builder (
+        Chandle,            // create C
+        ctype,              // C->type
+        A->vlen,            // C->vlen
+        bvlen,              // C->vdim
+        true,               // C is CSC, with respect to A and B
+        &I_work,            // row indices, freed on output
+        &J_work,            // column indices, freed on output
+        &S_work,            // values, freed on output
+        false,              // tuples are not sorted
+        false,              // tuples can have duplicates
+        GB_IMAX (e, 1),     // size of I_work, J_work, and S_work
+        true,               // C is a GrB_Matrix
+        NULL, NULL, NULL,   // original I,J,S input tuples not used
+        e,                  // # of tuples
+        add->op,            // sum duplicates with the monoid
+        ctype->code,        // type of S_work
+        Context) ;
+
+    GB_FREE_WORK ;
+    if (info != GrB_SUCCESS)
+    {
+        // out of memory
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (*Chandle, "outer: C = A*B' output", GB0) ;
+    ASSERT (!GB_ZOMBIES (*Chandle)) ;
+    ASSERT (!GB_JUMBLED (*Chandle)) ;
+    ASSERT (!GB_PENDING (*Chandle)) ;
+    return (GrB_SUCCESS) ;
+}
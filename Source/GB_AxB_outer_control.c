@@ -0,0 +1,112 @@
+//------------------------------------------------------------------------------
+// GB_AxB_outer_control.c: determine when to use GB_AxB_outer
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C<M>=A*B' can be computed by GB_AxB_outer without forming B', or by
+// transposing B and then using saxpy3.  The outer product method assembles
+// one tuple for each multiply, so it is only fast when the total work is small
+// compared with the cost of transposing B.  This is typical when B has many
+// more rows than the work in the product, or when A and B are tall and skinny
+// with few entries in each column (a low-rank update, C += U*V').  If the cost
+// model is enabled (see GB_AxB_cost.h), the estimated time of each method is
+// compared instead.
+
+#include "GB_mxm.h"
+
+bool GB_AxB_outer_control   // true: use outer, false: use another method
+(
+    const GrB_Matrix M,             // mask matrix, may be NULL
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const GrB_Semiring semiring,
+    const GrB_Desc_Value AxB_method,
+    double *t_outer,                // estimated time of GB_AxB_outer, if known
+    GB_Context Context
+)
+{
+
+    (*t_outer) = 0 ;
+
+    //--------------------------------------------------------------------------
+    // check if the outer product method can be used
+    //--------------------------------------------------------------------------
+
+    if (semiring->multiply->function == NULL
+        || GB_IS_BITMAP (A) || GB_IS_FULL (A)
+        || GB_IS_BITMAP (B) || GB_IS_FULL (B))
+    {
+        // positional operators, the implicit FIRST operator of
+        // GB_reduce_to_vector, and bitmap/full matrices are not handled
+        return (false) ;
+    }
+
+    if (AxB_method == GxB_AxB_OUTER)
+    {
+        // the user has requested the outer product method
+        return (true) ;
+    }
+
+    if (AxB_method != GxB_DEFAULT || M != NULL)
+    {
+        // another method has been requested, or the mask is present and
+        // can be exploited by saxpy3
+        return (false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // count the work for C=A*B'
+    //--------------------------------------------------------------------------
+
+    const int64_t *GB_RESTRICT Ap = A->p ;
+    const int64_t *GB_RESTRICT Ah = A->h ;
+    const int64_t anvec = A->nvec ;
+    const int64_t *GB_RESTRICT Bp = B->p ;
+    const int64_t *GB_RESTRICT Bh = B->h ;
+    const int64_t bnvec = B->nvec ;
+    const bool B_is_hyper = GB_IS_HYPERSPARSE (B) ;
+    double bnz = GB_NNZ (B) ;
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (anvec, chunk, nthreads_max) ;
+
+    double flops = 0 ;
+    int64_t kA ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:flops)
+    for (kA = 0 ; kA < anvec ; kA++)
+    {
+        const int64_t k = GBH (Ah, kA) ;
+        int64_t pleft = 0, pB_start, pB_end ;
+        GB_lookup (B_is_hyper, Bh, Bp, B->vlen, &pleft, bnvec-1, k,
+            &pB_start, &pB_end) ;
+        flops += ((double) (Ap [kA+1] - Ap [kA])) * (pB_end - pB_start) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // use the outer product method if its estimated time is least
+    //--------------------------------------------------------------------------
+
+    if (GB_Global_axb_cost_model_get ( ))
+    {
+        (*t_outer) = GB_AxB_cost_outer (flops, Context) ;
+        double t_saxpy = GB_AxB_cost_saxpy (A, B, false, true, 0, Context) ;
+        GBURBLE ("(cost: outer %g saxpy %g) ", (*t_outer), t_saxpy) ;
+        return ((*t_outer) < t_saxpy) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // use the outer product method if the work is less than nnz(B)
+    //--------------------------------------------------------------------------
+
+    if (flops < bnz)
+    {
+        GBURBLE ("(work %g < nnz(B) %g: outer) ", flops, bnz) ;
+        return (true) ;
+    }
+    return (false) ;
+}
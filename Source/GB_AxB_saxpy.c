@@ -12,15 +12,133 @@
 #include "GB_AxB_saxpy3.h"
 #include "GB_bitmap_AxB_saxpy.h"
 
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy_packed: C=A*B where A is bitmap/full and B is hypersparse
+//------------------------------------------------------------------------------
+
+// C has the same hyperlist as B, and is normally computed by GB_AxB_saxpy3 as
+// a hypersparse matrix.  If A is bitmap or full, each column of C is likely
+// to be dense, and GB_AxB_saxpy3 then does a lot of work to gather its
+// pattern.  Instead, a sparse shallow copy of B is constructed without its
+// hyperlist (as done by GB_AxB_dot2), and the packed C is computed as a
+// bitmap matrix with only B->nvec columns.  C is then converted to sparse and
+// given the hyperlist of B.  The workspace is proportional to the number of
+// vectors in B, not B->vdim.
+
+// Positional multiply operators are not handled, since the column indices of
+// the packed B differ from those of B.
+
+static bool GB_AxB_saxpy_packed_test    // true: use GB_AxB_saxpy_packed
+(
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const GrB_Semiring semiring,
+    GB_Context Context
+)
+{
+    if (!(GB_IS_BITMAP (A) || GB_IS_FULL (A)) || !GB_IS_HYPERSPARSE (B)
+        || GB_OP_IS_POSITIONAL (semiring->multiply))
+    { 
+        return (false) ;
+    }
+    if (GB_Global_axb_cost_model_get ( ))
+    { 
+        // compare the packed bitmap C with the hypersparse C of saxpy3
+        struct GB_Matrix_opaque B_header ;
+        GrB_Matrix B_packed = GB_hyper_pack (&B_header, B) ;
+        return (GB_AxB_cost_saxpy (A, B_packed, false, false, GxB_BITMAP,
+            Context) <
+            GB_AxB_cost_saxpy (A, B_packed, false, false, GxB_SPARSE,
+            Context)) ;
+    }
+    // A bitmap/full matrix times a sparse B normally gives a bitmap C
+    return (true) ;
+}
+
+static GrB_Info GB_AxB_saxpy_packed     // C = A*B, with B packed
+(
+    GrB_Matrix *Chandle,            // output matrix
+    const GrB_Matrix A,             // input matrix A, bitmap or full
+    const GrB_Matrix B,             // input matrix B, hypersparse
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    bool *mask_applied,             // always false on output
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (GB_IS_BITMAP (A) || GB_IS_FULL (A)) ;
+    ASSERT (GB_IS_HYPERSPARSE (B)) ;
+    ASSERT (!GB_OP_IS_POSITIONAL (semiring->multiply)) ;
+
+    //--------------------------------------------------------------------------
+    // C = A*B, with B packed and C bitmap
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    struct GB_Matrix_opaque B_header ;
+    GrB_Matrix B_packed = GB_hyper_pack (&B_header, B) ;
+    bool done_in_place = false ;
+    info = GB_bitmap_AxB_saxpy (Chandle, NULL, NULL, GxB_BITMAP, NULL, false,
+        false, A, B_packed, semiring, flipxy, mask_applied, &done_in_place,
+        Context) ;
+    if (info != GrB_SUCCESS)
+    { 
+        // out of memory
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // unpack C into a hypersparse matrix with the same hyperlist as B
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix C = (*Chandle) ;
+    ASSERT_MATRIX_OK (C, "packed C for saxpy A*B", GB0) ;
+    info = GB_convert_bitmap_to_sparse (C, Context) ;
+    int64_t bnvec = B->nvec ;
+    int64_t *GB_RESTRICT Ch = NULL ;
+    if (info == GrB_SUCCESS)
+    { 
+        Ch = GB_MALLOC (bnvec, int64_t) ;
+    }
+    if (Ch == NULL)
+    { 
+        // out of memory
+        GB_Matrix_free (Chandle) ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (bnvec, chunk, nthreads_max) ;
+    GB_memcpy (Ch, B->h, bnvec * sizeof (int64_t), nthreads) ;
+    C->h = Ch ;
+    C->h_size = bnvec * sizeof (int64_t) ;
+    C->vdim = B->vdim ;
+    C->nvec_nonempty = -1 ;
+    ASSERT (C->nvec == bnvec && C->plen == bnvec) ;
+    ASSERT_MATRIX_OK (C, "unpacked C for saxpy A*B", GB0) ;
+    ASSERT (GB_IS_HYPERSPARSE (C)) ;
+    return (GrB_SUCCESS) ;
+}
+
 //------------------------------------------------------------------------------
 // GB_AxB_saxpy: compute C=A*B, C<M>=A*B, or C<!M>=A*B
 //------------------------------------------------------------------------------
 
-// TODO: pass in user's C and accum, and allow bitmap multiply to work in-place
+// If C_in is not NULL, the caller (GB_AxB_meta) has determined that C_in can
+// be computed in-place (see GB_bitmap_AxB_saxpy for the conditions).  This is
+// done if A or B are bitmap or full, so that the bitmap saxpy method can be
+// used; otherwise C_in is ignored and C is computed as a new matrix.
 
 GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
 (
     GrB_Matrix *Chandle,            // output matrix (if not done in-place)
+    GrB_Matrix C_in,                // input/output matrix, if done in-place
+    const GrB_BinaryOp accum,       // accum for C_in+=A*B, or NULL if C_in=A*B
     const GrB_Matrix M,             // optional mask matrix
     const bool Mask_comp,           // if true, use !M
     const bool Mask_struct,         // if true, use the only structure of M
@@ -29,6 +147,7 @@ GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
     const GrB_Semiring semiring,    // semiring that defines C=A*B
     const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
     bool *mask_applied,             // if true, then mask was applied
+    bool *done_in_place,            // if true, C_in was computed in-place
     const GrB_Desc_Value AxB_method,
     const int do_sort,              // if nonzero, try to sort in saxpy3
     GB_Context Context
@@ -40,6 +159,7 @@ GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
     //--------------------------------------------------------------------------
 
     (*mask_applied) = false ;
+    (*done_in_place) = false ;
     ASSERT (Chandle != NULL) ;
     ASSERT (*Chandle == NULL) ;
 
@@ -67,6 +187,19 @@ GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
 
     int C_sparsity = GB_AxB_saxpy_sparsity (M, Mask_comp, A, B, Context) ;
 
+    if (C_in != NULL && (GB_IS_BITMAP (A) || GB_IS_FULL (A) ||
+                         GB_IS_BITMAP (B) || GB_IS_FULL (B)))
+    { 
+        // C_in is bitmap or full, and is computed in-place by the bitmap
+        // saxpy method, regardless of the sparsity selected above
+        C_sparsity = GxB_BITMAP ;
+    }
+    else
+    { 
+        // C is computed as a new matrix
+        C_in = NULL ;
+    }
+
     if (M == NULL)
     {
         GBURBLE ("(%s=%s*%s) ",
@@ -90,7 +223,20 @@ GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
     // select the method to use
     //--------------------------------------------------------------------------
 
-    if (C_sparsity == GxB_HYPERSPARSE || C_sparsity == GxB_SPARSE)
+    if (C_sparsity == GxB_HYPERSPARSE && M == NULL && C_in == NULL
+        && GB_AxB_saxpy_packed_test (A, B, semiring, Context))
+    { 
+
+        //----------------------------------------------------------------------
+        // C=A*B where A is bitmap/full and B is hypersparse: packed bitmap
+        //----------------------------------------------------------------------
+
+        GBURBLE ("(packed bitmap) ") ;
+        return (GB_AxB_saxpy_packed (Chandle, A, B, semiring, flipxy,
+            mask_applied, Context)) ;
+
+    }
+    else if (C_sparsity == GxB_HYPERSPARSE || C_sparsity == GxB_SPARSE)
     { 
 
         //----------------------------------------------------------------------
@@ -110,8 +256,9 @@ GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
         // C=A*B, C<M>=A*B or C<!M>=A*B: bitmap/full, possibly in-place 
         //----------------------------------------------------------------------
 
-        return (GB_bitmap_AxB_saxpy (Chandle, C_sparsity, M, Mask_comp,
-            Mask_struct, A, B, semiring, flipxy, mask_applied, Context)) ;
+        return (GB_bitmap_AxB_saxpy (Chandle, C_in, accum, C_sparsity, M,
+            Mask_comp, Mask_struct, A, B, semiring, flipxy, mask_applied,
+            done_in_place, Context)) ;
     }
 }
 
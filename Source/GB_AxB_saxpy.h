@@ -19,6 +19,8 @@
 GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
 (
     GrB_Matrix *Chandle,            // output matrix (if not done in-place)
+    GrB_Matrix C_in,                // input/output matrix, if done in-place
+    const GrB_BinaryOp accum,       // accum for C_in+=A*B, or NULL if C_in=A*B
     const GrB_Matrix M,             // optional mask matrix
     const bool Mask_comp,           // if true, use !M
     const bool Mask_struct,         // if true, use the only structure of M
@@ -27,6 +29,7 @@ GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
     const GrB_Semiring semiring,    // semiring that defines C=A*B
     const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
     bool *mask_applied,             // if true, then mask was applied
+    bool *done_in_place,            // if true, C_in was computed in-place
     const GrB_Desc_Value AxB_method,
     const int do_sort,              // if nonzero, try to sort in saxpy3
     GB_Context Context
@@ -97,9 +97,9 @@
 #define GB_FREE_WORK                                                        \
 {                                                                           \
     GB_FREE (TaskList) ;                                                    \
-    GB_FREE (Hi_all) ;                                                      \
-    GB_FREE (Hf_all) ;                                                      \
-    GB_FREE (Hx_all) ;                                                      \
+    GB_FREE_POOL (Hi_all) ;                                                 \
+    GB_FREE_POOL (Hf_all) ;                                                 \
+    GB_FREE_POOL (Hx_all) ;                                                 \
 }
 
 #define GB_FREE_ALL                                                         \
@@ -294,10 +294,30 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     { 
         // Do the flopcount analysis and create a set of well-balanced tasks in
         // the general case.  This may select a single task for a single thread
-        // anyway, but this decision would be based on the analysis.
-        GB_OK (GB_AxB_saxpy3_slice_balanced (C, M, Mask_comp, A, B, AxB_method,
-            &TaskList, &apply_mask, &M_dense_in_place, &ntasks, &nfine,
-            &nthreads, Context)) ;
+        // anyway, but this decision would be based on the analysis.  If the
+        // plan cache is enabled, the tasks may be reused from a prior C=A*B
+        // with the same patterns of M, A, and B.
+        bool plan_cache = GB_Global_plan_cache_get ( ) ;
+        if (plan_cache && GB_AxB_saxpy3_plan_get (M, Mask_comp, A, B,
+            AxB_method, nthreads_max, chunk, &TaskList, &apply_mask,
+            &M_dense_in_place, &ntasks, &nfine, &nthreads))
+        {
+            GB_Global_plan_cache_hits_increment ( ) ;
+            GBURBLE ("(cached plan) ") ;
+        }
+        else
+        {
+            GB_OK (GB_AxB_saxpy3_slice_balanced (C, M, Mask_comp, A, B,
+                AxB_method, &TaskList, &apply_mask, &M_dense_in_place,
+                &ntasks, &nfine, &nthreads, Context)) ;
+            if (plan_cache)
+            {
+                GB_Global_plan_cache_misses_increment ( ) ;
+                GB_AxB_saxpy3_plan_put (M, Mask_comp, A, B, AxB_method,
+                    nthreads_max, chunk, TaskList, apply_mask,
+                    M_dense_in_place, ntasks, nfine, nthreads) ;
+            }
+        }
     }
 
     if (do_sort) GBURBLE ("sort ") ;
@@ -455,16 +475,16 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
 
     if (Hi_size_total > 0)
     { 
-        Hi_all = GB_MALLOC (Hi_size_total, int64_t) ;
+        Hi_all = GB_MALLOC_POOL (Hi_size_total, int64_t) ;
     }
     if (Hf_size_total > 0)
     { 
         // Hf must be calloc'd to initialize all entries as empty 
-        Hf_all = GB_CALLOC (Hf_size_total, int64_t) ;
+        Hf_all = GB_CALLOC_POOL (Hf_size_total, int64_t) ;
     }
     if (Hx_size_total > 0)
     { 
-        Hx_all = GB_MALLOC (Hx_size_total * csize, GB_void) ;
+        Hx_all = GB_MALLOC_POOL (Hx_size_total * csize, GB_void) ;
     }
 
     if ((Hi_size_total > 0 && Hi_all == NULL) ||
@@ -74,6 +74,13 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
 // its computations in a hash table shared by all fine tasks that compute
 // C(:,j), via atomics.  The vector index j is GBH (Bh, kk).
 
+// A fine task can also be ultra-fine, if its slice of the work starts or ends
+// in the middle of A(:,k)*B(k,j) for a single entry B(k,j).  This allows a
+// single costly vector A(:,k) to be split across many tasks.  The first
+// askip_first entries of A(:,k) are skipped for the first entry B(k,j) in the
+// task, and the last askip_last entries of A(:,k) are skipped for the last
+// entry B(k,j) in the task.  Both are zero for a conventional fine task.
+
 // Both tasks use a hash table allocated uniquely for the task, in Hi, Hf, and
 // Hx.  The size of the hash table is determined by the maximum # of flops
 // needed to compute any vector in C(:,j1:j2) for a coarse task, or the entire
@@ -93,6 +100,8 @@ typedef struct
     GB_void *Hf ;       // Hf array for hash table (int8_t or int64_t)
     GB_void *Hx ;       // Hx array for hash table
     int64_t my_cjnz ;   // # entries in C(:,j) found by this fine task
+    int64_t askip_first ;   // # entries of A(:,k) to skip, first B(k,j)
+    int64_t askip_last ;    // # entries of A(:,k) to skip, last B(k,j)
     int leader ;        // leader fine task for the vector C(:,j)
     int team_size ;     // # of fine tasks in the team for vector C(:,j)
 }
@@ -106,6 +115,7 @@ GB_PUBLIC   // accessed by the MATLAB tests in GraphBLAS/Test only
 GrB_Info GB_AxB_saxpy3_flopcount
 (
     int64_t *Mwork,             // amount of work to handle the mask M
+    int64_t *Uflops,            // if not NULL: flop count without the mask
     int64_t *Bflops,            // size B->nvec+1 and all zero
     const GrB_Matrix M,         // optional mask matrix
     const bool Mask_comp,       // if true, mask is complemented
@@ -187,5 +197,50 @@ GrB_Info GB_AxB_saxpy3_slice_quick
     GB_Context Context
 ) ;
 
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan: cache of task schedules for saxpy3
+//------------------------------------------------------------------------------
+
+bool GB_AxB_saxpy3_plan_get         // true if the schedule was found
+(
+    // inputs
+    const GrB_Matrix M,             // optional mask matrix
+    const bool Mask_comp,           // if true, use !M
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B
+    GrB_Desc_Value AxB_method,      // Default, Gustavson, or Hash
+    int nthreads_max,               // max # of threads to use
+    double chunk,                   // chunk size
+    // outputs
+    GB_saxpy3task_struct **TaskList_handle,
+    bool *apply_mask,               // if true, apply M during sapxy3
+    bool *M_dense_in_place,         // if true, use M in-place
+    int *ntasks,                    // # of tasks created (coarse and fine)
+    int *nfine,                     // # of fine tasks created
+    int *nthreads                   // # of threads to use
+) ;
+
+void GB_AxB_saxpy3_plan_put         // save a schedule in the plan cache
+(
+    // inputs: the key
+    const GrB_Matrix M,             // optional mask matrix
+    const bool Mask_comp,           // if true, use !M
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B
+    GrB_Desc_Value AxB_method,      // Default, Gustavson, or Hash
+    int nthreads_max,               // max # of threads to use
+    double chunk,                   // chunk size
+    // inputs: the task schedule
+    const GB_saxpy3task_struct *TaskList,
+    bool apply_mask,                // if true, apply M during sapxy3
+    bool M_dense_in_place,          // if true, use M in-place
+    int ntasks,                     // # of tasks created (coarse and fine)
+    int nfine,                      // # of fine tasks created
+    int nthreads                    // # of threads to use
+) ;
+
+void GB_AxB_saxpy3_plan_clear (void) ;  // free all cached schedules
+
 #endif
 
+
@@ -38,6 +38,11 @@
 // saxpy-based method; the work for A'*B for the dot product method is not
 // computed.
 
+// If Uflops is not NULL, the total flop count of C=A*B without the mask is
+// also returned in Uflops.  Comparing it with the masked flop count in Bflops
+// shows how much work the mask prunes.  Vectors B(:,j) for which M(:,j) is
+// empty are then not skipped, so that their unmasked work can be counted.
+
 // The algorithm scans all nonzeros in B.  It only scans at most the min and
 // max (first and last) row indices in A and M (if M is present).  If A and M
 // are not hypersparse, the time taken is O(nnz(B)+n).  If all matrices are
@@ -82,6 +87,7 @@ GB_PUBLIC   // accessed by the MATLAB tests in GraphBLAS/Test only
 GrB_Info GB_AxB_saxpy3_flopcount
 (
     int64_t *Mwork,             // amount of work to handle the mask M
+    int64_t *Uflops,            // if not NULL: flop count without the mask
     int64_t *Bflops,            // size B->nvec+1
     const GrB_Matrix M,         // optional mask matrix
     const bool Mask_comp,       // if true, mask is complemented
@@ -178,7 +184,7 @@ GrB_Info GB_AxB_saxpy3_flopcount
     int64_t *GB_RESTRICT Wfirst = NULL ;       // size ntasks
     int64_t *GB_RESTRICT Wlast = NULL ;        // size ntasks
 
-    int ntasks = (nthreads == 1) ? 1 : (64 * nthreads) ;
+    int ntasks = (nthreads == 1) ? 1 : (GB_NUMA_NTASKS (64) * nthreads) ;
     int64_t *pstart_slice, *kfirst_slice, *klast_slice ;
     if (!GB_ek_slice (&pstart_slice, &kfirst_slice, &klast_slice, B, &ntasks))
     { 
@@ -205,9 +211,10 @@ GrB_Info GB_AxB_saxpy3_flopcount
     //--------------------------------------------------------------------------
 
     int64_t total_Mwork = 0 ;
+    int64_t total_Uflops = 0 ;
     int taskid ;
     #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
-        reduction(+:total_Mwork)
+        reduction(+:total_Mwork) reduction(+:total_Uflops)
     for (taskid = 0 ; taskid < ntasks ; taskid++)
     {
 
@@ -221,6 +228,7 @@ GrB_Info GB_AxB_saxpy3_flopcount
         Wlast  [taskid] = 0 ;
         int64_t mpleft = 0 ;     // for GB_lookup of the mask M
         int64_t task_Mwork = 0 ;
+        int64_t task_Uflops = 0 ;
 
         //----------------------------------------------------------------------
         // count flops for vectors kfirst to klast of B
@@ -253,6 +261,7 @@ GrB_Info GB_AxB_saxpy3_flopcount
 
             int64_t bjflops = (B_is_bitmap) ? my_bjnz : 0 ;
             int64_t mjnz = 0 ;
+            bool Cj_empty = false ;
             if (M != NULL && !M_is_dense)
             {
                 int64_t mpright = mnvec - 1 ;
@@ -261,7 +270,12 @@ GrB_Info GB_AxB_saxpy3_flopcount
                     &pM, &pM_end) ;
                 mjnz = pM_end - pM ;
                 // If M not complemented: C(:,j) is empty if M(:,j) is empty.
-                if (mjnz == 0 && !Mask_comp) continue ;
+                if (mjnz == 0 && !Mask_comp)
+                {
+                    // only the unmasked work is counted for B(:,j), if needed
+                    if (Uflops == NULL) continue ;
+                    Cj_empty = true ;
+                }
                 if (mjnz > 0)
                 {
                     // M(:,j) not empty
@@ -328,6 +342,8 @@ GrB_Info GB_AxB_saxpy3_flopcount
                 // skip if A(:,k) empty
                 int64_t aknz = pA_end - pA ;
                 if (aknz == 0) continue ;
+                task_Uflops += aknz ;
+                if (Cj_empty) continue ;
 
                 double bkjflops ;
 
@@ -363,6 +379,7 @@ GrB_Info GB_AxB_saxpy3_flopcount
             // log the flops for B(:,j)
             //------------------------------------------------------------------
 
+            if (Cj_empty) continue ;
             if (kk == kfirst)
             { 
                 Wfirst [taskid] = bjflops ;
@@ -379,6 +396,7 @@ GrB_Info GB_AxB_saxpy3_flopcount
 
         // compute the total work to access the mask, which is <= nnz (M)
         total_Mwork += task_Mwork ;
+        total_Uflops += task_Uflops ;
     }
 
     //--------------------------------------------------------------------------
@@ -470,6 +488,7 @@ GrB_Info GB_AxB_saxpy3_flopcount
 
     GB_FREE_WORK ;
     (*Mwork) = total_Mwork ;
+    if (Uflops != NULL) (*Uflops) = total_Uflops ;
     return (GrB_SUCCESS) ;
 }
 
@@ -0,0 +1,213 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan: cache of saxpy3 task schedules
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_AxB_saxpy3_slice_balanced computes the flop count of C=A*B and uses it to
+// construct a set of balanced coarse and fine tasks.  This analysis depends
+// only on the patterns of M, A, and B (and not their values), and on a few
+// parameters (Mask_comp, AxB_method, nthreads_max, and chunk).  When the same
+// product is computed repeatedly with matrices whose patterns do not change
+// (an iterative method that recomputes C=A*B with new values, for example),
+// the task schedule can be reused.
+
+// Each matrix holds a pattern_version, a stamp that is unique across all
+// matrices and that is renewed each time the pattern of the matrix changes
+// (see GB_PATTERN_CHANGED).  The plan cache is a small table of task
+// schedules, keyed by the pattern_version of M, A, and B, and the parameters
+// listed above.  Entries are replaced in round-robin order.  The cache is
+// disabled by default, and enabled with GxB_set (GxB_PLAN_CACHE, true).
+
+// The hash tables (Hi, Hf, and Hx) of each task are not cached; they are
+// allocated by GB_AxB_saxpy3 for each task list, including one obtained from
+// the cache.
+
+#include "GB_AxB_saxpy3.h"
+
+#define GB_PLAN_CACHE_SIZE 8
+
+typedef struct
+{
+    // key
+    uint64_t M_version ;            // pattern of M, or 0 if M is NULL
+    uint64_t A_version ;            // pattern of A
+    uint64_t B_version ;            // pattern of B
+    bool Mask_comp ;
+    GrB_Desc_Value AxB_method ;
+    int nthreads_max ;
+    double chunk ;
+    // task schedule
+    GB_saxpy3task_struct *TaskList ;    // NULL if the entry is empty
+    bool apply_mask ;
+    bool M_dense_in_place ;
+    int ntasks ;
+    int nfine ;
+    int nthreads ;
+}
+GB_saxpy3plan_struct ;
+
+static GB_saxpy3plan_struct GB_plan_cache [GB_PLAN_CACHE_SIZE] ;
+static int GB_plan_cache_next = 0 ;
+
+//------------------------------------------------------------------------------
+// GB_plan_copy: copy a task list, excluding its hash tables
+//------------------------------------------------------------------------------
+
+static GB_saxpy3task_struct *GB_plan_copy
+(
+    const GB_saxpy3task_struct *TaskList,
+    int ntasks
+)
+{
+    GB_saxpy3task_struct *T = GB_MALLOC (ntasks, GB_saxpy3task_struct) ;
+    if (T != NULL)
+    {
+        memcpy (T, TaskList, ntasks * sizeof (GB_saxpy3task_struct)) ;
+        for (int taskid = 0 ; taskid < ntasks ; taskid++)
+        {
+            T [taskid].Hi = NULL ;
+            T [taskid].Hf = NULL ;
+            T [taskid].Hx = NULL ;
+        }
+    }
+    return (T) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan_get: find a task schedule in the plan cache
+//------------------------------------------------------------------------------
+
+// Returns true if the task schedule for C=A*B was found in the cache, in which
+// case a copy of it is returned in TaskList_handle.  Returns false if not
+// found, or if out of memory.
+
+bool GB_AxB_saxpy3_plan_get
+(
+    // inputs
+    const GrB_Matrix M,             // optional mask matrix
+    const bool Mask_comp,           // if true, use !M
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B
+    GrB_Desc_Value AxB_method,      // Default, Gustavson, or Hash
+    int nthreads_max,               // max # of threads to use
+    double chunk,                   // chunk size
+    // outputs
+    GB_saxpy3task_struct **TaskList_handle,
+    bool *apply_mask,               // if true, apply M during sapxy3
+    bool *M_dense_in_place,         // if true, use M in-place
+    int *ntasks,                    // # of tasks created (coarse and fine)
+    int *nfine,                     // # of fine tasks created
+    int *nthreads                   // # of threads to use
+)
+{
+
+    (*TaskList_handle) = NULL ;
+    uint64_t M_version = (M == NULL) ? 0 : M->pattern_version ;
+    bool found = false ;
+
+    #pragma omp critical (GB_plan_cache)
+    {
+        for (int k = 0 ; k < GB_PLAN_CACHE_SIZE ; k++)
+        {
+            GB_saxpy3plan_struct *P = &(GB_plan_cache [k]) ;
+            if (P->TaskList != NULL
+                && P->M_version    == M_version
+                && P->A_version    == A->pattern_version
+                && P->B_version    == B->pattern_version
+                && P->Mask_comp    == Mask_comp
+                && P->AxB_method   == AxB_method
+                && P->nthreads_max == nthreads_max
+                && P->chunk        == chunk)
+            {
+                (*TaskList_handle) = GB_plan_copy (P->TaskList, P->ntasks) ;
+                found = ((*TaskList_handle) != NULL) ;
+                (*apply_mask) = P->apply_mask ;
+                (*M_dense_in_place) = P->M_dense_in_place ;
+                (*ntasks) = P->ntasks ;
+                (*nfine) = P->nfine ;
+                (*nthreads) = P->nthreads ;
+                break ;
+            }
+        }
+    }
+
+    return (found) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan_put: save a task schedule in the plan cache
+//------------------------------------------------------------------------------
+
+// If out of memory, the schedule is silently not cached.
+
+void GB_AxB_saxpy3_plan_put
+(
+    // inputs: the key
+    const GrB_Matrix M,             // optional mask matrix
+    const bool Mask_comp,           // if true, use !M
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B
+    GrB_Desc_Value AxB_method,      // Default, Gustavson, or Hash
+    int nthreads_max,               // max # of threads to use
+    double chunk,                   // chunk size
+    // inputs: the task schedule
+    const GB_saxpy3task_struct *TaskList,
+    bool apply_mask,                // if true, apply M during sapxy3
+    bool M_dense_in_place,          // if true, use M in-place
+    int ntasks,                     // # of tasks created (coarse and fine)
+    int nfine,                      // # of fine tasks created
+    int nthreads                    // # of threads to use
+)
+{
+
+    GB_saxpy3task_struct *T = GB_plan_copy (TaskList, ntasks) ;
+    if (T == NULL)
+    {
+        // out of memory; do not cache the schedule
+        return ;
+    }
+
+    GB_saxpy3task_struct *T_old = NULL ;
+    #pragma omp critical (GB_plan_cache)
+    {
+        GB_saxpy3plan_struct *P = &(GB_plan_cache [GB_plan_cache_next]) ;
+        GB_plan_cache_next = (GB_plan_cache_next + 1) % GB_PLAN_CACHE_SIZE ;
+        T_old = P->TaskList ;
+        P->M_version = (M == NULL) ? 0 : M->pattern_version ;
+        P->A_version = A->pattern_version ;
+        P->B_version = B->pattern_version ;
+        P->Mask_comp = Mask_comp ;
+        P->AxB_method = AxB_method ;
+        P->nthreads_max = nthreads_max ;
+        P->chunk = chunk ;
+        P->TaskList = T ;
+        P->apply_mask = apply_mask ;
+        P->M_dense_in_place = M_dense_in_place ;
+        P->ntasks = ntasks ;
+        P->nfine = nfine ;
+        P->nthreads = nthreads ;
+    }
+
+    GB_FREE (T_old) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan_clear: free all entries in the plan cache
+//------------------------------------------------------------------------------
+
+void GB_AxB_saxpy3_plan_clear (void)
+{
+
+    #pragma omp critical (GB_plan_cache)
+    {
+        for (int k = 0 ; k < GB_PLAN_CACHE_SIZE ; k++)
+        {
+            GB_FREE (GB_plan_cache [k].TaskList) ;
+        }
+        GB_plan_cache_next = 0 ;
+    }
+}
@@ -21,7 +21,6 @@
     GB_FREE (Fine_fl) ;         \
     GB_FREE (Coarse_Work) ;     \
     GB_FREE (Coarse_initial) ;  \
-    GB_FREE (Fine_slice) ;      \
 }
 
 #define GB_FREE_ALL             \
@@ -83,12 +82,41 @@ static inline int64_t GB_hash_table_size
     return (hash_size) ;
 }
 
+//------------------------------------------------------------------------------
+// GB_hash_flops: bound the # of entries in the hash table for C(:,j)
+//------------------------------------------------------------------------------
+
+// If the mask M is present, not complemented, and scattered into the hash
+// table (C<M>=A*B with M sparse or hypersparse), then the hash table for C(:,j)
+// holds exactly the entries of M(:,j), since no entry outside the pattern of
+// M(:,j) is ever inserted.  The table can thus be sized from nnz (M(:,j))
+// alone, rather than from the flop count for C(:,j), which also includes the
+// work for A*B(:,j).  M_first is NULL if the hash tables are not sized from
+// the mask.
+
+static inline int64_t GB_hash_flops
+(
+    int64_t fl,                 // flop count for C(:,j), including nnz (M(:,j))
+    const GrB_Matrix M_first,   // mask used to size the hash table, or NULL
+    const int64_t *GB_RESTRICT Bh,
+    int64_t kk                  // C(:,j) is the kk-th vector, with j = Bh [kk]
+)
+{
+    if (M_first == NULL) return (fl) ;
+    int64_t j = GBH (Bh, kk) ;
+    int64_t mpleft = 0, pM, pM_end ;
+    GB_lookup (GB_IS_HYPERSPARSE (M_first), M_first->h, M_first->p,
+        M_first->vlen, &mpleft, M_first->nvec-1, j, &pM, &pM_end) ;
+    return (GB_IMAX (1, GB_IMIN (fl, pM_end - pM))) ;
+}
+
 //------------------------------------------------------------------------------
 // GB_create_coarse_task: create a single coarse task
 //------------------------------------------------------------------------------
 
 // Compute the max flop count for any vector in a coarse task, determine the
-// hash table size, and construct the coarse task.
+// hash table size, and construct the coarse task.  If M_first is present, the
+// hash table is sized from the mask instead (see GB_hash_flops).
 
 static inline void GB_create_coarse_task
 (
@@ -101,7 +129,9 @@ static inline void GB_create_coarse_task
     double chunk,
     int nthreads_max,
     int64_t *Coarse_Work,   // workspace for parallel reduction for flop count
-    const GrB_Desc_Value AxB_method     // Default, Gustavson, or Hash
+    const GrB_Desc_Value AxB_method,    // Default, Gustavson, or Hash
+    const GrB_Matrix M_first,           // mask to size the hash table, or NULL
+    const int64_t *GB_RESTRICT Bh       // B->h, to find M(:,j)
 )
 {
 
@@ -123,6 +153,7 @@ static inline void GB_create_coarse_task
         { 
             int64_t kk = kfirst + i ;
             int64_t fl = Bflops [kk+1] - Bflops [kk] ;
+            fl = GB_hash_flops (fl, M_first, Bh, kk) ;
             my_flmax = GB_IMAX (my_flmax, fl) ;
         }
         Coarse_Work [tid] = my_flmax ;
@@ -141,6 +172,7 @@ static inline void GB_create_coarse_task
     for (int64_t kk = kfirst ; kk <= klast ; kk++)
     {
         int64_t fl = Bflops [kk+1] - Bflops [kk] ;
+        fl = GB_hash_flops (fl, M_first, Bh, kk) ;
         flmax2 = GB_IMAX (flmax2, fl) ;
     }
     ASSERT (flmax == flmax2) ;
@@ -158,6 +190,8 @@ static inline void GB_create_coarse_task
     TaskList [taskid].Hf      = NULL ;      // assigned later
     TaskList [taskid].Hx      = NULL ;      // assigned later
     TaskList [taskid].my_cjnz = 0 ;         // unused
+    TaskList [taskid].askip_first = 0 ;     // not ultra-fine
+    TaskList [taskid].askip_last  = 0 ;     // not ultra-fine
     TaskList [taskid].leader  = taskid ;
     TaskList [taskid].team_size = 1 ;
 }
@@ -227,7 +261,6 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
 
     int64_t *GB_RESTRICT Coarse_initial = NULL ;    // initial coarse tasks
     int64_t *GB_RESTRICT Coarse_Work = NULL ;       // workspace for flop counts
-    int64_t *GB_RESTRICT Fine_slice = NULL ;
     int64_t *GB_RESTRICT Fine_fl = NULL ;
 
     //--------------------------------------------------------------------------
@@ -257,14 +290,24 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
     // compute flop counts for each vector of B and C
     //--------------------------------------------------------------------------
 
+    // If M is present and not complemented, also find the flop count of A*B
+    // without the mask, to see how much work the mask prunes.
+
     int64_t Mwork = 0 ;
+    int64_t Uflops = 0 ;
+    bool mask_is_M = (M != NULL && !Mask_comp) ;
     int64_t *GB_RESTRICT Bflops = C->p ;    // use C->p as workspace for Bflops
-    GB_OK (GB_AxB_saxpy3_flopcount (&Mwork, Bflops, M, Mask_comp, A, B,
-        Context)) ;
+    GB_OK (GB_AxB_saxpy3_flopcount (&Mwork, mask_is_M ? (&Uflops) : NULL,
+        Bflops, M, Mask_comp, A, B, Context)) ;
     int64_t total_flops = Bflops [bnvec] ;
     double axbflops = total_flops - Mwork ;
     GBURBLE ("axbwork %g ", axbflops) ;
     if (Mwork > 0) GBURBLE ("mwork %g ", (double) Mwork) ;
+    if (!mask_is_M) Uflops = axbflops ;
+    if (Uflops > axbflops) GBURBLE ("unmasked %g ", (double) Uflops) ;
+
+    // mask used to size the hash tables, if any
+    GrB_Matrix M_first = NULL ;
 
     //--------------------------------------------------------------------------
     // determine if the mask M should be applied, or done later
@@ -338,7 +381,8 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
         }
 
     }
-    else if (axbflops < ((double) Mwork * GB_MWORK_ALPHA))
+    else if (axbflops < ((double) Mwork * GB_MWORK_ALPHA) &&
+             Uflops   < ((double) Mwork * GB_MWORK_ALPHA))
     {
 
         //----------------------------------------------------------------------
@@ -347,13 +391,17 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
 
         // Do not use M during the computation of A*B.  Instead, compute C=A*B
         // and then apply the mask later.  Tell the caller that the mask should
-        // not be applied, so that it will be applied later in GB_mxm.
+        // not be applied, so that it will be applied later in GB_mxm.  This is
+        // only done if C=A*B without the mask is also cheap compared with the
+        // mask.  Otherwise, the mask prunes a costly product (as in triangle
+        // counting, C<L>=L*L'), and the unmasked C=A*B would be far larger
+        // than the final result.
 
         (*apply_mask) = false ;
 
         // redo the flop count analysis, without the mask
-        GB_OK (GB_AxB_saxpy3_flopcount (&Mwork, Bflops, NULL, false, A, B,
-            Context)) ;
+        GB_OK (GB_AxB_saxpy3_flopcount (&Mwork, NULL, Bflops, NULL, false,
+            A, B, Context)) ;
         total_flops = Bflops [bnvec] ;
         GBURBLE ("(discard mask) ") ;
 
@@ -367,6 +415,11 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
 
         (*apply_mask) = true ;
         GBURBLE ("(use mask) ") ;
+
+        // C<M>=A*B with M sparse or hypersparse: M is scattered into each
+        // hash table, and no entry outside M is inserted, so the tables can
+        // be sized from nnz (M(:,j)).
+        if (mask_is_M) M_first = M ;
     }
 
     //--------------------------------------------------------------------------
@@ -423,8 +476,6 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
     int ncoarse = 0 ;       // # of coarse tasks
     int max_bjnz = 0 ;      // max (nnz (B (:,j))) of fine tasks
 
-    // FUTURE: also use ultra-fine tasks that compute A(i1:i2,k)*B(k,j)
-
     if (ntasks_initial > 1)
     {
 
@@ -472,7 +523,7 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
                     // bjnz = nnz (B (:,j))
                     int64_t bjnz = (Bp == NULL) ? bvlen : (Bp [kk+1] - Bp [kk]);
 
-                    if (jflops > GB_COSTLY * target_task_size && bjnz > 1)
+                    if (jflops > GB_COSTLY * target_task_size && bjnz > 0)
                     {
                         // A*B(:,j) is costly; split it into 2 or more fine
                         // tasks.  First flush the prior coarse task, if any.
@@ -542,12 +593,11 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
     if (max_bjnz > 0)
     { 
         // also allocate workspace to construct fine tasks
-        Fine_slice = GB_MALLOC ((*ntasks)+1  , int64_t) ;
         Fine_fl    = GB_MALLOC (max_bjnz+1, int64_t) ;
     }
 
     if (TaskList == NULL || Coarse_Work == NULL ||
-        (max_bjnz > 0 && (Fine_slice == NULL || Fine_fl == NULL)))
+        (max_bjnz > 0 && Fine_fl == NULL))
     { 
         // out of memory
         GB_FREE_ALL ;
@@ -596,7 +646,7 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
                     // bjnz = nnz (B (:,j))
                     int64_t bjnz = (Bp == NULL) ? bvlen : (Bp [kk+1] - Bp [kk]);
 
-                    if (jflops > GB_COSTLY * target_task_size && bjnz > 1)
+                    if (jflops > GB_COSTLY * target_task_size && bjnz > 0)
                     {
                         // A*B(:,j) is costly; split it into 2 or more fine
                         // tasks.  First flush the prior coarse task, if any.
@@ -605,7 +655,8 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
                             // kcoarse_start:kk-1 form a single coarse task
                             GB_create_coarse_task (kcoarse_start, kk-1,
                                 TaskList, nc++, Bflops, cvlen, chunk,
-                                nthreads_max, Coarse_Work, AxB_method) ;
+                                nthreads_max, Coarse_Work, AxB_method,
+                                M_first, Bh) ;
                         }
 
                         // next coarse task (if any) starts at kk+1
@@ -639,25 +690,53 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
                         // cumulative sum of flops to compute A*B(:,j)
                         GB_cumsum (Fine_fl, bjnz, NULL, nth) ;
 
-                        // slice B(:,j) into fine tasks
+                        // slice the work for A*B(:,j) into fine tasks
                         int team_size = ceil (jflops / target_fine_size) ;
-                        ASSERT (Fine_slice != NULL) ;
-                        GB_pslice (&Fine_slice, Fine_fl, bjnz, team_size,
-                            false) ;
+                        int64_t jfl = Fine_fl [bjnz] ;
 
                         // shared hash table for all fine tasks for A*B(:,j)
-                        int64_t hsize = 
-                            GB_hash_table_size (jflops, cvlen, AxB_method) ;
-
-                        // construct the fine tasks for C(:,j)=A*B(:,j)
+                        int64_t hsize = GB_hash_table_size (
+                            GB_hash_flops (jflops, M_first, Bh, kk),
+                            cvlen, AxB_method) ;
+
+                        // construct the fine tasks for C(:,j)=A*B(:,j).
+                        // Task fid does the work f1:f2-1, which starts in
+                        // A(:,k1)*B(k1,j) for the entry B(k1,j) at s1, and
+                        // ends in A(:,k2)*B(k2,j) for the entry at s2.  If a
+                        // single A(:,k)*B(k,j) is costly, it is split
+                        // amongst several ultra-fine tasks.
                         int leader = nf ;
+                        int64_t s1 = 0 ;
                         for (int fid = 0 ; fid < team_size ; fid++)
                         { 
-                            int64_t pstart = Fine_slice [fid] ;
-                            int64_t pend   = Fine_slice [fid+1] ;
-                            int64_t fl = Fine_fl [pend] - Fine_fl [pstart] ;
-                            TaskList [nf].start  = pB_start + pstart ;
-                            TaskList [nf].end    = pB_start + pend - 1 ;
+                            int64_t f1, f2 ;
+                            GB_PARTITION (f1, f2, jfl, fid, team_size) ;
+                            // find the entry s1 that contains the work f1
+                            while (s1 < bjnz && Fine_fl [s1+1] <= f1)
+                            {
+                                s1++ ;
+                            }
+                            // find the entry s2 that contains the work f2-1
+                            int64_t s2 = s1 ;
+                            while (s2 < bjnz && Fine_fl [s2+1] < f2)
+                            {
+                                s2++ ;
+                            }
+                            if (f1 < f2)
+                            { 
+                                TaskList [nf].start = pB_start + s1 ;
+                                TaskList [nf].end   = pB_start + s2 ;
+                                TaskList [nf].askip_first = f1 - Fine_fl [s1];
+                                TaskList [nf].askip_last  = Fine_fl [s2+1]-f2;
+                            }
+                            else
+                            { 
+                                // this fine task has no work to do
+                                TaskList [nf].start = pB_start + s1 ;
+                                TaskList [nf].end   = pB_start + s1 - 1 ;
+                                TaskList [nf].askip_first = 0 ;
+                                TaskList [nf].askip_last  = 0 ;
+                            }
                             TaskList [nf].vector = kk ;
                             TaskList [nf].hsize  = hsize ;
                             TaskList [nf].Hi = NULL ;   // assigned later
@@ -677,7 +756,7 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
                     // kcoarse_start:klast-1 form a single coarse task
                     GB_create_coarse_task (kcoarse_start, klast-1, TaskList,
                         nc++, Bflops, cvlen, chunk, nthreads_max,
-                        Coarse_Work, AxB_method) ;
+                        Coarse_Work, AxB_method, M_first, Bh) ;
                 }
 
             }
@@ -685,7 +764,8 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
             { 
                 // This coarse task is OK as-is.
                 GB_create_coarse_task (kfirst, klast-1, TaskList, nc++, Bflops,
-                    cvlen, chunk, nthreads_max, Coarse_Work, AxB_method) ;
+                    cvlen, chunk, nthreads_max, Coarse_Work, AxB_method,
+                    M_first, Bh) ;
             }
         }
 
@@ -699,7 +779,7 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
 
         // create a single coarse task: hash or Gustavson
         GB_create_coarse_task (0, bnvec-1, TaskList, 0, Bflops, cvlen, 1, 1,
-            Coarse_Work, AxB_method) ;
+            Coarse_Work, AxB_method, M_first, Bh) ;
 
         if (bnvec == 1)
         { 
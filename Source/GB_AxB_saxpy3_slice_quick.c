@@ -60,6 +60,8 @@ GrB_Info GB_AxB_saxpy3_slice_quick
     TaskList [0].Hf      = NULL ;      // assigned later
     TaskList [0].Hx      = NULL ;      // assigned later
     TaskList [0].my_cjnz = 0 ;         // unused
+    TaskList [0].askip_first = 0 ;     // not ultra-fine
+    TaskList [0].askip_last  = 0 ;     // not ultra-fine
     TaskList [0].leader  = 0 ;
     TaskList [0].team_size = 1 ;
 
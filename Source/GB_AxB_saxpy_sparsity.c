@@ -16,11 +16,38 @@
 // is hypersparse, C must also be hypersparse; otherwise C must be sparse.
 
 // TODO: When A or B are bitmapped or full, they can be transposed in-place.
-// TODO: give the user control over this decision
+
+// Where C can be either sparse or bitmap, the choice is made by a simple rule
+// by default, or by comparing the estimated time of each if the cost model is
+// enabled with GxB_set (GxB_AxB_COST_MODEL, true).
 
 //------------------------------------------------------------------------------
 
 #include "GB_AxB_saxpy.h"
+#include "GB_AxB_cost.h"
+
+//------------------------------------------------------------------------------
+// GB_cost_sparsity: select a sparse or bitmap C with the cost model
+//------------------------------------------------------------------------------
+
+static int GB_cost_sparsity
+(
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    GB_Context Context
+)
+{
+    double t_sparse = GB_AxB_cost_saxpy (A, B, false, false, GxB_SPARSE,
+        Context) ;
+    double t_bitmap = GB_AxB_cost_saxpy (A, B, false, false, GxB_BITMAP,
+        Context) ;
+    GBURBLE ("(cost: sparse %g bitmap %g) ", t_sparse, t_bitmap) ;
+    return ((t_sparse < t_bitmap) ? GxB_SPARSE : GxB_BITMAP) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy_sparsity
+//------------------------------------------------------------------------------
 
 int GB_AxB_saxpy_sparsity           // return the sparsity structure for C
 (
@@ -38,6 +65,7 @@ int GB_AxB_saxpy_sparsity           // return the sparsity structure for C
     //--------------------------------------------------------------------------
 
     int C_sparsity ;
+    bool cost_model = GB_Global_axb_cost_model_get ( ) ;
 
     if (B->nvec_nonempty < 0) B->nvec_nonempty = GB_nvec_nonempty (B, Context) ;
     double bnvec = B->nvec_nonempty ;
@@ -164,12 +192,12 @@ int GB_AxB_saxpy_sparsity           // return the sparsity structure for C
 
         // For the cases where C is labelled as hyper/bitmap or sparse/bitmap:
         // If m*n is much larger than nnz(A)+nnz(B), then always construct C as
-        // sparse/hyper, not bitmap.   TODO: give the user control over this
-        // decision.
+        // sparse/hyper, not bitmap.  If the cost model is enabled, the
+        // estimated time of each is compared instead.
 
-        // TODO:  for bitmap*hyper and hyper*bitmap, create a packed version
-        // of the hyper matrix (like dot does), and construct C as bitmap.
-        // Then expand into C into hyper.
+        // For bitmap*hyper and full*hyper, C is hyper, but if M is not
+        // present GB_AxB_saxpy computes it as bitmap, using a packed version
+        // of B (like dot2 does), and then expands it into hyper.
 
         switch (B_sparsity)
         {
@@ -192,7 +220,15 @@ int GB_AxB_saxpy_sparsity           // return the sparsity structure for C
                     case GxB_FULL : 
                         // S = {B,F} * S : if B has many empty columns
                         // B = {B,F} * S : otherwise C is bitmap
-                        C_sparsity = (bnvec < n/2) ? GxB_SPARSE : GxB_BITMAP ;
+                        if (cost_model)
+                        { 
+                            C_sparsity = GB_cost_sparsity (A, B, Context) ;
+                        }
+                        else
+                        { 
+                            C_sparsity = (bnvec < n/2) ?
+                                GxB_SPARSE : GxB_BITMAP ;
+                        }
                         break ;
                     default: ;
                 }
@@ -208,7 +244,14 @@ int GB_AxB_saxpy_sparsity           // return the sparsity structure for C
                     case GxB_SPARSE : 
                         // S = {S,H} * {B,F} : if A is very sparse
                         // B = {S,H} * {B,F} : otherwise C is bitmap
-                        C_sparsity = (anz < m) ? GxB_SPARSE : GxB_BITMAP ;
+                        if (cost_model)
+                        { 
+                            C_sparsity = GB_cost_sparsity (A, B, Context) ;
+                        }
+                        else
+                        { 
+                            C_sparsity = (anz < m) ? GxB_SPARSE : GxB_BITMAP ;
+                        }
                         break ;
                     case GxB_BITMAP : 
                     case GxB_FULL : 
@@ -15,7 +15,7 @@
 
 static GrB_Info GB_dc
 (
-    int kind,                           // 0, 1, or 2
+    int kind,                           // 0, 1, 2, or 3
     const char *field,
     const GrB_Desc_Value v,
     const GrB_Desc_Value nondefault,    // for kind == 0
@@ -40,6 +40,10 @@ static GrB_Info GB_dc
         case GxB_AxB_GUSTAVSON      : GBPR0 ("Gustavson ") ; break ;
         case GxB_AxB_HASH           : GBPR0 ("hash      ") ; break ;
         case GxB_AxB_DOT            : GBPR0 ("dot       ") ; break ;
+        case GxB_AxB_OUTER          : GBPR0 ("outer     ") ; break ;
+        case GxB_SHALLOW_IMPORT     : GBPR0 ("shallow   ") ; break ;
+        case GxB_COMPRESSION_NONE   : GBPR0 ("none      ") ; break ;
+        case GxB_COMPRESSION_VARINT : GBPR0 ("varint    ") ; break ;
         default                     : GBPR0 ("unknown   ") ;
             info = GrB_INVALID_OBJECT ;
             ok = false ;
@@ -66,11 +70,21 @@ static GrB_Info GB_dc
                 ok = false ;
             }
         }
-        else // kind == 2
+        else if (kind == 2)
         {
             // GxB_AxB_METHOD:
             if (! (v == GxB_DEFAULT || v == GxB_AxB_GUSTAVSON
-                || v == GxB_AxB_DOT || v == GxB_AxB_HASH || v == GxB_AxB_SAXPY))
+                || v == GxB_AxB_DOT || v == GxB_AxB_HASH || v == GxB_AxB_SAXPY
+                || v == GxB_AxB_OUTER))
+            { 
+                ok = false ;
+            }
+        }
+        else // kind == 3
+        {
+            // GxB_COMPRESSION:
+            if (! (v == GxB_DEFAULT || v == GxB_COMPRESSION_NONE
+                || v == GxB_COMPRESSION_VARINT))
             { 
                 ok = false ;
             }
@@ -122,14 +136,16 @@ GrB_Info GB_Descriptor_check    // check a GraphBLAS descriptor
 
     GBPR0 ("\n") ;
 
-    GrB_Info info [5] ;
+    GrB_Info info [7] ;
     info [0] = GB_dc (0, "out     ", D->out,  GrB_REPLACE, pr, f) ;
     info [1] = GB_dc (1, "mask    ", D->mask, GxB_DEFAULT, pr, f) ;
     info [2] = GB_dc (0, "in0     ", D->in0,  GrB_TRAN,    pr, f) ;
     info [3] = GB_dc (0, "in1     ", D->in1,  GrB_TRAN,    pr, f) ;
     info [4] = GB_dc (2, "axb     ", D->axb,  GxB_DEFAULT, pr, f) ;
+    info [5] = GB_dc (0, "import  ", D->import, GxB_SHALLOW_IMPORT, pr, f) ;
+    info [6] = GB_dc (3, "compress", D->compression, GxB_DEFAULT, pr, f) ;
 
-    for (int i = 0 ; i < 5 ; i++)
+    for (int i = 0 ; i < 7 ; i++)
     {
         if (info [i] != GrB_SUCCESS)
         { 
@@ -66,6 +66,7 @@
 //      GxB_AxB_HASH            hash-based saxpy method
 //      GxB_AxB_SAXPY           saxpy: either Gustavson or hash
 //      GxB_AxB_DOT             dot product
+//      GxB_AxB_OUTER           outer product, for C=A*B' only
 
 //  desc->do_sort               true or false (default is false) 
 
@@ -140,7 +141,8 @@ GrB_Info GB_Descriptor_get      // get the contents of a descriptor
         !(In1_desc  == GxB_DEFAULT || In1_desc  == GrB_TRAN) ||
         !(AxB_desc  == GxB_DEFAULT || AxB_desc  == GxB_AxB_GUSTAVSON ||
           AxB_desc  == GxB_AxB_DOT ||
-          AxB_desc  == GxB_AxB_HASH || AxB_desc  == GxB_AxB_SAXPY))
+          AxB_desc  == GxB_AxB_HASH || AxB_desc  == GxB_AxB_SAXPY ||
+          AxB_desc  == GxB_AxB_OUTER))
     { 
         return (GrB_INVALID_OBJECT) ;
     }
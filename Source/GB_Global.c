@@ -14,6 +14,7 @@
 // global matrix options, and other settings.
 
 #include "GB_atomics.h"
+#include "GB_AxB_cost.h"
 
 //------------------------------------------------------------------------------
 // Global storage: for all threads in a user application that uses GraphBLAS
@@ -43,6 +44,8 @@ typedef struct
     float bitmap_switch [GxB_NBITMAP_SWITCH] ; // default bitmap_switch
     float hyper_switch ;        // default hyper_switch for new matrices
     bool is_csc ;               // default CSR/CSC format for new matrices
+    int index32_control ;       // default 32-bit integer control
+    int bitmap_pack_control ;   // default packed bitmap control
 
     //--------------------------------------------------------------------------
     // abort function: only used for debugging
@@ -90,6 +93,35 @@ typedef struct
     bool malloc_debug ;             // if true, test memory handling
     int64_t malloc_debug_count ;    // for testing memory handling
 
+    //--------------------------------------------------------------------------
+    // large blocks of memory
+    //--------------------------------------------------------------------------
+
+    // first_touch: if true, large blocks allocated by GB_calloc_memory are
+    // cleared in parallel.  huge_pages: if true, large blocks are advised to
+    // use transparent huge pages.  numa_policy: how the pages of large blocks
+    // are placed across the threads (GxB_NUMA_*).  See GB_first_touch.
+
+    bool first_touch ;              // parallel first touch of calloc'd blocks
+    bool huge_pages ;               // use huge pages for large blocks
+    int numa_policy ;               // placement of large blocks
+
+    //--------------------------------------------------------------------------
+    // memory pool: for recycling workspace
+    //--------------------------------------------------------------------------
+
+    // free_pool [k] is a linked list of free blocks of size 2^k bytes, held
+    // for reuse by GB_pool_malloc.  The total size of all blocks in the pool
+    // is free_pool_size, which never exceeds free_pool_limit.  The pool is
+    // disabled if free_pool_limit is zero (the default).  Blocks held in the
+    // pool are not counted in nmalloc.
+
+    void *free_pool [64] ;          // lists of free blocks of size 2^k
+    int64_t free_pool_size ;        // total size of all blocks in the pool
+    int64_t free_pool_limit ;       // max total size of the pool
+    int64_t free_pool_hits ;        // # of blocks reused from the pool
+    int64_t free_pool_misses ;      // # of blocks not found in the pool
+
     //--------------------------------------------------------------------------
     // for testing and development
     //--------------------------------------------------------------------------
@@ -102,6 +134,53 @@ typedef struct
 
     bool burble ;                   // controls GBURBLE output
 
+    //--------------------------------------------------------------------------
+    // saxpy3 plan cache
+    //--------------------------------------------------------------------------
+
+    // pattern_version: each time the pattern of a matrix may change, it is
+    // given a new unique A->pattern_version from this counter.  plan_cache:
+    // if true, GB_AxB_saxpy3 reuses the tasks it constructed for a prior
+    // C=A*B with the same A, B, and M, if their patterns have not changed.
+
+    uint64_t pattern_version ;      // last pattern version assigned
+    bool plan_cache ;               // if true, saxpy3 plans are cached
+    int64_t plan_cache_hits ;       // # of saxpy3 plans reused
+    int64_t plan_cache_misses ;     // # of saxpy3 plans constructed
+
+    //--------------------------------------------------------------------------
+    // cost model for C=A*B
+    //--------------------------------------------------------------------------
+
+    // axb_cost_model: if true, GrB_mxm selects its method with the cost model
+    // in GB_AxB_cost.c.  axb_cost: the coefficients of the model, in seconds
+    // per operation.  axb_cost_predicted and axb_cost_actual: the predicted
+    // and measured time of the last C=A*B computed with the model enabled.
+
+    bool axb_cost_model ;
+    double axb_cost [GB_AXB_COST_N] ;
+    double axb_cost_predicted ;
+    double axb_cost_actual ;
+
+    //--------------------------------------------------------------------------
+    // sorting method for GB_builder
+    //--------------------------------------------------------------------------
+
+    // build_sort: how GB_builder sorts its tuples (GxB_BUILD_SORT_*).  By
+    // default, it selects the radix sort or the mergesort for each problem.
+
+    int build_sort ;
+
+    //--------------------------------------------------------------------------
+    // sorted runs of pending tuples
+    //--------------------------------------------------------------------------
+
+    // pending_run_size: if nonzero, the pending tuples of each matrix are
+    // sorted in runs of this many tuples as they are added, and the runs are
+    // merged incrementally (see GB_Pending_merge).  Zero by default.
+
+    int64_t pending_run_size ;
+
     //--------------------------------------------------------------------------
     // for MATLAB interface only
     //--------------------------------------------------------------------------
@@ -155,6 +234,8 @@ GB_Global_struct GB_Global =
 
     // default format
     .hyper_switch = GB_HYPER_SWITCH_DEFAULT,
+    .index32_control = GxB_INDEX32_AUTO,
+    .bitmap_pack_control = GxB_BITMAP_PACK_AUTO,
     .bitmap_switch = {
         GB_BITSWITCH_1,
         GB_BITSWITCH_2,
@@ -183,12 +264,47 @@ GB_Global_struct GB_Global =
     .malloc_debug = false,       // do not test memory handling
     .malloc_debug_count = 0,     // counter for testing memory handling
 
+    // large blocks of memory
+    .first_touch = false,
+    .huge_pages = false,
+    .numa_policy = GxB_NUMA_DEFAULT,
+
+    // memory pool, disabled by default
+    .free_pool_size = 0,
+    .free_pool_limit = 0,
+    .free_pool_hits = 0,
+    .free_pool_misses = 0,
+
     // for testing and development only
     .hack = 0,
 
     // diagnostics
     .burble = false,
 
+    // saxpy3 plan cache
+    .pattern_version = 0,
+    .plan_cache = false,
+    .plan_cache_hits = 0,
+    .plan_cache_misses = 0,
+
+    // cost model for C=A*B, with default coefficients (see GB_AxB_cost.h)
+    .axb_cost_model = false,
+    .axb_cost = {
+        0.5e-9,     // GB_AXB_COST_STREAM
+        3.0e-9,     // GB_AXB_COST_GATHER
+        4.0e-9,     // GB_AXB_COST_SCATTER
+        8.0e-9,     // GB_AXB_COST_HASH
+        6.0e-9,     // GB_AXB_COST_TRANSPOSE
+        60.0e-9 },  // GB_AXB_COST_BUILD
+    .axb_cost_predicted = 0,
+    .axb_cost_actual = 0,
+
+    // sorting method for GB_builder, selected automatically by default
+    .build_sort = GxB_BUILD_SORT_AUTO,
+
+    // pending tuples are not kept in sorted runs, by default
+    .pending_run_size = 0,
+
     // for MATLAB interface only
     .print_one_based = false,   // if true, print 1-based indices
 
@@ -294,6 +410,34 @@ float GB_Global_hyper_switch_get (void)
     return (GB_Global.hyper_switch) ;
 }
 
+//------------------------------------------------------------------------------
+// index32_control
+//------------------------------------------------------------------------------
+
+void GB_Global_index32_control_set (int index32_control)
+{ 
+    GB_Global.index32_control = index32_control ;
+}
+
+int GB_Global_index32_control_get (void)
+{ 
+    return (GB_Global.index32_control) ;
+}
+
+//------------------------------------------------------------------------------
+// bitmap_pack_control
+//------------------------------------------------------------------------------
+
+void GB_Global_bitmap_pack_control_set (int bitmap_pack_control)
+{ 
+    GB_Global.bitmap_pack_control = bitmap_pack_control ;
+}
+
+int GB_Global_bitmap_pack_control_get (void)
+{ 
+    return (GB_Global.bitmap_pack_control) ;
+}
+
 //------------------------------------------------------------------------------
 // bitmap_switch
 //------------------------------------------------------------------------------
@@ -619,6 +763,261 @@ bool GB_Global_burble_get (void)
     return (GB_Global.burble) ;
 }
 
+//------------------------------------------------------------------------------
+// pattern_version: for detecting changes to the pattern of a matrix
+//------------------------------------------------------------------------------
+
+uint64_t GB_Global_pattern_version_next (void)
+{ 
+    uint64_t version ;
+    GB_ATOMIC_CAPTURE
+    version = ++(GB_Global.pattern_version) ;
+    return (version) ;
+}
+
+//------------------------------------------------------------------------------
+// first_touch, huge_pages, and numa_policy: for large blocks of memory
+//------------------------------------------------------------------------------
+
+void GB_Global_first_touch_set (bool first_touch)
+{ 
+    GB_Global.first_touch = first_touch ;
+}
+
+bool GB_Global_first_touch_get (void)
+{ 
+    return (GB_Global.first_touch) ;
+}
+
+void GB_Global_huge_pages_set (bool huge_pages)
+{ 
+    GB_Global.huge_pages = huge_pages ;
+}
+
+bool GB_Global_huge_pages_get (void)
+{ 
+    return (GB_Global.huge_pages) ;
+}
+
+void GB_Global_numa_policy_set (int numa_policy)
+{ 
+    GB_Global.numa_policy = numa_policy ;
+}
+
+int GB_Global_numa_policy_get (void)
+{ 
+    return (GB_Global.numa_policy) ;
+}
+
+//------------------------------------------------------------------------------
+// free_pool: for recycling workspace
+//------------------------------------------------------------------------------
+
+// Remove a block of size 2^k from the pool, or return NULL if the pool has no
+// such block.
+
+void *GB_Global_free_pool_get (int k)
+{
+    void *p = NULL ;
+    #pragma omp critical (GB_free_pool)
+    {
+        p = GB_Global.free_pool [k] ;
+        if (p != NULL)
+        { 
+            // remove the block from the front of the list
+            GB_Global.free_pool [k] = ((void **) p) [0] ;
+            GB_Global.free_pool_size -= ((int64_t) 1) << k ;
+            GB_Global.free_pool_hits++ ;
+        }
+        else
+        { 
+            GB_Global.free_pool_misses++ ;
+        }
+    }
+    return (p) ;
+}
+
+// Add a block of size 2^k to the pool, if the pool has room for it.  Returns
+// false if the pool is full, in which case the caller must free the block.
+
+bool GB_Global_free_pool_put (void *p, int k)
+{
+    bool ok = false ;
+    #pragma omp critical (GB_free_pool)
+    {
+        int64_t size = ((int64_t) 1) << k ;
+        if (GB_Global.free_pool_size + size <= GB_Global.free_pool_limit)
+        { 
+            // add the block to the front of the list
+            ((void **) p) [0] = GB_Global.free_pool [k] ;
+            GB_Global.free_pool [k] = p ;
+            GB_Global.free_pool_size += size ;
+            ok = true ;
+        }
+    }
+    return (ok) ;
+}
+
+// Free all blocks in the pool.
+
+void GB_Global_free_pool_dump (void)
+{
+    #pragma omp critical (GB_free_pool)
+    {
+        for (int k = 0 ; k < 64 ; k++)
+        {
+            void *p = GB_Global.free_pool [k] ;
+            while (p != NULL)
+            { 
+                void *next = ((void **) p) [0] ;
+                GB_Global_free_function (p) ;
+                p = next ;
+            }
+            GB_Global.free_pool [k] = NULL ;
+        }
+        GB_Global.free_pool_size = 0 ;
+    }
+}
+
+void GB_Global_free_pool_limit_set (int64_t limit)
+{ 
+    // free all blocks in the pool and reset the statistics
+    GB_Global_free_pool_dump ( ) ;
+    GB_Global.free_pool_limit = GB_IMAX (limit, 0) ;
+    GB_Global.free_pool_hits = 0 ;
+    GB_Global.free_pool_misses = 0 ;
+}
+
+int64_t GB_Global_free_pool_limit_get (void)
+{ 
+    return (GB_Global.free_pool_limit) ;
+}
+
+int64_t GB_Global_free_pool_hits_get (void)
+{ 
+    return (GB_Global.free_pool_hits) ;
+}
+
+int64_t GB_Global_free_pool_misses_get (void)
+{ 
+    return (GB_Global.free_pool_misses) ;
+}
+
+int64_t GB_Global_free_pool_size_get (void)
+{ 
+    return (GB_Global.free_pool_size) ;
+}
+
+//------------------------------------------------------------------------------
+// plan_cache: for reusing the saxpy3 tasks
+//------------------------------------------------------------------------------
+
+void GB_Global_plan_cache_set (bool plan_cache)
+{ 
+    GB_Global.plan_cache = plan_cache ;
+}
+
+bool GB_Global_plan_cache_get (void)
+{ 
+    return (GB_Global.plan_cache) ;
+}
+
+void GB_Global_plan_cache_hits_increment (void)
+{ 
+    GB_ATOMIC_UPDATE
+    GB_Global.plan_cache_hits++ ;
+}
+
+int64_t GB_Global_plan_cache_hits_get (void)
+{ 
+    return (GB_Global.plan_cache_hits) ;
+}
+
+void GB_Global_plan_cache_misses_increment (void)
+{ 
+    GB_ATOMIC_UPDATE
+    GB_Global.plan_cache_misses++ ;
+}
+
+int64_t GB_Global_plan_cache_misses_get (void)
+{ 
+    return (GB_Global.plan_cache_misses) ;
+}
+
+void GB_Global_plan_cache_stats_clear (void)
+{ 
+    GB_Global.plan_cache_hits = 0 ;
+    GB_Global.plan_cache_misses = 0 ;
+}
+
+//------------------------------------------------------------------------------
+// axb_cost: cost model for selecting the method for C=A*B
+//------------------------------------------------------------------------------
+
+void GB_Global_axb_cost_model_set (bool axb_cost_model)
+{ 
+    GB_Global.axb_cost_model = axb_cost_model ;
+}
+
+bool GB_Global_axb_cost_model_get (void)
+{ 
+    return (GB_Global.axb_cost_model) ;
+}
+
+void GB_Global_axb_cost_set (int k, double c)
+{ 
+    GB_Global.axb_cost [k] = c ;
+}
+
+double GB_Global_axb_cost_get (int k)
+{ 
+    return (GB_Global.axb_cost [k]) ;
+}
+
+void GB_Global_axb_cost_telemetry_set (double predicted, double actual)
+{ 
+    GB_Global.axb_cost_predicted = predicted ;
+    GB_Global.axb_cost_actual = actual ;
+}
+
+double GB_Global_axb_cost_predicted_get (void)
+{ 
+    return (GB_Global.axb_cost_predicted) ;
+}
+
+double GB_Global_axb_cost_actual_get (void)
+{ 
+    return (GB_Global.axb_cost_actual) ;
+}
+
+//------------------------------------------------------------------------------
+// build_sort: sorting method for GB_builder
+//------------------------------------------------------------------------------
+
+void GB_Global_build_sort_set (int build_sort)
+{ 
+    GB_Global.build_sort = build_sort ;
+}
+
+int GB_Global_build_sort_get (void)
+{ 
+    return (GB_Global.build_sort) ;
+}
+
+//------------------------------------------------------------------------------
+// pending_run_size: size of the sorted runs of pending tuples
+//------------------------------------------------------------------------------
+
+void GB_Global_pending_run_size_set (int64_t pending_run_size)
+{ 
+    GB_Global.pending_run_size = pending_run_size ;
+}
+
+int64_t GB_Global_pending_run_size_get (void)
+{ 
+    return (GB_Global.pending_run_size) ;
+}
+
 //------------------------------------------------------------------------------
 // for MATLAB interface only
 //------------------------------------------------------------------------------
@@ -34,6 +34,12 @@ GB_PUBLIC double   GB_Global_chunk_get (void) ;
 GB_PUBLIC void     GB_Global_hyper_switch_set (float hyper_switch) ;
 GB_PUBLIC float    GB_Global_hyper_switch_get (void) ;
 
+          void     GB_Global_index32_control_set (int index32_control) ;
+          int      GB_Global_index32_control_get (void) ;
+
+          void     GB_Global_bitmap_pack_control_set (int bitmap_pack_control);
+          int      GB_Global_bitmap_pack_control_get (void) ;
+
 GB_PUBLIC void     GB_Global_bitmap_switch_set (int k, float b) ;
 GB_PUBLIC float    GB_Global_bitmap_switch_get (int k) ;
 GB_PUBLIC float    GB_Global_bitmap_switch_matrix_get
@@ -80,12 +86,53 @@ GB_PUBLIC void     GB_Global_malloc_debug_count_set
                         (int64_t malloc_debug_count) ;
           bool     GB_Global_malloc_debug_count_decrement (void) ;
 
+          void     GB_Global_first_touch_set (bool first_touch) ;
+          bool     GB_Global_first_touch_get (void) ;
+          void     GB_Global_huge_pages_set (bool huge_pages) ;
+          bool     GB_Global_huge_pages_get (void) ;
+          void     GB_Global_numa_policy_set (int numa_policy) ;
+          int      GB_Global_numa_policy_get (void) ;
+
+          void *   GB_Global_free_pool_get (int k) ;
+          bool     GB_Global_free_pool_put (void *p, int k) ;
+          void     GB_Global_free_pool_dump (void) ;
+          void     GB_Global_free_pool_limit_set (int64_t limit) ;
+          int64_t  GB_Global_free_pool_limit_get (void) ;
+          int64_t  GB_Global_free_pool_hits_get (void) ;
+          int64_t  GB_Global_free_pool_misses_get (void) ;
+          int64_t  GB_Global_free_pool_size_get (void) ;
+
 GB_PUBLIC void     GB_Global_hack_set (int64_t hack) ;
 GB_PUBLIC int64_t  GB_Global_hack_get (void) ;
 
           void     GB_Global_burble_set (bool burble) ;
 GB_PUBLIC bool     GB_Global_burble_get (void) ;
 
+          uint64_t GB_Global_pattern_version_next (void) ;
+
+          void     GB_Global_plan_cache_set (bool plan_cache) ;
+          bool     GB_Global_plan_cache_get (void) ;
+          void     GB_Global_plan_cache_hits_increment (void) ;
+          int64_t  GB_Global_plan_cache_hits_get (void) ;
+          void     GB_Global_plan_cache_misses_increment (void) ;
+          int64_t  GB_Global_plan_cache_misses_get (void) ;
+          void     GB_Global_plan_cache_stats_clear (void) ;
+
+          void     GB_Global_axb_cost_model_set (bool axb_cost_model) ;
+          bool     GB_Global_axb_cost_model_get (void) ;
+          void     GB_Global_axb_cost_set (int k, double c) ;
+          double   GB_Global_axb_cost_get (int k) ;
+          void     GB_Global_axb_cost_telemetry_set
+                        (double predicted, double actual) ;
+          double   GB_Global_axb_cost_predicted_get (void) ;
+          double   GB_Global_axb_cost_actual_get (void) ;
+
+          void     GB_Global_build_sort_set (int build_sort) ;
+          int      GB_Global_build_sort_get (void) ;
+
+          void     GB_Global_pending_run_size_set (int64_t pending_run_size) ;
+          int64_t  GB_Global_pending_run_size_get (void) ;
+
 GB_PUBLIC void     GB_Global_print_one_based_set (bool onebased) ;
 GB_PUBLIC bool     GB_Global_print_one_based_get (void) ;
 
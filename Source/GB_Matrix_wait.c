@@ -15,7 +15,9 @@
 // The matrix A has zombies and/or pending tuples placed there by
 // GrB_setElement, GrB_*assign, or GB_mxm.  Zombies must now be deleted, and
 // pending tuples must now be assembled together and added into the matrix.
-// The indices in A might also be jumbled; if so, they are sorted now.
+// The indices in A might also be jumbled; if so, they are sorted now.  If the
+// pattern of A is held in 32-bit integers, it is converted to 64-bit integers,
+// and if A is a packed bitmap, it is unpacked.
 
 // When the function returns, and all pending tuples and zombies have been
 // deleted.  This is true even the function fails due to lack of memory (in
@@ -37,6 +39,7 @@
 #include "GB_Pending.h"
 #include "GB_build.h"
 #include "GB_jappend.h"
+#include "GB_iso.h"
 
 #define GB_FREE_ALL                     \
 {                                       \
@@ -65,7 +68,9 @@ GrB_Info GB_Matrix_wait         // finish all pending computations
 
     if (GB_IS_FULL (A) || GB_IS_BITMAP (A))
     { 
-        // full and bitmap matrices never have any pending work
+        // full and bitmap matrices never have any pending work, but a packed
+        // bitmap is unpacked
+        GB_OK (GB_convert_packed_to_bitmap (A, Context)) ;
         ASSERT (!GB_ZOMBIES (A)) ;
         ASSERT (!GB_JUMBLED (A)) ;
         ASSERT (!GB_PENDING (A)) ;
@@ -80,6 +85,13 @@ GrB_Info GB_Matrix_wait         // finish all pending computations
     ASSERT (GB_JUMBLED_OK (A)) ;
     ASSERT (GB_PENDING_OK (A)) ;
 
+    //--------------------------------------------------------------------------
+    // hold the pattern of A in 64-bit integers
+    //--------------------------------------------------------------------------
+
+    // A matrix with 32-bit integers has no other pending work.
+    GB_OK (GB_convert_int32_to_int64 (A, Context)) ;
+
     //--------------------------------------------------------------------------
     // get the zombie and pending count, and burble if work needs to be done
     //--------------------------------------------------------------------------
@@ -91,6 +103,9 @@ GrB_Info GB_Matrix_wait         // finish all pending computations
         GB_BURBLE_MATRIX (A, "(wait: " GBd " %s, " GBd " pending%s) ",
             nzombies, (nzombies == 1) ? "zombie" : "zombies", npending,
             A->jumbled ? ", jumbled" : "") ;
+        GB_PATTERN_CHANGED (A) ;
+        // A is modified in-place below, so a shallow A must be copied first
+        GB_OK (GB_unshallow (A, Context)) ;
     }
 
     //--------------------------------------------------------------------------
@@ -99,6 +114,23 @@ GrB_Info GB_Matrix_wait         // finish all pending computations
 
     GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
 
+    //--------------------------------------------------------------------------
+    // expand A if it is iso and has zombies or pending tuples
+    //--------------------------------------------------------------------------
+
+    // If A has zombies but no pending tuples, its remaining entries all have
+    // the same value, and A is made iso again when its zombies are deleted.
+
+    const size_t zsize = A->type->size ;
+    GB_void A_iso_value [GB_VLA(zsize)] ;
+    bool A_iso = A->iso && (nzombies > 0 || npending > 0) ;
+    if (A_iso)
+    { 
+        memcpy (A_iso_value, A->x, zsize) ;
+        GB_OK (GB_iso_expand (A, Context)) ;
+        A_iso = (npending == 0) ;
+    }
+
     //--------------------------------------------------------------------------
     // assemble the pending tuples into T
     //--------------------------------------------------------------------------
@@ -117,6 +149,17 @@ GrB_Info GB_Matrix_wait         // finish all pending computations
         // z=accum(x,y) operator can have any types, and it does not have to be
         // associative.
 
+        if (A->Pending->nruns > 0)
+        { 
+            // The pending tuples are held in sorted runs.  Sort the open run
+            // and merge all the runs into one, so that GB_builder need not
+            // sort the tuples.  If this runs out of memory, A->Pending->sorted
+            // remains false and GB_builder sorts the tuples instead.
+            int nthreads = GB_nthreads (npending, chunk, nthreads_max) ;
+            GBURBLE ("(merge runs) ") ;
+            GB_Pending_merge (A->Pending, true, nthreads) ;
+        }
+
         info = GB_builder
         (
             &T,                     // create T
@@ -228,6 +271,10 @@ GrB_Info GB_Matrix_wait         // finish all pending computations
     if (npending == 0)
     { 
         // conform A to its desired sparsity structure and return result
+        if (A_iso)
+        { 
+            GB_OK (GB_iso_compress (A, A_iso_value, Context)) ;
+        }
         info = GB_conform (A, Context) ;
         #pragma omp flush
         return (info) ;
@@ -319,7 +366,8 @@ GrB_Info GB_Matrix_wait         // finish all pending computations
         // make sure A has enough space for the new tuples
         if (anz_new > A->nzmax)
         { 
-            // double the size if not enough space
+            // use the space already allocated in A->i and A->x if it is large
+            // enough, or double the size if not
             GB_OK (GB_ix_resize (A, anz_new, Context)) ;
             Ai = A->i ;
             Ax = (GB_void *) A->x ;
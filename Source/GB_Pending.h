@@ -35,6 +35,13 @@ void GB_Pending_free        // free a list of pending tuples
     GB_Pending *PHandle
 ) ;
 
+bool GB_Pending_merge           // sort and merge the runs of pending tuples
+(
+    GB_Pending Pending,         // list of pending tuples
+    bool all,                   // if true, merge all the runs into one
+    int nthreads                // # of threads to use to sort the open run
+) ;
+
 //------------------------------------------------------------------------------
 // GB_Pending_ensure: make sure the list of pending tuples is large enough
 //------------------------------------------------------------------------------
@@ -137,6 +144,17 @@ static inline bool GB_Pending_add   // add a tuple to the list
     memcpy (Pending_x +(n*size), scalar, size) ;
     Pending->n++ ;
 
+    //--------------------------------------------------------------------------
+    // sort the open run if it is full, and merge it with the prior runs
+    //--------------------------------------------------------------------------
+
+    if (Pending->run_size > 0 &&
+        Pending->n - Pending->run [Pending->nruns] >= Pending->run_size)
+    { 
+        // if out of memory, the run is left open, and sorted by GB_builder
+        GB_Pending_merge (Pending, false, 1) ;
+    }
+
     return (true) ;     // success
 }
 
@@ -48,6 +48,9 @@ bool GB_Pending_alloc       // create a list of pending tuples
     Pending->type = type ;              // type of pending tuples
     Pending->size = type->size ;        // size of pending tuple type
     Pending->op = op ;                  // pending operator (NULL is OK)
+    Pending->run_size = GB_Global_pending_run_size_get ( ) ;
+    Pending->nruns = 0 ;                // no sorted runs yet
+    Pending->run [0] = 0 ;
 
     Pending->i = GB_MALLOC (nmax, int64_t) ;
 
@@ -0,0 +1,286 @@
+//------------------------------------------------------------------------------
+// GB_Pending_merge: sort and merge the runs of a list of pending tuples
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If the GxB_PENDING_RUN_SIZE option is nonzero, the pending tuples of a
+// matrix are kept as a log-structured list: a sequence of sorted runs,
+// Pending->run [0..nruns], followed by an open run of tuples in the order they
+// were added.  When the open run reaches Pending->run_size tuples,
+// GB_Pending_add calls GB_Pending_merge (Pending, false, 1) to sort the open
+// run and close it, and to then merge the last two runs for as long as the
+// next-to-last run is no more than twice the size of the last one.  The runs
+// thus decrease geometrically in size, and each tuple is moved O(log
+// (n/run_size)) times for a list of n tuples, spread across the calls to
+// GrB_setElement.  GB_Matrix_wait calls GB_Pending_merge (Pending, true,
+// nthreads) to sort the open run and to merge all the runs into one in O(n)
+// time, so that GB_builder need not sort the tuples.
+
+// Duplicates are not assembled here.  The sort and the merges are stable, so
+// GB_builder assembles the duplicates in the order they were added, as if the
+// tuples had not been sorted.  On input and output, Pending->sorted is true if
+// the whole list is sorted.
+
+// Returns false if out of memory.  The list is still valid in that case, but
+// the open run may not be sorted, or the runs not fully merged.
+
+#include "GB_Pending.h"
+#include "GB_sort.h"
+
+// true if tuple p is no larger than tuple q, in (j,i) order
+#define GB_PENDING_LE(p,q)                                                  \
+    ((Pj == NULL) ? (Pi [p] <= Pi [q]) :                                    \
+    ((Pj [p] < Pj [q]) || (Pj [p] == Pj [q] && Pi [p] <= Pi [q])))
+
+//------------------------------------------------------------------------------
+// GB_Pending_sort_run: sort the open run of pending tuples
+//------------------------------------------------------------------------------
+
+static bool GB_Pending_sort_run
+(
+    GB_Pending Pending,
+    int nthreads
+)
+{
+
+    int64_t *GB_RESTRICT Pi = Pending->i ;
+    int64_t *GB_RESTRICT Pj = Pending->j ;
+    GB_void *GB_RESTRICT Px = Pending->x ;
+    size_t size = Pending->size ;
+    int64_t pstart = Pending->run [Pending->nruns] ;
+    int64_t len = Pending->n - pstart ;
+
+    //--------------------------------------------------------------------------
+    // quick return if the run is already sorted
+    //--------------------------------------------------------------------------
+
+    bool sorted = true ;
+    for (int64_t p = pstart + 1 ; sorted && p < Pending->n ; p++)
+    {
+        sorted = GB_PENDING_LE (p-1, p) ;
+    }
+    if (sorted)
+    {
+        return (true) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // sort the (j,i,k) tuples, where k is the position of each tuple in the run
+    //--------------------------------------------------------------------------
+
+    // The keys are unique, so the sort is stable.
+    int64_t *GB_RESTRICT K = GB_MALLOC_POOL (len, int64_t) ;
+    GB_void *GB_RESTRICT W = GB_MALLOC_POOL (len * size, GB_void) ;
+    GrB_Info info = GrB_OUT_OF_MEMORY ;
+    if (K != NULL && W != NULL)
+    {
+        int64_t k ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < len ; k++)
+        {
+            K [k] = k ;
+        }
+        if (Pj == NULL)
+        {
+            info = GB_msort_2b (Pi + pstart, K, len, nthreads) ;
+        }
+        else
+        {
+            info = GB_msort_3b (Pj + pstart, Pi + pstart, K, len, nthreads) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // permute the values
+    //--------------------------------------------------------------------------
+
+    if (info == GrB_SUCCESS)
+    {
+        int64_t k ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < len ; k++)
+        {
+            memcpy (W + k * size, Px + (pstart + K [k]) * size, size) ;
+        }
+        GB_memcpy (Px + pstart * size, W, len * size, nthreads) ;
+    }
+
+    GB_FREE_POOL (K) ;
+    GB_FREE_POOL (W) ;
+    return (info == GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_Pending_merge_last: merge the last two sorted runs
+//------------------------------------------------------------------------------
+
+static bool GB_Pending_merge_last
+(
+    GB_Pending Pending
+)
+{
+
+    int64_t *GB_RESTRICT Pi = Pending->i ;
+    int64_t *GB_RESTRICT Pj = Pending->j ;
+    GB_void *GB_RESTRICT Px = Pending->x ;
+    size_t size = Pending->size ;
+    int r = Pending->nruns ;
+    int64_t pa = Pending->run [r-2] ;
+    int64_t pb = Pending->run [r-1] ;
+    int64_t pc = Pending->run [r] ;
+
+    if (!GB_PENDING_LE (pb-1, pb))
+    {
+
+        //----------------------------------------------------------------------
+        // skip the leading tuples of the first run that precede the second
+        //----------------------------------------------------------------------
+
+        // find the first tuple pa in the first run larger than tuple pb; the
+        // last tuple of the first run is larger than tuple pb
+        int64_t pright = pb - 1 ;
+        while (pa < pright)
+        {
+            int64_t pmiddle = (pa + pright) / 2 ;
+            if (GB_PENDING_LE (pmiddle, pb))
+            {
+                pa = pmiddle + 1 ;
+            }
+            else
+            {
+                pright = pmiddle ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // merge Pending [pa:pb-1] and Pending [pb:pc-1] into W
+        //----------------------------------------------------------------------
+
+        int64_t len = pc - pa ;
+        int64_t *GB_RESTRICT Wi = GB_MALLOC_POOL (len, int64_t) ;
+        int64_t *GB_RESTRICT Wj = NULL ;
+        GB_void *GB_RESTRICT Wx = GB_MALLOC_POOL (len * size, GB_void) ;
+        if (Pj != NULL)
+        {
+            Wj = GB_MALLOC_POOL (len, int64_t) ;
+        }
+        if (Wi == NULL || Wx == NULL || (Pj != NULL && Wj == NULL))
+        {
+            // out of memory
+            GB_FREE_POOL (Wi) ;
+            GB_FREE_POOL (Wj) ;
+            GB_FREE_POOL (Wx) ;
+            return (false) ;
+        }
+
+        int64_t p1 = pa, p2 = pb, k = 0 ;
+        while (p1 < pb)
+        {
+            // take the tuple from the first run if tied, so the merge is
+            // stable.  Once the first run is exhausted, the rest of the
+            // second run is already in place.
+            int64_t p = (p2 >= pc || GB_PENDING_LE (p1, p2)) ? (p1++) : (p2++) ;
+            Wi [k] = Pi [p] ;
+            if (Pj != NULL)
+            {
+                Wj [k] = Pj [p] ;
+            }
+            memcpy (Wx + k * size, Px + p * size, size) ;
+            k++ ;
+        }
+
+        memcpy (Pi + pa, Wi, k * sizeof (int64_t)) ;
+        if (Pj != NULL)
+        {
+            memcpy (Pj + pa, Wj, k * sizeof (int64_t)) ;
+        }
+        memcpy (Px + pa * size, Wx, k * size) ;
+
+        GB_FREE_POOL (Wi) ;
+        GB_FREE_POOL (Wj) ;
+        GB_FREE_POOL (Wx) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // the last two runs are now one
+    //--------------------------------------------------------------------------
+
+    Pending->run [r-1] = pc ;
+    Pending->nruns-- ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_Pending_merge
+//------------------------------------------------------------------------------
+
+bool GB_Pending_merge           // sort and merge the runs of pending tuples
+(
+    GB_Pending Pending,         // list of pending tuples
+    bool all,                   // if true, merge all the runs into one
+    int nthreads                // # of threads to use to sort the open run
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (Pending != NULL) ;
+    int64_t *GB_RESTRICT Pi = Pending->i ;
+    int64_t *GB_RESTRICT Pj = Pending->j ;
+    int64_t n = Pending->n ;
+    bool ok = true ;
+
+    //--------------------------------------------------------------------------
+    // sort the open run and close it
+    //--------------------------------------------------------------------------
+
+    if (Pending->run [Pending->nruns] < n && Pending->nruns < GB_PENDING_MAXRUNS)
+    {
+        // if the whole list is sorted, so is the open run
+        ok = Pending->sorted || GB_Pending_sort_run (Pending, nthreads) ;
+        if (ok)
+        {
+            Pending->nruns++ ;
+            Pending->run [Pending->nruns] = n ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // merge the runs
+    //--------------------------------------------------------------------------
+
+    while (ok && Pending->nruns >= 2)
+    {
+        int r = Pending->nruns ;
+        int64_t pb = Pending->run [r-1] ;
+        int64_t n1 = pb - Pending->run [r-2] ;
+        int64_t n2 = Pending->run [r] - pb ;
+        // the last two runs are always merged if they are already in order,
+        // so that a list with two or more runs is never sorted
+        if (all || n1 <= 2 * n2 || GB_PENDING_LE (pb-1, pb))
+        {
+            ok = GB_Pending_merge_last (Pending) ;
+        }
+        else
+        {
+            break ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // the whole list is sorted if it is a single run
+    //--------------------------------------------------------------------------
+
+    if (Pending->nruns == 1 && Pending->run [1] == n)
+    {
+        Pending->sorted = true ;
+    }
+    return (ok) ;
+}
+
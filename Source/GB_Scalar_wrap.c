@@ -50,12 +50,28 @@ GxB_Scalar GB_Scalar_wrap   // create a new GxB_Scalar with one entry
     s->Pending = NULL ;
     s->nzombies = 0 ;
     s->jumbled = false ;
+    s->iso = false ;
     s->p_shallow = false ;
     s->h_shallow = false ;
     s->b_shallow = false ;
     s->i_shallow = false ;
     s->x_shallow = true ;
+    s->p_is_32 = false ;
+    s->h_is_32 = false ;
+    s->i_is_32 = false ;
+    s->index32_control = GxB_INDEX32_NEVER ;
+    s->b_is_packed = false ;
+    s->bitmap_pack_control = GxB_BITMAP_PACK_NEVER ;
+    s->p_size = 0 ;
+    s->h_size = 0 ;
+    s->b_size = 0 ;
+    s->i_size = 0 ;
+    s->x_size = 0 ;             // s->x is shallow
+    s->mmap_base = NULL ;
+    s->mmap_size = 0 ;
+    s->mmap_shallow = false ;
     s->is_csc = true ;
+    GB_PATTERN_CHANGED (s) ;
     // #include "GB_Scalar_wrap_mkl_template.c"
 
     //--------------------------------------------------------------------------
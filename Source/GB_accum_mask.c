@@ -50,6 +50,7 @@
 #include "GB_transpose.h"
 #include "GB_accum_mask.h"
 #include "GB_bitmap_assign.h"
+#include "GB_iso.h"
 
 /* -----------------------------------------------------------------------------
 
@@ -115,6 +116,7 @@
 {                                   \
     GB_Matrix_free (Thandle) ;      \
     GB_Matrix_free (&MT) ;          \
+    GB_Matrix_free (&M2) ;          \
     GB_Matrix_free (&Z) ;           \
 }
 
@@ -146,7 +148,9 @@ GrB_Info GB_accum_mask          // C<M> = accum (C,T)
     GrB_Info info ;
     GrB_Matrix T = *Thandle ;
     GrB_Matrix MT = NULL ;
+    GrB_Matrix M2 = NULL ;
     GrB_Matrix M = M_in ;
+    bool M_struct = Mask_struct ;
     GrB_Matrix Z = NULL ;
 
     ASSERT_MATRIX_OK (C, "C input for C<M>=accum(C,T)", GB0) ;
@@ -180,6 +184,11 @@ GrB_Info GB_accum_mask          // C<M> = accum (C,T)
     ASSERT (!GB_ZOMBIES (T)) ;
     ASSERT (GB_JUMBLED_OK (T)) ;
 
+    // C is modified below, so its pattern is held in 64-bit integers, and its
+    // bitmap is unpacked
+    GB_OK (GB_convert_int32_to_int64 (C, Context)) ;
+    GB_OK (GB_convert_packed_to_bitmap (C, Context)) ;
+
     //--------------------------------------------------------------------------
     // ensure M and T have the same CSR/CSC format as C
     //--------------------------------------------------------------------------
@@ -211,14 +220,15 @@ GrB_Info GB_accum_mask          // C<M> = accum (C,T)
         // that C and M are not aliased.
 
         // MT = M' to conform M to the same CSR/CSC format as C.
-        // transpose: typecast, no op, not in-place
+        // transpose: typecast, no op, not in-place; pattern only if the
+        // mask is structural
         if (MT_in == NULL)
         { 
             // remove zombies and pending tuples from M.  M can be jumbled.
             GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (M) ;
             ASSERT (GB_JUMBLED_OK (M)) ;
-            GB_OK (GB_transpose (&MT, GrB_BOOL, C->is_csc, M,
-                NULL, NULL, NULL, false, Context)) ;
+            GB_OK (GB_transpose_cast (&MT, GrB_BOOL, C->is_csc, M,
+                Mask_struct, Context)) ;
             // use the transpose mask
             M = MT ;
             ASSERT (GB_JUMBLED_OK (M)) ;
@@ -235,6 +245,22 @@ GrB_Info GB_accum_mask          // C<M> = accum (C,T)
         }
     }
 
+    //--------------------------------------------------------------------------
+    // expand iso matrices if their values are needed
+    //--------------------------------------------------------------------------
+
+    // If T is iso, it remains iso only if it is transplanted into C.
+    // Otherwise, T is expanded, and C is expanded since its values are used.
+    // An iso mask M is either used as structural, or expanded into M2.
+
+    GB_OK (GB_iso_mask (&M2, &M_struct, M, Context)) ;
+    if (M2 != NULL) M = M2 ;
+    if (M != NULL || accum != NULL)
+    { 
+        GB_OK (GB_iso_expand (T, Context)) ;
+        GB_OK (GB_iso_expand (C, Context)) ;
+    }
+
     // T and M now conform to the dimensions and CSR/CSC format of C
     ASSERT (C->vlen == T->vlen && C->vdim == T->vdim) ;
     ASSERT (C->is_csc == T->is_csc) ;
@@ -345,7 +371,7 @@ GrB_Info GB_accum_mask          // C<M> = accum (C,T)
         // C(:,:)<M> = accum (C(:,:),T) via GB_subassign
         //----------------------------------------------------------------------
 
-        GB_OK (GB_subassign (C, C_replace, M, Mask_comp, Mask_struct,
+        GB_OK (GB_subassign (C, C_replace, M, Mask_comp, M_struct,
             false, accum, T, false, GrB_ALL, 0, GrB_ALL, 0,
             false, NULL, GB_ignore_code, Context)) ;
 
@@ -403,7 +429,7 @@ GrB_Info GB_accum_mask          // C<M> = accum (C,T)
             // flag from GB_add.
             bool ignore ;
             GB_OK (GB_add (&Z, C->type, C->is_csc, (apply_mask) ? M : NULL,
-                Mask_struct, Mask_comp, &ignore, C, T, accum, Context)) ;
+                M_struct, Mask_comp, &ignore, C, T, accum, Context)) ;
             GB_Matrix_free (Thandle) ;
         }
 
@@ -419,7 +445,7 @@ GrB_Info GB_accum_mask          // C<M> = accum (C,T)
         //----------------------------------------------------------------------
 
         ASSERT_MATRIX_OK (C, "C<M>=Z input", GB0) ;
-        GB_OK (GB_mask (C, M, &Z, C_replace, Mask_comp, Mask_struct, Context)) ;
+        GB_OK (GB_mask (C, M, &Z, C_replace, Mask_comp, M_struct, Context)) ;
         ASSERT (Z == NULL) ;
     }
 
@@ -147,11 +147,17 @@ GrB_Info GB_add_phase2      // C=A+B, C<M>=A+B, or C<!M>=A+B
     int64_t cnz = (C_is_sparse_or_hyper) ? Cp [Cnvec] : (A->vlen*A->vdim) ;
     (*Chandle) = NULL ;
 
+    // If C is bitmap, the kernels write all of C->b, except when the sparse
+    // mask M is scattered into C->b.  Only in that case must C->b be calloc'd.
+    bool C_bitmap_calloc = (M != NULL) &&
+        (GB_IS_SPARSE (M) || GB_IS_HYPERSPARSE (M)) ;
+
     // allocate the result C (but do not allocate C->p or C->h)
     GrB_Matrix C = NULL ;
     GrB_Info info = GB_new_bix (&C, // any sparsity, new header
         ctype, A->vlen, A->vdim, GB_Ap_null, C_is_csc,
-        C_sparsity, true, A->hyper_switch, Cnvec, cnz, true, Context) ;
+        C_sparsity, C_bitmap_calloc, A->hyper_switch, Cnvec, cnz, true,
+        Context) ;
     if (info != GrB_SUCCESS)
     { 
         // out of memory; caller must free C_to_M, C_to_A, C_to_B
@@ -165,12 +171,14 @@ GrB_Info GB_add_phase2      // C=A+B, C<M>=A+B, or C<!M>=A+B
     {
         C->nvec_nonempty = Cnvec_nonempty ;
         C->p = (int64_t *) Cp ;
+        C->p_size = (Cnvec+1) * sizeof (int64_t) ;
     }
 
     // add Ch as the hypersparse list for C, from GB_add_phase0
     if (C_is_hyper)
     { 
         C->h = (int64_t *) Ch ;
+        C->h_size = Cnvec * sizeof (int64_t) ;
         C->nvec = Cnvec ;
     }
 
@@ -14,6 +14,7 @@
 #include "GB_apply.h"
 #include "GB_transpose.h"
 #include "GB_accum_mask.h"
+#include "GB_iso.h"
 
 #define GB_FREE_ALL ;
 
@@ -276,10 +277,17 @@ GrB_Info GB_apply                   // C<M> = accum (C, op(A)) or op(A')
         GBURBLE ("(inplace-op) ") ;
         // C = op (C), operating on the values in-place, with no typecasting
         // of the output of the operator with the matrix C.
-        // No work to do if the op is identity.
+        // No work to do if the op is identity, or if C has no entries.
         // FUTURE::: also handle C += op(C), with accum.
-        if (opcode != GB_IDENTITY_opcode)
+        if (opcode != GB_IDENTITY_opcode && GB_NNZ_HELD (C) > 0)
         { 
+            // the values of a shallow C are owned by the user application
+            GB_OK (GB_unshallow (C, Context)) ;
+            // a positional op needs all the values of an iso C
+            if (GB_OPCODE_IS_POSITIONAL (opcode))
+            { 
+                GB_OK (GB_iso_expand (C, Context)) ;
+            }
             // the output Cx is aliased with C->x in GB_apply_op.
             GB_void *Cx = (GB_void *) C->x ;
             info = GB_apply_op (Cx, op1, op2,   // op1 != identity
@@ -11,6 +11,9 @@
 
 // Cx and A->x may be aliased.
 
+// If A is iso and the operator is not positional, only Cx [0] = op (A->x [0])
+// is computed, and Cx need only have size 1.
+
 // This function is CSR/CSC agnostic.  For positional ops, A is treated as if
 // it is in CSC format.  The caller has already modified the op if A is in CSR
 // format.
@@ -55,10 +58,13 @@ GrB_Info GB_apply_op                // apply a unary operator, Cx = op (A)
     // A->x is not const since the operator might be applied in-place, if
     // C is aliased to C.
 
+    GB_Opcode opcode = (op1 != NULL) ? op1->opcode : op2->opcode ;
+    const bool A_iso = A->iso && !GB_OPCODE_IS_POSITIONAL (opcode) ;
+
     GB_void *Ax = (GB_void *) A->x ;        // A->x has type A->type
-    const int8_t  *Ab = A->b ;              // only if A is bitmap
+    const int8_t  *Ab = A_iso ? NULL : A->b ;   // only if A is bitmap
     const GrB_Type Atype = A->type ;        // type of A->x
-    const int64_t anz = GB_NNZ_HELD (A) ;   // size of A->x and Cx
+    const int64_t anz = A_iso ? 1 : GB_NNZ_HELD (A) ; // size of A->x and Cx
 
     //--------------------------------------------------------------------------
     // determine the maximum number of threads to use
@@ -70,8 +76,6 @@ GrB_Info GB_apply_op                // apply a unary operator, Cx = op (A)
     // apply the operator
     //--------------------------------------------------------------------------
 
-    GB_Opcode opcode = (op1 != NULL) ? op1->opcode : op2->opcode ;
-
     if (GB_OPCODE_IS_POSITIONAL (opcode))
     {
 
@@ -104,7 +108,7 @@ GrB_Info GB_apply_op                // apply a unary operator, Cx = op (A)
         //----------------------------------------------------------------------
 
         int nthreads = GB_nthreads (anz + anvec, chunk, nthreads_max) ;
-        int ntasks = (nthreads == 1) ? 1 : (32 * nthreads) ;
+        int ntasks = (nthreads == 1) ? 1 : (GB_NUMA_NTASKS (32) * nthreads) ;
 
         //----------------------------------------------------------------------
         // Cx = positional_op (A)
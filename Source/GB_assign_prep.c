@@ -661,9 +661,9 @@ GrB_Info GB_assign_prep
     if (!scalar_expansion && A_transpose)
     { 
         // AT = A', with no typecasting
-        // transpose: no typecast, no op, not in-place
-        // TODO: if accum is present and it does not depend on the values of
-        // A,  only construct the pattern of AT, not the values.
+        // transpose: no typecast, no op, not in-place.  The values of AT are
+        // always needed, even if accum does not depend on them, since any
+        // entry in AT not in C is copied into C.
         GBURBLE ("(A transpose) ") ;
         GB_OK (GB_transpose (&AT, NULL, C_is_csc, A,
             NULL, NULL, NULL, false, Context)) ;
@@ -693,11 +693,11 @@ GrB_Info GB_assign_prep
         { 
             // MT = M' to conform M to the same CSR/CSC format as C,
             // and typecast to boolean.
-            // transpose: typecast, no op, not in-place
-            // TODO: if Mask_struct, only construct the pattern of MT
+            // transpose: typecast, no op, not in-place.  If the mask is
+            // structural, only the pattern of MT is constructed.
             GBURBLE ("(M transpose) ") ;
-            GB_OK (GB_transpose (&MT, GrB_BOOL, C_is_csc, M,
-                NULL, NULL, NULL, false, Context)) ;
+            GB_OK (GB_transpose_cast (&MT, GrB_BOOL, C_is_csc, M, Mask_struct,
+                Context)) ;
             GB_MATRIX_WAIT (MT) ;       // M cannot be jumbled
             M = MT ;
         }
@@ -92,7 +92,7 @@ GrB_Info GB_assign_zombie5
     const int64_t znz = GB_NNZ_HELD (C) ;
     GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
     int nthreads = GB_nthreads (znz, chunk, nthreads_max) ;
-    int ntasks = (nthreads == 1) ? 1 : (64 * nthreads) ;
+    int ntasks = (nthreads == 1) ? 1 : (GB_NUMA_NTASKS (64) * nthreads) ;
 
     //--------------------------------------------------------------------------
     // slice the entries for each task
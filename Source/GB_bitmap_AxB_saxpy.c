@@ -8,6 +8,7 @@
 //------------------------------------------------------------------------------
 
 #include "GB_bitmap_AxB_saxpy.h"
+#include "GB_bitmap_assign_methods.h"
 #ifndef GBCOMPACT
 #include "GB_AxB__include.h"
 #endif
@@ -21,13 +22,19 @@
 // GB_bitmap_AxB_saxpy: compute C=A*B, C<M>=A*B, or C<!M>=A*B
 //------------------------------------------------------------------------------
 
-// TODO: also pass in the user's C and the accum operator, and done_in_place,
-// like GB_AxB_dot4.
+// If C_in is present, the result is computed in-place, like GB_AxB_dot4, and
+// no new matrix is allocated.  The caller (GB_AxB_meta) ensures that C_in is
+// bitmap or full, that its type matches the monoid, and that the accum
+// operator is either the monoid (C_in<#M>+=A*B, with C_replace false), or
+// not present.  In the latter case, the prior content of C_in is not needed
+// (there is no mask, or C_in has no entries), and C_in is cleared first.
 
 GB_PUBLIC                           // for testing only
 GrB_Info GB_bitmap_AxB_saxpy        // C = A*B where C is bitmap or full
 (
-    GrB_Matrix *Chandle,            // output matrix (not computed in-place)
+    GrB_Matrix *Chandle,            // output matrix, if not done in-place
+    GrB_Matrix C_in,                // input/output matrix, if done in-place
+    const GrB_BinaryOp accum,       // accum for C_in+=A*B, or NULL if C_in=A*B
     const int C_sparsity,
     const GrB_Matrix M,             // optional mask matrix
     const bool Mask_comp,           // if true, use !M
@@ -37,6 +44,7 @@ GrB_Info GB_bitmap_AxB_saxpy        // C = A*B where C is bitmap or full
     const GrB_Semiring semiring,    // semiring that defines C=A*B
     const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
     bool *mask_applied,             // mask always applied if present
+    bool *done_in_place,            // if true, C_in was computed in-place
     GB_Context Context
 )
 {
@@ -48,9 +56,15 @@ GrB_Info GB_bitmap_AxB_saxpy        // C = A*B where C is bitmap or full
     GrB_Info info ;
 
     (*mask_applied) = false ;
+    (*done_in_place) = false ;
     ASSERT (Chandle != NULL) ;
     ASSERT (*Chandle == NULL) ;
 
+    ASSERT_MATRIX_OK_OR_NULL (C_in, "C_in for bitmap saxpy A*B", GB0) ;
+    ASSERT (C_in == NULL || GB_IS_BITMAP (C_in) || GB_IS_FULL (C_in)) ;
+    ASSERT (C_in == NULL || C_in->type == semiring->add->op->ztype) ;
+    ASSERT (C_in == NULL || accum == NULL || accum == semiring->add->op) ;
+
     ASSERT_MATRIX_OK_OR_NULL (M, "M for bitmap saxpy A*B", GB0) ;
     ASSERT (!GB_PENDING (M)) ;
     ASSERT (GB_JUMBLED_OK (M)) ;
@@ -75,9 +89,6 @@ GrB_Info GB_bitmap_AxB_saxpy        // C = A*B where C is bitmap or full
     // construct C
     //--------------------------------------------------------------------------
 
-    // TODO: If C is the right type on input, and accum is the same as the
-    // monoid, then do not create C, but compute in-place instead.
-
     GrB_Type ctype = semiring->add->op->ztype ;
     int64_t cnzmax ;
     bool ok = GB_Index_multiply ((GrB_Index *) &cnzmax, A->vlen, B->vdim) ;
@@ -86,10 +97,36 @@ GrB_Info GB_bitmap_AxB_saxpy        // C = A*B where C is bitmap or full
         // problem too large
         return (GrB_OUT_OF_MEMORY) ;
     }
-    GB_OK (GB_new_bix (Chandle, ctype, A->vlen, B->vdim, GB_Ap_null, true,
-        C_sparsity, true, GB_HYPER_SWITCH_DEFAULT, -1, cnzmax, true, Context)) ;
-    GrB_Matrix C = *Chandle ;
-    C->magic = GB_MAGIC ;
+
+    GrB_Matrix C = NULL ;
+    if (C_in != NULL)
+    {
+        // compute C_in<#M>+=A*B or C_in=A*B in-place
+        ASSERT (C_in->vlen == A->vlen && C_in->vdim == B->vdim) ;
+        if (GB_IS_FULL (C_in))
+        { 
+            // all entries of C_in are present; the bitmap is all ones
+            GB_OK (GB_convert_full_to_bitmap (C_in, Context)) ;
+        }
+        C = C_in ;
+        if (accum == NULL && C->nvals > 0)
+        { 
+            // C_in=A*B: the prior entries of C_in are discarded
+            GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+            GB_memset (C->b, 0, cnzmax, nthreads_max) ;
+            C->nvals = 0 ;
+        }
+        GB_PATTERN_CHANGED (C) ;
+    }
+    else
+    { 
+        // allocate a new matrix C
+        GB_OK (GB_new_bix (Chandle, ctype, A->vlen, B->vdim, GB_Ap_null, true,
+            C_sparsity, true, GB_HYPER_SWITCH_DEFAULT, -1, cnzmax, true,
+            Context)) ;
+        C = *Chandle ;
+        C->magic = GB_MAGIC ;
+    }
 
     //--------------------------------------------------------------------------
     // get the semiring operators
@@ -162,7 +199,15 @@ GrB_Info GB_bitmap_AxB_saxpy        // C = A*B where C is bitmap or full
     // return result
     //--------------------------------------------------------------------------
 
+    if (C_in != NULL && C->nvals == cnzmax)
+    { 
+        // all entries of C_in are present; it may become full again
+        GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+        GB_bitmap_assign_to_full (C, nthreads_max) ;
+    }
+
     (*mask_applied) = (M != NULL) ;
+    (*done_in_place) = (C_in != NULL) ;
     ASSERT_MATRIX_OK (C, "C bitmap saxpy output", GB0) ;
     return (GrB_SUCCESS) ;
 }
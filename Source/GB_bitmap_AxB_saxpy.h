@@ -14,7 +14,9 @@
 GB_PUBLIC                           // for testing only
 GrB_Info GB_bitmap_AxB_saxpy        // C = A*B where C is bitmap or full
 (
-    GrB_Matrix *Chandle,            // output matrix (not computed in-place)
+    GrB_Matrix *Chandle,            // output matrix, if not done in-place
+    GrB_Matrix C_in,                // input/output matrix, if done in-place
+    const GrB_BinaryOp accum,       // accum for C_in+=A*B, or NULL if C_in=A*B
     const int C_sparsity,
     const GrB_Matrix M,             // optional mask matrix
     const bool Mask_comp,           // if true, use !M
@@ -24,6 +26,7 @@ GrB_Info GB_bitmap_AxB_saxpy        // C = A*B where C is bitmap or full
     const GrB_Semiring semiring,    // semiring that defines C=A*B
     const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
     bool *mask_applied,             // mask always applied if present
+    bool *done_in_place,            // if true, C_in was computed in-place
     GB_Context Context
 ) ;
 
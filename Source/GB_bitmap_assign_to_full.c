@@ -33,6 +33,7 @@ void GB_bitmap_assign_to_full   // set all C->b to 1, or free it and make C full
     { 
         // C is bitmap but can become full; convert it to full
         GB_FREE (C->b) ;
+        C->b_size = 0 ;
         C->nvals = -1 ;
     }
     else
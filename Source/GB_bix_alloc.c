@@ -62,6 +62,7 @@ GrB_Info GB_bix_alloc       // allocate A->b, A->i, and A->x space in a matrix
         { 
             A->i = GB_MALLOC (A->nzmax, int64_t) ;
         }
+        A->i_size = A->nzmax * sizeof (int64_t) ;
         ok = (A->i != NULL) ;
     }
     else if (is_bitmap)
@@ -77,12 +78,14 @@ GrB_Info GB_bix_alloc       // allocate A->b, A->i, and A->x space in a matrix
             // bitmap is not defined and will be computed by the caller
             A->b = GB_MALLOC (A->nzmax, int8_t) ;
         }
+        A->b_size = A->nzmax * sizeof (int8_t) ;
         ok = (A->b != NULL) ;
     }
 
     if (numeric)
     { 
         A->x = GB_MALLOC (A->nzmax * A->type->size, GB_void) ;
+        A->x_size = A->nzmax * A->type->size ;
         ok = ok && (A->x != NULL) ;
     }
 
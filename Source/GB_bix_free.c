@@ -45,6 +45,8 @@ void GB_bix_free                // free A->b, A->i, and A->x of a matrix
     }
     A->b = NULL ;
     A->b_shallow = false ;
+    A->b_is_packed = false ;
+    A->b_size = 0 ;
 
     // free A->i unless it is shallow
     if (!A->i_shallow)
@@ -53,6 +55,8 @@ void GB_bix_free                // free A->b, A->i, and A->x of a matrix
     }
     A->i = NULL ;
     A->i_shallow = false ;
+    A->i_is_32 = false ;
+    A->i_size = 0 ;
 
     // free A->x unless it is shallow
     if (!A->x_shallow)
@@ -61,6 +65,8 @@ void GB_bix_free                // free A->b, A->i, and A->x of a matrix
     }
     A->x = NULL ;
     A->x_shallow = false ;
+    A->iso = false ;
+    A->x_size = 0 ;
 
     A->nzmax = 0 ;
     A->nvals = 0 ;
@@ -73,5 +79,6 @@ void GB_bix_free                // free A->b, A->i, and A->x of a matrix
 
     // free the list of pending tuples
     GB_Pending_free (&(A->Pending)) ;
+    GB_PATTERN_CHANGED (A) ;
 }
 
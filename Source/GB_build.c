@@ -84,7 +84,12 @@
 // The input arrays I_input, J_input, and S_input are not modified.
 // If nvals == 0, I_input, J_input, and S_input may be NULL.
 
+// If all entries of C have the same value after duplicates are assembled, C
+// is returned as an iso matrix (see GB_iso.h).  Its pattern is then held in
+// 32-bit integers if C->index32_control permits (see GB_convert_int64_to_int32).
+
 #include "GB_build.h"
+#include "GB_iso.h"
 
 GrB_Info GB_build               // build matrix
 (
@@ -171,6 +176,27 @@ GrB_Info GB_build               // build matrix
     ASSERT (!GB_ZOMBIES (T)) ;
     ASSERT (!GB_JUMBLED (T)) ;
     ASSERT (!GB_PENDING (T)) ;
-    return (GB_transplant_conform (C, C->type, &T, Context)) ;
+
+    if (GB_iso_check (T, Context))
+    { 
+        // all entries of T are the same; T->x [0] is copied before it is freed
+        info = GB_iso_compress (T, (GB_void *) T->x, Context) ;
+        if (info != GrB_SUCCESS)
+        { 
+            // out of memory
+            GB_Matrix_free (&T) ;
+            return (info) ;
+        }
+    }
+
+    info = GB_transplant_conform (C, C->type, &T, Context) ;
+    if (info != GrB_SUCCESS)
+    { 
+        // out of memory
+        return (info) ;
+    }
+
+    // hold the pattern of C in 32-bit integers, if its control permits
+    return (GB_convert_int64_to_int32 (C, Context)) ;
 }
 
@@ -29,8 +29,9 @@
 
 // STEP 1: copy user input.  O(e/p) read/write per thread, or skipped.
 
-// STEP 2: sort the tuples.  Time: O((e log e)/p), read/write, or skipped if
-//         the tuples are already sorted.
+// STEP 2: sort the tuples.  Time: O((e log e)/p) for the mergesort, or
+//         O((e*b)/p) for the radix sort with keys of b bits, read/write, or
+//         skipped if the tuples are already sorted.
 
 // STEP 3: count vectors and duplicates.  O(e/p) reads, per thread, if no
 //         duplicates, or skipped if already done.  O(e/p) read/writes
@@ -77,7 +78,8 @@
 // does O(e/p) read/writes per thread, but it uses the simpler case in
 // GB_reduce_build_template since no duplicates can appear.  It is unlikely
 // able to transplant S_work into T->x since the input will almost always be
-// unsorted.
+// unsorted.  If GB_transpose only needs the pattern of T, both S_input and
+// S_work are NULL, and T->x is allocated but not computed in Step 5.
 
 // For BITMAP case: this method always returns T as hypersparse, and has no
 // matrix inputs.   If the final C should become full or bitmap, that
@@ -96,15 +98,15 @@
 
 #define GB_FREE_WORK                                                \
 {                                                                   \
-    GB_FREE (tstart_slice) ;        \
-    GB_FREE (tnvec_slice) ;         \
-    GB_FREE (tnz_slice) ;           \
-    GB_FREE (kbad) ;                \
-    GB_FREE (ilast_slice) ;         \
+    GB_FREE_POOL (tstart_slice) ;   \
+    GB_FREE_POOL (tnvec_slice) ;    \
+    GB_FREE_POOL (tnz_slice) ;      \
+    GB_FREE_POOL (kbad) ;           \
+    GB_FREE_POOL (ilast_slice) ;    \
     GB_FREE (*I_work_handle) ;      \
     GB_FREE (*J_work_handle) ;      \
     GB_FREE (*S_work_handle) ;      \
-    GB_FREE (K_work) ;              \
+    GB_FREE_POOL (K_work) ;         \
 }
 
 //------------------------------------------------------------------------------
@@ -160,7 +162,8 @@ GrB_Info GB_builder                 // build a matrix from tuples
     const GB_void *GB_RESTRICT S = (S_work == NULL) ? S_input : S_work ;
     size_t tsize = ttype->size ;
     size_t ssize = GB_code_size (scode, tsize) ;
-    ASSERT (GB_IMPLIES (nvals > 0, S != NULL)) ;
+    // S is NULL if only the pattern of T is needed (see GB_transpose)
+    ASSERT (GB_IMPLIES (S == NULL, S_work == NULL)) ;
 
     //==========================================================================
     // symbolic phase of the build =============================================
@@ -202,11 +205,11 @@ GrB_Info GB_builder                 // build a matrix from tuples
     int64_t *GB_RESTRICT kbad = NULL ;             // size nthreads
     int64_t *GB_RESTRICT ilast_slice = NULL ;      // size [nthreads]
 
-    tstart_slice = GB_CALLOC (nthreads+1, int64_t) ;
-    tnvec_slice  = GB_CALLOC (nthreads+1, int64_t) ;
-    tnz_slice    = GB_CALLOC (nthreads+1, int64_t) ;
-    kbad         = GB_CALLOC (nthreads,   int64_t) ;
-    ilast_slice  = GB_CALLOC (nthreads,   int64_t) ;
+    tstart_slice = GB_CALLOC_POOL (nthreads+1, int64_t) ;
+    tnvec_slice  = GB_CALLOC_POOL (nthreads+1, int64_t) ;
+    tnz_slice    = GB_CALLOC_POOL (nthreads+1, int64_t) ;
+    kbad         = GB_CALLOC_POOL (nthreads,   int64_t) ;
+    ilast_slice  = GB_CALLOC_POOL (nthreads,   int64_t) ;
 
     if (tstart_slice == NULL || tnvec_slice == NULL || tnz_slice == NULL ||
         kbad == NULL || ilast_slice == NULL)
@@ -509,7 +512,7 @@ GrB_Info GB_builder                 // build a matrix from tuples
     {
 
         // create the k part of each tuple
-        K_work = GB_MALLOC (nvals, int64_t) ;
+        K_work = GB_MALLOC_POOL (nvals, int64_t) ;
         if (K_work == NULL)
         { 
             // out of memory
@@ -525,23 +528,42 @@ GrB_Info GB_builder                 // build a matrix from tuples
         // numerical value of the tuple can be found; it is in S[k] for the
         // tuple (i,k) or (j,i,k), regardless of where the tuple appears in the
         // list after it is sorted.
-        int64_t k ;
-        #pragma omp parallel for num_threads(nthreads) schedule(static)
-        for (k = 0 ; k < nvals ; k++)
-        { 
-            K_work [k] = k ;
-        }
 
-        // sort all the tuples
-        if (vdim > 1)
-        {
-            // sort a set of (j,i,k) tuples
-            GB_msort_3b (J_work, I_work, K_work, nvals, nthreads) ;
+        // The radix sort is stable, and creates K_work itself.  It is used
+        // unless the keys are wide compared with log2(nvals), or unless the
+        // mergesort is selected with GxB_BUILD_SORT (see GB_rsort_select).
+
+        if (GB_rsort_select (nvals, vlen, vdim))
+        { 
+            // radix sort of the (j,i) or (i) keys, which computes K_work
+            GBURBLE ("(radix sort) ") ;
+            info = GB_rsort ((vdim > 1) ? J_work : NULL, I_work, K_work,
+                nvals, vlen, nthreads) ;
         }
         else
         {
-            // sort a set of (i,k) tuples
-            GB_msort_2b (I_work, K_work, nvals, nthreads) ;
+            int64_t k ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (k = 0 ; k < nvals ; k++)
+            { 
+                K_work [k] = k ;
+            }
+            if (vdim > 1)
+            { 
+                // sort a set of (j,i,k) tuples
+                info = GB_msort_3b (J_work, I_work, K_work, nvals, nthreads) ;
+            }
+            else
+            { 
+                // sort a set of (i,k) tuples
+                info = GB_msort_2b (I_work, K_work, nvals, nthreads) ;
+            }
+        }
+        if (info != GrB_SUCCESS)
+        { 
+            // out of memory
+            GB_FREE_WORK ;
+            return (GrB_OUT_OF_MEMORY) ;
         }
     }
 
@@ -865,6 +887,7 @@ GrB_Info GB_builder                 // build a matrix from tuples
         }
         // transplant I_work into T->i
         T->i = I_work ;
+        T->i_size = GB_IMAX (T->nzmax, ijslen) * sizeof (int64_t) ;
         I_work = NULL ;
         (*I_work_handle) = NULL ;
     }
@@ -872,6 +895,7 @@ GrB_Info GB_builder                 // build a matrix from tuples
     {
         // duplicates exist, so allocate a new T->i.  I_work must be freed later
         T->i = GB_MALLOC (tnz, int64_t) ;
+        T->i_size = tnz * sizeof (int64_t) ;
         if (T->i == NULL)
         { 
             // out of memory
@@ -1030,6 +1054,7 @@ GrB_Info GB_builder                 // build a matrix from tuples
         // transposed tuples happen to be sorted (which is unlikely).
 
         T->x = S_work ;
+        T->x_size = ijslen * ttype->size ;
         S_work = NULL ;
         (*S_work_handle) = NULL ;
 
@@ -1042,6 +1067,7 @@ GrB_Info GB_builder                 // build a matrix from tuples
         //----------------------------------------------------------------------
 
         T->x = GB_MALLOC (tnz * ttype->size, GB_void) ;
+        T->x_size = tnz * ttype->size ;
         if (T->x == NULL)
         { 
             // out of memory
@@ -1052,12 +1078,10 @@ GrB_Info GB_builder                 // build a matrix from tuples
 
         GB_void *GB_RESTRICT Tx = (GB_void *) T->x ;
 
-        ASSERT (GB_IMPLIES (nvals > 0, S != NULL)) ;
-
-        if (nvals == 0)
+        if (nvals == 0 || S == NULL)
         { 
 
-            // nothing to do
+            // nothing to do; if S is NULL, T->x is left uninitialized
 
         }
         else if (copy_S_into_T)
@@ -42,6 +42,13 @@ void *GB_calloc_memory      // pointer to allocated block of memory
     else
     { 
 
+        // A large block is allocated with malloc and cleared in parallel if
+        // GxB_MEMORY_FIRST_TOUCH is enabled, or if the GxB_NUMA_POLICY is not
+        // the default (see GB_first_touch).
+        bool first_touch = (size >= GB_FIRST_TOUCH_MIN) &&
+            (GB_Global_first_touch_get ( ) ||
+             GB_Global_numa_policy_get ( ) != GxB_NUMA_DEFAULT) ;
+
         if (GB_Global_malloc_tracking_get ( ))
         {
 
@@ -63,7 +70,8 @@ void *GB_calloc_memory      // pointer to allocated block of memory
             }
             else
             { 
-                p = (void *) GB_Global_calloc_function (nitems, size_of_item) ;
+                p = first_touch ? GB_Global_malloc_function (size) :
+                    GB_Global_calloc_function (nitems, size_of_item) ;
             }
 
             // check if successful
@@ -81,9 +89,14 @@ void *GB_calloc_memory      // pointer to allocated block of memory
             // normal use, in production
             //------------------------------------------------------------------
 
-            p = (void *) GB_Global_calloc_function (nitems, size_of_item) ;
+            p = first_touch ? GB_Global_malloc_function (size) :
+                GB_Global_calloc_function (nitems, size_of_item) ;
         }
 
+        if (p != NULL && size >= GB_FIRST_TOUCH_MIN)
+        { 
+            GB_first_touch (p, size, first_touch) ;
+        }
     }
     return (p) ;
 }
@@ -44,15 +44,17 @@ GrB_Info GB_clear           // clear a matrix, type and dimensions unchanged
     ASSERT (GB_ZOMBIES_OK (A)) ;
     ASSERT (GB_JUMBLED_OK (A)) ;
     ASSERT (GB_PENDING_OK (A)) ;
+    GB_PATTERN_CHANGED (A) ;
 
     //--------------------------------------------------------------------------
     // clear the content of A if bitmap
     //--------------------------------------------------------------------------
 
     int sparsity = GB_sparsity_control (A->sparsity, A->vdim) ;
-    if (((sparsity & (GxB_SPARSE + GxB_HYPERSPARSE)) == 0) && GB_IS_BITMAP (A))
+    if (((sparsity & (GxB_SPARSE + GxB_HYPERSPARSE)) == 0) && GB_IS_BITMAP (A)
+        && !A->b_shallow)
     { 
-        // A should remain bitmap
+        // A should remain bitmap; a shallow A->b is freed below instead
         GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
         GB_memset (A->b, 0, GB_NNZ_HELD (A), nthreads_max) ;
         A->nvals = 0 ;
@@ -92,6 +94,7 @@ GrB_Info GB_clear           // clear a matrix, type and dimensions unchanged
         A->nvec = plen ;
         A->plen = plen ;
         A->p = GB_CALLOC (plen+1, int64_t) ;
+        A->p_size = (plen+1) * sizeof (int64_t) ;
         ASSERT (A->h == NULL) ;
         if (A->p == NULL)
         { 
@@ -113,6 +116,8 @@ GrB_Info GB_clear           // clear a matrix, type and dimensions unchanged
         A->plen = plen ;
         A->p = GB_CALLOC (plen+1, int64_t) ;
         A->h = GB_CALLOC (plen  , int64_t) ;
+        A->p_size = (plen+1) * sizeof (int64_t) ;
+        A->h_size = plen * sizeof (int64_t) ;
         if (A->p == NULL || A->h == NULL)
         { 
             // out of memory
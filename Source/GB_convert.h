@@ -29,6 +29,67 @@
 // true if A is sparse (but not hypersparse)
 #define GB_IS_SPARSE(A) ((A) != NULL && ((A)->h == NULL) && (A)->p != NULL)
 
+// true if the 32-bit integer control is valid
+#define GB_INDEX32_CONTROL_OK(c)                                        \
+    ((c) == GxB_INDEX32_AUTO || (c) == GxB_INDEX32_ALWAYS ||            \
+     (c) == GxB_INDEX32_NEVER)
+
+// true if A->p, A->h, or A->i are held as 32-bit integers
+#define GB_INDEX32(A) \
+    ((A) != NULL && ((A)->p_is_32 || (A)->h_is_32 || (A)->i_is_32))
+
+GrB_Info GB_convert_int64_to_int32  // hold the pattern in 32-bit integers
+(
+    GrB_Matrix A,               // matrix to convert
+    GB_Context Context
+) ;
+
+GrB_Info GB_convert_int32_to_int64  // hold the pattern in 64-bit integers
+(
+    GrB_Matrix A,               // matrix to convert
+    GB_Context Context
+) ;
+
+// true if the packed bitmap control is valid
+#define GB_BITMAP_PACK_CONTROL_OK(c)                                    \
+    ((c) == GxB_BITMAP_PACK_AUTO || (c) == GxB_BITMAP_PACK_ALWAYS ||    \
+     (c) == GxB_BITMAP_PACK_NEVER)
+
+// true if A->b is held as a packed bitmap
+#define GB_BITMAP_PACKED(A) ((A) != NULL && (A)->b_is_packed)
+
+// # of uint64_t words in a packed bitmap with n positions
+#define GB_BITMAP_NWORDS(n) (((n) + 63) / 64)
+
+// get A->b [p] from a packed bitmap Ab64 = (uint64_t *) A->b
+#define GB_BITMAP_PACKED_GET(Ab64,p) \
+    ((int8_t) (((Ab64) [(p) >> 6] >> ((p) & 63)) & 1))
+
+// # of bits set in a uint64_t word
+#if defined ( __GNUC__ ) || defined ( __clang__ )
+#define GB_POPCOUNT64(w) ((int64_t) __builtin_popcountll (w))
+#else
+static inline int64_t GB_POPCOUNT64 (uint64_t w)
+{
+    w = w - ((w >> 1) & 0x5555555555555555ULL) ;
+    w = (w & 0x3333333333333333ULL) + ((w >> 2) & 0x3333333333333333ULL) ;
+    w = (w + (w >> 4)) & 0x0F0F0F0F0F0F0F0FULL ;
+    return ((int64_t) ((w * 0x0101010101010101ULL) >> 56)) ;
+}
+#endif
+
+GrB_Info GB_convert_bitmap_to_packed    // pack the bitmap into bits
+(
+    GrB_Matrix A,               // matrix to convert
+    GB_Context Context
+) ;
+
+GrB_Info GB_convert_packed_to_bitmap    // unpack the bitmap into bytes
+(
+    GrB_Matrix A,               // matrix to convert
+    GB_Context Context
+) ;
+
 // determine the sparsity control for a matrix
 int GB_sparsity_control     // revised sparsity
 (
@@ -35,6 +35,7 @@ void GB_convert_any_to_full     // convert any matrix to full
 
     GBURBLE ("(%s to full) ", (A->h != NULL) ? "hypersparse" :
         (GB_IS_BITMAP (A) ? "bitmap" : "sparse")) ;
+    GB_PATTERN_CHANGED (A) ;
 
     //--------------------------------------------------------------------------
     // free A->h, A->p, A->i, and A->b
@@ -44,10 +45,12 @@ void GB_convert_any_to_full     // convert any matrix to full
 
     if (!A->i_shallow) GB_FREE (A->i) ;
     A->i = NULL ;
+    A->i_size = 0 ;
     A->i_shallow = false ;
 
     if (!A->b_shallow) GB_FREE (A->b) ;
     A->b = NULL ;
+    A->b_size = 0 ;
     A->b_shallow = false ;
 
     int64_t avdim = A->vdim ;
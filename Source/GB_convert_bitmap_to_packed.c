@@ -0,0 +1,103 @@
+//------------------------------------------------------------------------------
+// GB_convert_bitmap_to_packed: pack the bitmap of a matrix into bits
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The int8_t bitmap A->b of a bitmap matrix is packed into a uint64_t array
+// with one bit per position, in-place, according to A->bitmap_pack_control:
+// never for GxB_BITMAP_PACK_NEVER, always for GxB_BITMAP_PACK_ALWAYS, and only
+// if A has at least GB_BITMAP_PACK_MIN positions for GxB_BITMAP_PACK_AUTO.
+
+// This is done when the user application calls GrB_*_wait, and when its
+// GxB_BITMAP_PACK_CONTROL is set.  The methods in GraphBLAS operate on the
+// int8_t bitmap, so the matrix is unpacked by GB_convert_packed_to_bitmap when
+// it is next used, via GB_MATRIX_WAIT or GB_Matrix_wait.
+
+// Packing the bitmap is optional, so if it runs out of memory, the matrix is
+// left unchanged and GrB_SUCCESS is returned.
+
+#include "GB.h"
+
+GrB_Info GB_convert_bitmap_to_packed    // pack the bitmap into bits
+(
+    GrB_Matrix A,               // matrix to convert
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (A, "A to pack", GB0) ;
+
+    if (A->bitmap_pack_control == GxB_BITMAP_PACK_NEVER || !GB_IS_BITMAP (A)
+        || A->b_is_packed || A->b_shallow)
+    {
+        // A cannot be packed, or its control does not permit it
+        return (GrB_SUCCESS) ;
+    }
+
+    int64_t anz = GB_NNZ_HELD (A) ;
+    if (A->bitmap_pack_control == GxB_BITMAP_PACK_AUTO &&
+        anz < GB_BITMAP_PACK_MIN)
+    {
+        // A is too small for packing to be worthwhile
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the packed bitmap
+    //--------------------------------------------------------------------------
+
+    int64_t nwords = GB_BITMAP_NWORDS (anz) ;
+    uint64_t *GB_RESTRICT Ab64 = GB_MALLOC (nwords, uint64_t) ;
+    if (Ab64 == NULL)
+    {
+        // out of memory; leave A unchanged
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // pack the bitmap, one word of 64 positions at a time
+    //--------------------------------------------------------------------------
+
+    GBURBLE ("(packed) ") ;
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (anz, chunk, nthreads_max) ;
+
+    const int8_t *GB_RESTRICT Ab = A->b ;
+    int64_t anvals = 0 ;
+    int64_t w ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:anvals)
+    for (w = 0 ; w < nwords ; w++)
+    {
+        int64_t pstart = w * 64 ;
+        int64_t pend = GB_IMIN (pstart + 64, anz) ;
+        uint64_t word = 0 ;
+        for (int64_t p = pstart ; p < pend ; p++)
+        {
+            word |= ((uint64_t) (Ab [p] != 0)) << (p - pstart) ;
+        }
+        Ab64 [w] = word ;
+        anvals += GB_POPCOUNT64 (word) ;
+    }
+
+    ASSERT (anvals == A->nvals) ;
+    GB_FREE (A->b) ;
+    A->b = (int8_t *) Ab64 ;
+    A->b_size = nwords * sizeof (uint64_t) ;
+    A->b_is_packed = true ;
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (A, "A packed", GB0) ;
+    return (GrB_SUCCESS) ;
+}
@@ -37,6 +37,7 @@ GrB_Info GB_convert_bitmap_to_sparse    // convert matrix from bitmap to sparse
     ASSERT (!GB_JUMBLED (A)) ;      // bitmap is never jumbled
     ASSERT (!GB_ZOMBIES (A)) ;      // bitmap never has zomies
     GBURBLE ("(bitmap to sparse) ") ;
+    GB_PATTERN_CHANGED (A) ;
 
     //--------------------------------------------------------------------------
     // allocate Ap, Ai, and Ax
@@ -47,9 +48,11 @@ GrB_Info GB_convert_bitmap_to_sparse    // convert matrix from bitmap to sparse
     int64_t anvec_nonempty ;
     const int64_t avdim = A->vdim ;
     const size_t asize = A->type->size ;
+    const bool A_iso = A->iso ;
     int64_t *GB_RESTRICT Ap = GB_MALLOC (avdim+1, int64_t) ; 
     int64_t *GB_RESTRICT Ai = GB_MALLOC (anzmax, int64_t) ;
-    GB_void *GB_RESTRICT Ax = GB_MALLOC (anzmax * asize, GB_void) ;
+    GB_void *GB_RESTRICT Ax = GB_MALLOC ((A_iso ? 1 : anzmax) * asize,
+        GB_void) ;
     if (Ap == NULL || Ai == NULL || Ax == NULL)
     { 
         // out of memory
@@ -61,8 +64,13 @@ GrB_Info GB_convert_bitmap_to_sparse    // convert matrix from bitmap to sparse
     // convert to sparse format (Ap, Ai, and Ax)
     //--------------------------------------------------------------------------
 
-    GB_OK (GB_convert_bitmap_worker (Ap, Ai, NULL, Ax, &anvec_nonempty, A,
-        Context)) ;
+    GB_OK (GB_convert_bitmap_worker (Ap, Ai, NULL, A_iso ? NULL : Ax,
+        &anvec_nonempty, A, Context)) ;
+    if (A_iso)
+    { 
+        // the single value of an iso matrix is unchanged
+        memcpy (Ax, A->x, asize) ;
+    }
 
     //--------------------------------------------------------------------------
     // free prior content of A and transplant the new content
@@ -71,13 +79,17 @@ GrB_Info GB_convert_bitmap_to_sparse    // convert matrix from bitmap to sparse
     GB_phbix_free (A) ;
 
     A->p = Ap ;
+    A->p_size = (avdim+1) * sizeof (int64_t) ;
     A->p_shallow = false ;
 
     A->i = Ai ;
+    A->i_size = anzmax * sizeof (int64_t) ;
     A->i_shallow = false ;
 
     A->x = Ax ;
+    A->x_size = (A_iso ? 1 : anzmax) * asize ;
     A->x_shallow = false ;
+    A->iso = A_iso ;
 
     A->nzmax = anzmax ;
     A->nvals = 0 ;              // only used when A is bitmap
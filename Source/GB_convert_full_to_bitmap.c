@@ -29,6 +29,7 @@ GrB_Info GB_convert_full_to_bitmap      // convert matrix from full to bitmap
     ASSERT (!GB_JUMBLED (A)) ;
     ASSERT (!GB_PENDING (A)) ;
     GBURBLE ("(full to bitmap) ") ;
+    GB_PATTERN_CHANGED (A) ;
 
     //--------------------------------------------------------------------------
     // allocate A->b
@@ -40,6 +41,7 @@ GrB_Info GB_convert_full_to_bitmap      // convert matrix from full to bitmap
     ASSERT (GB_Index_multiply (&anz, avdim, avlen) == true) ;
 
     A->b = GB_MALLOC (anz, int8_t) ;
+    A->b_size = GB_IMAX (anz, 1) * sizeof (int8_t) ;
     if (A->b == NULL)
     { 
         // out of memory
@@ -29,6 +29,7 @@ GrB_Info GB_convert_full_to_sparse      // convert matrix from full to sparse
     ASSERT (!GB_JUMBLED (A)) ;
     ASSERT (!GB_PENDING (A)) ;
     GBURBLE ("(full to sparse) ") ;
+    GB_PATTERN_CHANGED (A) ;
 
     //--------------------------------------------------------------------------
     // allocate A->p and A->i
@@ -52,6 +53,8 @@ GrB_Info GB_convert_full_to_sparse      // convert matrix from full to sparse
 
     A->p = Ap ;
     A->i = Ai ;
+    A->p_size = (avdim+1) * sizeof (int64_t) ;
+    A->i_size = GB_IMAX (anz, 1) * sizeof (int64_t) ;
     A->plen = avdim ;
     A->nvec = avdim ;
     A->nvec_nonempty = (avlen == 0) ? 0 : avdim ;
@@ -50,6 +50,7 @@ GrB_Info GB_convert_hyper_to_sparse // convert hypersparse to sparse
         //----------------------------------------------------------------------
 
         GBURBLE ("(hyper to sparse) ") ;
+        GB_PATTERN_CHANGED (A) ;
         int64_t n = A->vdim ;
 
         GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
@@ -204,6 +205,8 @@ GrB_Info GB_convert_hyper_to_sparse // convert hypersparse to sparse
         // transplant the new vector pointers; matrix is no longer hypersparse
         A->p = Ap_new ;
         A->h = NULL ;
+        A->p_size = (n+1) * sizeof (int64_t) ;
+        A->h_size = 0 ;
         A->nvec = n ;
         A->nvec_nonempty = nvec_nonempty ;
         A->plen = n ;
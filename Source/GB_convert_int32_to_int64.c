@@ -0,0 +1,130 @@
+//------------------------------------------------------------------------------
+// GB_convert_int32_to_int64: hold the pattern of a matrix in 64-bit integers
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Any of A->p, A->h, and A->i held as int32_t by GB_convert_int64_to_int32
+// are converted back to int64_t, in-place.  Shallow components are left in
+// place in the matrix they are borrowed from, and replaced in A with new
+// arrays of its own.  If the matrix has no 32-bit components, nothing is done.
+
+#include "GB.h"
+
+#define GB_FREE_ALL         \
+{                           \
+    GB_FREE (Ap) ;          \
+    GB_FREE (Ah) ;          \
+    GB_FREE (Ai) ;          \
+}
+
+// Y = (int64_t) X, where X has size n
+static void GB_int32_to_int64
+(
+    int64_t *GB_RESTRICT Y,
+    const int32_t *GB_RESTRICT X,
+    int64_t n,
+    int nthreads_max,
+    double chunk
+)
+{
+    int nthreads = GB_nthreads (n, chunk, nthreads_max) ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < n ; k++)
+    {
+        Y [k] = (int64_t) X [k] ;
+    }
+}
+
+GrB_Info GB_convert_int32_to_int64  // hold the pattern in 64-bit integers
+(
+    GrB_Matrix A,               // matrix to convert
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (A != NULL) ;
+    if (!GB_INDEX32 (A))
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    ASSERT_MATRIX_OK (A, "A to convert to 64-bit integers", GB0) ;
+    ASSERT (!GB_ANY_PENDING_WORK (A)) ;
+
+    //--------------------------------------------------------------------------
+    // allocate the new components
+    //--------------------------------------------------------------------------
+
+    int64_t *GB_RESTRICT Ap = NULL ;
+    int64_t *GB_RESTRICT Ah = NULL ;
+    int64_t *GB_RESTRICT Ai = NULL ;
+    int64_t plen = A->plen ;
+    int64_t nzmax = A->nzmax ;
+    if (A->p_is_32) Ap = GB_MALLOC (plen+1, int64_t) ;
+    if (A->h_is_32) Ah = GB_MALLOC (plen,   int64_t) ;
+    if (A->i_is_32) Ai = GB_MALLOC (nzmax,  int64_t) ;
+    if ((A->p_is_32 && Ap == NULL) || (A->h_is_32 && Ah == NULL) ||
+        (A->i_is_32 && Ai == NULL))
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // convert the components
+    //--------------------------------------------------------------------------
+
+    GBURBLE ("(64-bit) ") ;
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int64_t anz = GB_NNZ (A) ;
+
+    if (A->p_is_32)
+    {
+        GB_int32_to_int64 (Ap, (int32_t *) A->p, A->nvec+1, nthreads_max,
+            chunk) ;
+        if (!A->p_shallow) GB_FREE (A->p) ;
+        A->p = Ap ;
+        A->p_shallow = false ;
+        A->p_is_32 = false ;
+        A->p_size = (plen+1) * sizeof (int64_t) ;
+    }
+
+    if (A->h_is_32)
+    {
+        GB_int32_to_int64 (Ah, (int32_t *) A->h, A->nvec, nthreads_max,
+            chunk) ;
+        if (!A->h_shallow) GB_FREE (A->h) ;
+        A->h = Ah ;
+        A->h_shallow = false ;
+        A->h_is_32 = false ;
+        A->h_size = plen * sizeof (int64_t) ;
+    }
+
+    if (A->i_is_32)
+    {
+        GB_int32_to_int64 (Ai, (int32_t *) A->i, anz, nthreads_max, chunk) ;
+        if (!A->i_shallow) GB_FREE (A->i) ;
+        A->i = Ai ;
+        A->i_shallow = false ;
+        A->i_is_32 = false ;
+        A->i_size = nzmax * sizeof (int64_t) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (A, "A converted to 64-bit integers", GB0) ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,155 @@
+//------------------------------------------------------------------------------
+// GB_convert_int64_to_int32: hold the pattern of a matrix in 32-bit integers
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A sparse or hypersparse matrix with no pending work can hold A->p as int32_t
+// if nnz(A) < 2^31, and A->h and A->i as int32_t if A->vdim and A->vlen are
+// less than 2^31.  The matrix is converted in-place, according to
+// A->index32_control: never for GxB_INDEX32_NEVER, whenever it fits for
+// GxB_INDEX32_ALWAYS, and only if it also has at least GB_INDEX32_MIN entries
+// for GxB_INDEX32_AUTO.
+
+// This is done when the matrix is built by GrB_*_build, when the user
+// application calls GrB_*_wait, and when its GxB_INDEX32_CONTROL is set.  The
+// methods in GraphBLAS operate on 64-bit integers, so the matrix is converted
+// back by GB_convert_int32_to_int64 when it is next used, via GB_MATRIX_WAIT
+// or GB_Matrix_wait, just like any other pending work.
+
+// Converting the matrix is optional, so if it runs out of memory, the matrix
+// is left unchanged and GrB_SUCCESS is returned.
+
+#include "GB.h"
+
+#define GB_FREE_ALL         \
+{                           \
+    GB_FREE (Ap32) ;        \
+    GB_FREE (Ah32) ;        \
+    GB_FREE (Ai32) ;        \
+}
+
+// Y = (int32_t) X, where X has size n
+static void GB_int64_to_int32
+(
+    int32_t *GB_RESTRICT Y,
+    const int64_t *GB_RESTRICT X,
+    int64_t n,
+    int nthreads_max,
+    double chunk
+)
+{
+    int nthreads = GB_nthreads (n, chunk, nthreads_max) ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < n ; k++)
+    {
+        Y [k] = (int32_t) X [k] ;
+    }
+}
+
+GrB_Info GB_convert_int64_to_int32  // hold the pattern in 32-bit integers
+(
+    GrB_Matrix A,               // matrix to convert
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (A, "A to convert to 32-bit integers", GB0) ;
+    int32_t *GB_RESTRICT Ap32 = NULL ;
+    int32_t *GB_RESTRICT Ah32 = NULL ;
+    int32_t *GB_RESTRICT Ai32 = NULL ;
+
+    if (A->index32_control == GxB_INDEX32_NEVER || GB_ANY_PENDING_WORK (A)
+        || !(GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A))
+        || A->p_shallow || A->h_shallow || A->i_shallow)
+    {
+        // A cannot be converted, or its control does not permit it
+        return (GrB_SUCCESS) ;
+    }
+
+    int64_t anz = GB_NNZ (A) ;
+    if (A->index32_control == GxB_INDEX32_AUTO && anz < GB_INDEX32_MIN)
+    {
+        // A is too small for the conversion to be worthwhile
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine which components to convert
+    //--------------------------------------------------------------------------
+
+    bool do_p = !A->p_is_32 && (anz <= INT32_MAX) ;
+    bool do_h = !A->h_is_32 && (A->h != NULL) && (A->vdim <= INT32_MAX) ;
+    bool do_i = !A->i_is_32 && (A->i != NULL) && (A->vlen <= INT32_MAX) ;
+    if (!(do_p || do_h || do_i))
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the new components
+    //--------------------------------------------------------------------------
+
+    int64_t plen = A->plen ;
+    int64_t nzmax = A->nzmax ;
+    if (do_p) Ap32 = GB_MALLOC (plen+1, int32_t) ;
+    if (do_h) Ah32 = GB_MALLOC (plen,   int32_t) ;
+    if (do_i) Ai32 = GB_MALLOC (nzmax,  int32_t) ;
+    if ((do_p && Ap32 == NULL) || (do_h && Ah32 == NULL) ||
+        (do_i && Ai32 == NULL))
+    {
+        // out of memory; leave A unchanged
+        GB_FREE_ALL ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // convert the components
+    //--------------------------------------------------------------------------
+
+    GBURBLE ("(32-bit) ") ;
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+
+    if (do_p)
+    {
+        GB_int64_to_int32 (Ap32, A->p, A->nvec+1, nthreads_max, chunk) ;
+        GB_FREE (A->p) ;
+        A->p = (int64_t *) Ap32 ;
+        A->p_is_32 = true ;
+        A->p_size = (plen+1) * sizeof (int32_t) ;
+    }
+
+    if (do_h)
+    {
+        GB_int64_to_int32 (Ah32, A->h, A->nvec, nthreads_max, chunk) ;
+        GB_FREE (A->h) ;
+        A->h = (int64_t *) Ah32 ;
+        A->h_is_32 = true ;
+        A->h_size = plen * sizeof (int32_t) ;
+    }
+
+    if (do_i)
+    {
+        GB_int64_to_int32 (Ai32, A->i, anz, nthreads_max, chunk) ;
+        GB_FREE (A->i) ;
+        A->i = (int64_t *) Ai32 ;
+        A->i_is_32 = true ;
+        A->i_size = nzmax * sizeof (int32_t) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (A, "A converted to 32-bit integers", GB0) ;
+    return (GrB_SUCCESS) ;
+}
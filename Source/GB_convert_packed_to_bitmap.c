@@ -0,0 +1,85 @@
+//------------------------------------------------------------------------------
+// GB_convert_packed_to_bitmap: unpack the bitmap of a matrix into bytes
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A bitmap packed into bits by GB_convert_bitmap_to_packed is converted back
+// to an int8_t bitmap of size A->nzmax, in-place.  A shallow packed bitmap is
+// left in place in the matrix it is borrowed from, and replaced in A with a
+// new bitmap of its own.  If the bitmap is not packed, nothing is done.
+
+#include "GB.h"
+
+GrB_Info GB_convert_packed_to_bitmap    // unpack the bitmap into bytes
+(
+    GrB_Matrix A,               // matrix to convert
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (A != NULL) ;
+    if (!GB_BITMAP_PACKED (A))
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    ASSERT_MATRIX_OK (A, "A to unpack", GB0) ;
+    ASSERT (GB_IS_BITMAP (A)) ;
+
+    //--------------------------------------------------------------------------
+    // allocate the int8_t bitmap
+    //--------------------------------------------------------------------------
+
+    int64_t anz = GB_NNZ_HELD (A) ;
+    int8_t *GB_RESTRICT Ab = GB_MALLOC (A->nzmax, int8_t) ;
+    if (Ab == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // unpack the bitmap, one word of 64 positions at a time
+    //--------------------------------------------------------------------------
+
+    GBURBLE ("(unpacked) ") ;
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (anz, chunk, nthreads_max) ;
+
+    const uint64_t *GB_RESTRICT Ab64 = (uint64_t *) A->b ;
+    int64_t nwords = GB_BITMAP_NWORDS (anz) ;
+    int64_t w ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (w = 0 ; w < nwords ; w++)
+    {
+        int64_t pstart = w * 64 ;
+        int64_t pend = GB_IMIN (pstart + 64, anz) ;
+        uint64_t word = Ab64 [w] ;
+        for (int64_t p = pstart ; p < pend ; p++)
+        {
+            Ab [p] = (int8_t) ((word >> (p - pstart)) & 1) ;
+        }
+    }
+
+    if (!A->b_shallow) GB_FREE (A->b) ;
+    A->b = Ab ;
+    A->b_size = A->nzmax * sizeof (int8_t) ;
+    A->b_shallow = false ;
+    A->b_is_packed = false ;
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (A, "A unpacked", GB0) ;
+    return (GrB_SUCCESS) ;
+}
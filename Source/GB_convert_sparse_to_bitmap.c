@@ -46,6 +46,7 @@ GrB_Info GB_convert_sparse_to_bitmap    // convert sparse/hypersparse to bitmap
     ASSERT (GB_JUMBLED_OK (A)) ;        // A can be jumbled on input
     ASSERT (GB_ZOMBIES_OK (A)) ;        // A can have zombies on input
     GBURBLE ("(sparse to bitmap) ") ;
+    GB_PATTERN_CHANGED (A) ;
 
     //--------------------------------------------------------------------------
     // determine the maximum number of threads to use
@@ -60,6 +61,9 @@ GrB_Info GB_convert_sparse_to_bitmap    // convert sparse/hypersparse to bitmap
     // if in_place is true, then A->x does not change if A is as-if-full
     bool in_place = GB_as_if_full (A) ;
 
+    // if A is iso, its single value A->x [0] does not change
+    const bool A_iso = A->iso ;
+
     //--------------------------------------------------------------------------
     // allocate A->b
     //--------------------------------------------------------------------------
@@ -107,18 +111,21 @@ GrB_Info GB_convert_sparse_to_bitmap    // convert sparse/hypersparse to bitmap
 
     const size_t asize = A->type->size ;
     bool Ax_shallow ;
+    size_t Ax_new_size ;
 
-    if (in_place)
+    if (in_place || A_iso)
     { 
         // keep the existing A->x
         Ax_new = A->x ;
         Ax_shallow = A->x_shallow ;
+        Ax_new_size = A->x_size ;
     }
     else
     {
         // A->x must be modified to fit the bitmap structure
         Ax_new = GB_MALLOC (anzmax * asize, GB_void) ;
         Ax_shallow = false ;
+        Ax_new_size = anzmax * asize ;
         if (Ax_new == NULL)
         { 
             // out of memory
@@ -158,7 +165,7 @@ GrB_Info GB_convert_sparse_to_bitmap    // convert sparse/hypersparse to bitmap
         //----------------------------------------------------------------------
 
         int nthreads = GB_nthreads (anz + anvec, chunk, nthreads_max) ;
-        int ntasks = (nthreads == 1) ? 1 : (8 * nthreads) ;
+        int ntasks = (nthreads == 1) ? 1 : (GB_NUMA_NTASKS (8) * nthreads) ;
         if (!GB_ek_slice (&pstart_slice, &kfirst_slice, &klast_slice, A,
             &ntasks))
         { 
@@ -169,6 +176,17 @@ GrB_Info GB_convert_sparse_to_bitmap    // convert sparse/hypersparse to bitmap
 
         bool done = false ;
 
+        if (A_iso)
+        { 
+            // scatter just the pattern of A into the bitmap
+            #define GB_COPY_A_TO_C(Ax_new,pnew,Ax,p)
+            #define GB_ATYPE GB_void
+            #include "GB_convert_sparse_to_bitmap_template.c"
+            #undef  GB_COPY_A_TO_C
+            #undef  GB_ATYPE
+            done = true ;
+        }
+
         #ifndef GBCOMPACT
 
             //------------------------------------------------------------------
@@ -189,7 +207,7 @@ GrB_Info GB_convert_sparse_to_bitmap    // convert sparse/hypersparse to bitmap
             //------------------------------------------------------------------
 
             GB_Type_code acode = A->type->code ;
-            if (acode < GB_UDT_code)
+            if (!done && acode < GB_UDT_code)
             { 
                 switch (acode)
                 {
@@ -226,7 +244,7 @@ GrB_Info GB_convert_sparse_to_bitmap    // convert sparse/hypersparse to bitmap
     // free prior content of A and transplant the new content
     //--------------------------------------------------------------------------
 
-    if (in_place)
+    if (in_place || A_iso)
     {
         // if done in-place, remove A->x from A so it is not freed
         A->x = NULL ;
@@ -234,12 +252,15 @@ GrB_Info GB_convert_sparse_to_bitmap    // convert sparse/hypersparse to bitmap
     }
 
     GB_phbix_free (A) ;
+    A->iso = A_iso ;
 
     A->b = Ab ;
+    A->b_size = anzmax * sizeof (int8_t) ;
     A->b_shallow = false ;
     Ab = NULL ;
 
     A->x = Ax_new ;
+    A->x_size = Ax_new_size ;
     A->x_shallow = Ax_shallow ;
     Ax_new = NULL ;
 
@@ -50,6 +50,7 @@ GrB_Info GB_convert_sparse_to_hyper // convert from sparse to hypersparse
         //----------------------------------------------------------------------
 
         GBURBLE ("(sparse to hyper) ") ;
+        GB_PATTERN_CHANGED (A) ;
         int64_t n = A->vdim ;
         GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
         int nthreads = GB_nthreads (n, chunk, nthreads_max) ;
@@ -117,6 +118,8 @@ GrB_Info GB_convert_sparse_to_hyper // convert from sparse to hypersparse
         A->nvec = nvec_nonempty ;
         A->p = Ap_new ;
         A->h = Ah_new ;
+        A->p_size = (nvec_nonempty+1) * sizeof (int64_t) ;
+        A->h_size = nvec_nonempty * sizeof (int64_t) ;
         A->p_shallow = false ;
         A->h_shallow = false ;
 
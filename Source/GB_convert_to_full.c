@@ -22,6 +22,7 @@ GrB_Info GB_convert_to_full     // convert matrix to full; delete prior values
     GB_void *Ax_new = NULL ;
     ASSERT_MATRIX_OK (A, "A converting to full", GB0) ;
     GBURBLE ("(to full) ") ;
+    GB_PATTERN_CHANGED (A) ;
     ASSERT (GB_ZOMBIES_OK (A)) ;
     ASSERT (GB_JUMBLED_OK (A)) ;
     ASSERT (GB_PENDING_OK (A)) ;
@@ -56,6 +57,7 @@ GrB_Info GB_convert_to_full     // convert matrix to full; delete prior values
     //--------------------------------------------------------------------------
 
     A->x = Ax_new ;
+    A->x_size = GB_IMAX (anzmax, 1) * A->type->size ;
     A->plen = -1 ;
     A->nvec = avdim ;
     A->nvec_nonempty = (avlen == 0) ? 0 : avdim ;
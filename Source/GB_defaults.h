@@ -34,5 +34,18 @@
 // initial size of the pending tuples
 #define GB_PENDING_INIT 256
 
+// max # of sorted runs of pending tuples (see GB_Pending_merge); the runs
+// decrease geometrically in size, so this limit is not reached in practice
+#define GB_PENDING_MAXRUNS 64
+
+// With GxB_INDEX32_AUTO, a matrix with fewer entries than this keeps its
+// pattern in 64-bit integers, since the memory saved would be minor compared
+// with the cost of converting it back when it is next used.
+#define GB_INDEX32_MIN (1024*1024)
+
+// With GxB_BITMAP_PACK_AUTO, a bitmap matrix with fewer positions than this is
+// not packed.
+#define GB_BITMAP_PACK_MIN (1024*1024)
+
 #endif
 
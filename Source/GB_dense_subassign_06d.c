@@ -90,7 +90,7 @@ GrB_Info GB_dense_subassign_06d
     int64_t anz = GB_NNZ_HELD (A) ;
     GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
     int nthreads = GB_nthreads (anz + A->nvec, chunk, nthreads_max) ;
-    int ntasks = (nthreads == 1) ? 1 : (8 * nthreads) ;
+    int ntasks = (nthreads == 1) ? 1 : (GB_NUMA_NTASKS (8) * nthreads) ;
 
     //--------------------------------------------------------------------------
     // slice the entries for each task
@@ -93,7 +93,7 @@ GrB_Info GB_dense_subassign_23      // C += B; C is dense, B is sparse or dense
     int64_t bnvec = B->nvec ;
     GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
     int nthreads = GB_nthreads (bnz + bnvec, chunk, nthreads_max) ;
-    int ntasks = (nthreads == 1) ? 1 : (32 * nthreads) ;
+    int ntasks = (nthreads == 1) ? 1 : (GB_NUMA_NTASKS (32) * nthreads) ;
 
     //--------------------------------------------------------------------------
     // slice the entries for each task
@@ -90,7 +90,7 @@ GrB_Info GB_dense_subassign_25
     GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
     int64_t mnz = GB_NNZ_HELD (M) ;
     int nthreads = GB_nthreads (mnz + M->nvec, chunk, nthreads_max) ;
-    int ntasks = (nthreads == 1) ? 1 : (8 * nthreads) ;
+    int ntasks = (nthreads == 1) ? 1 : (GB_NUMA_NTASKS (8) * nthreads) ;
 
     //--------------------------------------------------------------------------
     // slice the entries for each task
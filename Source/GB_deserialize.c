@@ -0,0 +1,455 @@
+//------------------------------------------------------------------------------
+// GB_deserialize: create a matrix from a blob
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The blob was created by GB_serialize (see GB_serialize.h).  The matrix C is
+// constructed in the same format as the matrix that was serialized.  The blob
+// may have been corrupted or may not be a blob at all, so it is checked before
+// C is returned: each section must lie inside the blob, and the pattern of C
+// must be valid.  GrB_INVALID_OBJECT is returned if the blob is invalid.
+
+// If shallow is true and the blob is not compressed, the content of C is not
+// copied.  Instead, its components are shallow pointers into the blob, which
+// must remain unchanged until C is freed (see GB_mmap).  The pattern of C is
+// then trusted, as it is for a matrix imported with GxB_SHALLOW_IMPORT, and
+// only the header of the blob is checked.
+
+#include "GB_serialize.h"
+
+#define GB_FREE_ALL                 \
+{                                   \
+    GB_Matrix_free (&C) ;           \
+}
+
+GrB_Info GB_deserialize         // deserialize a matrix from a blob
+(
+    // output:
+    GrB_Matrix *Chandle,        // output matrix created from the blob
+    // input:
+    GrB_Type ctype,             // type of C; may be NULL for built-in types
+    const GB_void *blob,        // serialized matrix
+    size_t blob_size,           // size of the blob
+    bool shallow,               // if true, C is a shallow view of the blob
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs and read the header
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GrB_Matrix C = NULL ;
+    ASSERT (Chandle != NULL && blob != NULL) ;
+    (*Chandle) = NULL ;
+
+    GB_blob_header header ;
+    if (blob_size < sizeof (GB_blob_header))
+    {
+        return (GrB_INVALID_OBJECT) ;
+    }
+    memcpy (&header, blob, sizeof (GB_blob_header)) ;
+    if (header.magic != GB_BLOB_MAGIC || header.blob_size < 0 ||
+        (size_t) header.blob_size > blob_size ||
+        header.blocksize != GB_BLOB_BLOCKSIZE ||
+        !(header.align_log2 == 0 ||
+         (header.align_log2 >= 3 && header.align_log2 <= 16)))
+    {
+        return (GrB_INVALID_OBJECT) ;
+    }
+    int64_t align = (header.align_log2 == 0) ? 8 :
+        (((int64_t) 1) << header.align_log2) ;
+
+    //--------------------------------------------------------------------------
+    // get the type of C
+    //--------------------------------------------------------------------------
+
+    int typecode = header.typecode ;
+    if (typecode < GB_BOOL_code || typecode > GB_UDT_code)
+    {
+        return (GrB_INVALID_OBJECT) ;
+    }
+    if (ctype == NULL)
+    {
+        // C has a built-in type, given by the blob
+        if (typecode == GB_UDT_code)
+        {
+            return (GrB_DOMAIN_MISMATCH) ;
+        }
+        ctype = GB_code_type (typecode, NULL) ;
+    }
+    if (ctype->code != typecode || ctype->size != header.typesize)
+    {
+        // C must have the same type as the matrix that was serialized
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check the header
+    //--------------------------------------------------------------------------
+
+    int64_t vlen = header.vlen ;
+    int64_t vdim = header.vdim ;
+    int64_t nvec = header.nvec ;
+    int64_t nvals = header.nvals ;
+    int sparsity = header.sparsity ;
+    bool is_hyper = (sparsity == GxB_HYPERSPARSE) ;
+    bool is_sparse = (sparsity == GxB_SPARSE) ;
+    bool is_bitmap = (sparsity == GxB_BITMAP) ;
+    bool is_full = (sparsity == GxB_FULL) ;
+    bool is_hyper_or_sparse = is_hyper || is_sparse ;
+    bool compress = (header.compression == GxB_COMPRESSION_VARINT) ;
+    shallow = shallow && !compress && (((uintptr_t) blob) % 8 == 0) ;
+
+    if (vlen < 0 || vlen > GxB_INDEX_MAX || vdim < 0 || vdim > GxB_INDEX_MAX
+        || nvals < 0 || nvals > GxB_INDEX_MAX
+        || !(is_hyper || is_sparse || is_bitmap || is_full)
+        || !(compress || header.compression == GxB_COMPRESSION_NONE)
+        || header.sparsity_control < 1
+        || header.sparsity_control > GxB_ANY_SPARSITY
+        || !GB_INDEX32_CONTROL_OK (header.index32_control)
+        || !GB_BITMAP_PACK_CONTROL_OK (header.bitmap_pack_control)
+        || (is_hyper && (nvec < 0 || nvec > vdim))
+        || (is_sparse && nvec != vdim)
+        || (!is_hyper_or_sparse && (header.p_is_32 || header.h_is_32 ||
+            header.i_is_32))
+        || (!is_hyper && header.h_is_32)
+        || (!is_bitmap && header.b_is_packed)
+        || (header.p_is_32 && nvals > INT32_MAX)
+        || (header.h_is_32 && vdim > INT32_MAX)
+        || (header.i_is_32 && vlen > INT32_MAX)
+        || header.Ap_len < 0 || header.Ap_len > header.blob_size
+        || header.Ah_len < 0 || header.Ah_len > header.blob_size
+        || header.Ab_len < 0 || header.Ab_len > header.blob_size
+        || header.Ai_len < 0 || header.Ai_len > header.blob_size
+        || header.Ax_len < 0 || header.Ax_len > header.blob_size)
+    {
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    // # of entries held in C
+    int64_t full_size = 0 ;
+    if (is_bitmap || is_full)
+    {
+        if (!GB_Index_multiply ((GrB_Index *) &full_size, vlen, vdim))
+        {
+            return (GrB_INVALID_OBJECT) ;
+        }
+        if (nvals > full_size || (is_full && nvals != full_size))
+        {
+            return (GrB_INVALID_OBJECT) ;
+        }
+    }
+    int64_t cnz_held = is_hyper_or_sparse ? nvals : full_size ;
+    if (!header.iso && cnz_held > header.blob_size)
+    {
+        // C->x cannot fit in the blob
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    // the size of each section of the blob
+    size_t psize = header.p_is_32 ? sizeof (int32_t) : sizeof (int64_t) ;
+    size_t hsize = header.h_is_32 ? sizeof (int32_t) : sizeof (int64_t) ;
+    size_t isize = header.i_is_32 ? sizeof (int32_t) : sizeof (int64_t) ;
+    int64_t np = is_hyper_or_sparse ? (nvec + 1) : 0 ;
+    int64_t nh = is_hyper ? nvec : 0 ;
+    int64_t ni = is_hyper_or_sparse ? nvals : 0 ;
+    int64_t Ab_len = 0 ;
+    if (is_bitmap)
+    {
+        Ab_len = header.b_is_packed ?
+            (GB_BITMAP_NWORDS (full_size) * sizeof (uint64_t)) : full_size ;
+    }
+    int64_t Ax_len = header.typesize * (header.iso ? 1 : cnz_held) ;
+    // a compressed integer takes at least one byte, so n is bounded by the
+    // size of its section before anything is allocated
+    #define GB_COMPRESSED_LEN_OK(len,n) \
+        ((len) >= (int64_t) (GB_ICEIL (n, GB_BLOB_BLOCKSIZE) \
+            * sizeof (int64_t)) + (n))
+    if ((!compress && (header.Ap_len != (int64_t) (np * psize)
+                    || header.Ah_len != (int64_t) (nh * hsize)
+                    || header.Ai_len != (int64_t) (ni * isize)))
+        || (compress && !(GB_COMPRESSED_LEN_OK (header.Ap_len, np)
+                       && GB_COMPRESSED_LEN_OK (header.Ah_len, nh)
+                       && GB_COMPRESSED_LEN_OK (header.Ai_len, ni)))
+        || header.Ab_len != Ab_len
+        || !(header.Ax_len == Ax_len || (header.Ax_len == 0 && cnz_held == 0))
+        || header.blob_size != (int64_t)
+            (GB_BLOB_PAD (sizeof (GB_blob_header), align)
+            + GB_BLOB_PAD (header.Ap_len, align)
+            + GB_BLOB_PAD (header.Ah_len, align)
+            + GB_BLOB_PAD (header.Ab_len, align)
+            + GB_BLOB_PAD (header.Ai_len, align)
+            + GB_BLOB_PAD (header.Ax_len, align)))
+    {
+        return (GrB_INVALID_OBJECT) ;
+    }
+    Ax_len = header.Ax_len ;
+
+    // the position of each section in the blob
+    size_t Ap_s = GB_BLOB_PAD (sizeof (GB_blob_header), align) ;
+    size_t Ah_s = Ap_s + GB_BLOB_PAD (header.Ap_len, align) ;
+    size_t Ab_s = Ah_s + GB_BLOB_PAD (header.Ah_len, align) ;
+    size_t Ai_s = Ab_s + GB_BLOB_PAD (header.Ab_len, align) ;
+    size_t Ax_s = Ai_s + GB_BLOB_PAD (header.Ai_len, align) ;
+
+    //--------------------------------------------------------------------------
+    // allocate the header of C
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_new (&C, // any sparsity, new header
+        ctype, vlen, vdim, GB_Ap_null, header.is_csc, sparsity,
+        header.hyper_switch, nvec, Context)) ;
+
+    C->bitmap_switch = header.bitmap_switch ;
+    C->sparsity = header.sparsity_control ;
+    C->index32_control = header.index32_control ;
+    C->bitmap_pack_control = header.bitmap_pack_control ;
+    C->iso = header.iso ;
+    C->nzmax = cnz_held ;
+
+    //--------------------------------------------------------------------------
+    // allocate the content of C, or point it into the blob
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    bool ok = true ;
+    int64_t cplen = C->plen ;
+
+    if (shallow)
+    {
+
+        //----------------------------------------------------------------------
+        // C is a shallow view of the blob
+        //----------------------------------------------------------------------
+
+        GB_void *S = (GB_void *) blob ;
+        if (is_hyper_or_sparse)
+        { 
+            C->p = S + Ap_s ;
+            C->p_shallow = true ;
+            C->p_is_32 = header.p_is_32 ;
+            C->i = S + Ai_s ;
+            C->i_shallow = true ;
+            C->i_is_32 = header.i_is_32 ;
+            C->nvec = nvec ;
+        }
+        if (is_hyper)
+        { 
+            C->h = S + Ah_s ;
+            C->h_shallow = true ;
+            C->h_is_32 = header.h_is_32 ;
+        }
+        if (is_bitmap)
+        { 
+            C->b = (int8_t *) (S + Ab_s) ;
+            C->b_shallow = true ;
+            C->b_is_packed = header.b_is_packed ;
+            C->nvals = nvals ;
+        }
+        if (Ax_len > 0)
+        { 
+            C->x = S + Ax_s ;
+            C->x_shallow = true ;
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // allocate the content of C
+        //----------------------------------------------------------------------
+
+        if (is_hyper_or_sparse)
+        { 
+            C->p = GB_MALLOC ((cplen+1) * psize, GB_void) ;
+            C->p_size = (cplen+1) * psize ;
+            C->p_is_32 = header.p_is_32 ;
+            C->i = GB_MALLOC (GB_IMAX (nvals, 1) * isize, GB_void) ;
+            C->i_size = GB_IMAX (nvals, 1) * isize ;
+            C->i_is_32 = header.i_is_32 ;
+            ok = ok && (C->p != NULL) && (C->i != NULL) ;
+            C->nvec = nvec ;
+        }
+        if (is_hyper)
+        { 
+            C->h = GB_MALLOC (GB_IMAX (cplen, 1) * hsize, GB_void) ;
+            C->h_size = GB_IMAX (cplen, 1) * hsize ;
+            C->h_is_32 = header.h_is_32 ;
+            ok = ok && (C->h != NULL) ;
+        }
+        if (is_bitmap)
+        { 
+            C->b = GB_MALLOC (GB_IMAX (Ab_len, 1), int8_t) ;
+            C->b_size = GB_IMAX (Ab_len, 1) ;
+            C->b_is_packed = header.b_is_packed ;
+            C->nvals = nvals ;
+            ok = ok && (C->b != NULL) ;
+        }
+        if (Ax_len > 0)
+        { 
+            C->x = GB_MALLOC (Ax_len, GB_void) ;
+            C->x_size = Ax_len ;
+            ok = ok && (C->x != NULL) ;
+        }
+        if (!ok)
+        { 
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // copy or uncompress each section of the blob into C
+    //--------------------------------------------------------------------------
+
+    int np_threads = GB_nthreads (np, chunk, nthreads_max) ;
+    int nh_threads = GB_nthreads (nh, chunk, nthreads_max) ;
+    int ni_threads = GB_nthreads (ni, chunk, nthreads_max) ;
+
+    #define GB_READ_INTS(X,X_is_32,s,len,n,nthreads)                        \
+    {                                                                       \
+        if (compress)                                                       \
+        {                                                                   \
+            ok = ok && GB_deserialize_ints (X, X_is_32, n, blob + s, len,   \
+                nthreads) ;                                                 \
+        }                                                                   \
+        else if (len > 0)                                                   \
+        {                                                                   \
+            GB_memcpy (X, blob + s, len, nthreads_max) ;                    \
+        }                                                                   \
+    }
+
+    if (!shallow)
+    {
+        GB_READ_INTS (C->p, C->p_is_32, Ap_s, header.Ap_len, np, np_threads) ;
+        GB_READ_INTS (C->h, C->h_is_32, Ah_s, header.Ah_len, nh, nh_threads) ;
+        if (Ab_len > 0)
+        { 
+            GB_memcpy (C->b, blob + Ab_s, Ab_len, nthreads_max) ;
+        }
+        GB_READ_INTS (C->i, C->i_is_32, Ai_s, header.Ai_len, ni, ni_threads) ;
+        if (Ax_len > 0)
+        { 
+            GB_memcpy (C->x, blob + Ax_s, Ax_len, nthreads_max) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // check the pattern of C
+    //--------------------------------------------------------------------------
+
+    // C->p must be monotonic with C->p [nvec] == nvals, C->h must be strictly
+    // increasing, and the indices in each vector of C->i must be strictly
+    // increasing, so that GraphBLAS methods can safely operate on C.  A
+    // shallow view of the blob is not checked.
+
+    int64_t k ;
+    if (ok && !shallow && is_hyper_or_sparse)
+    {
+        #define GB_CP(k) GB_GETX (C->p, C->p_is_32, k)
+        #define GB_CH(k) GB_GETX (C->h, C->h_is_32, k)
+        #define GB_CI(p) GB_GETX (C->i, C->i_is_32, p)
+        ok = (GB_CP (0) == 0) && (GB_CP (nvec) == nvals) ;
+        if (ok)
+        {
+            #pragma omp parallel for num_threads(np_threads) schedule(static) \
+                reduction(&&:ok)
+            for (k = 0 ; k < nvec ; k++)
+            {
+                ok = ok && (GB_CP (k) <= GB_CP (k+1)) ;
+            }
+        }
+        if (ok && is_hyper)
+        {
+            #pragma omp parallel for num_threads(nh_threads) schedule(static) \
+                reduction(&&:ok)
+            for (k = 0 ; k < nvec ; k++)
+            {
+                int64_t j = GB_CH (k) ;
+                ok = ok && (j >= 0 && j < vdim) &&
+                    (k == 0 || GB_CH (k-1) < j) ;
+            }
+        }
+        if (ok)
+        {
+            int nthreads = GB_nthreads (nvals + nvec, chunk, nthreads_max) ;
+            #pragma omp parallel for num_threads(nthreads) \
+                schedule(dynamic,1024) reduction(&&:ok)
+            for (k = 0 ; k < nvec ; k++)
+            {
+                int64_t ilast = -1 ;
+                for (int64_t p = GB_CP (k) ; ok && p < GB_CP (k+1) ; p++)
+                {
+                    int64_t i = GB_CI (p) ;
+                    ok = (i > ilast && i < vlen) ;
+                    ilast = i ;
+                }
+            }
+        }
+    }
+
+    if (ok && !shallow && is_bitmap)
+    {
+        // count the entries in the bitmap, which must all be 0 or 1
+        int64_t cnvals = 0 ;
+        if (C->b_is_packed)
+        {
+            int64_t nwords = GB_BITMAP_NWORDS (full_size) ;
+            const uint64_t *Cb64 = (uint64_t *) C->b ;
+            int nthreads = GB_nthreads (nwords, chunk, nthreads_max) ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static) \
+                reduction(+:cnvals)
+            for (k = 0 ; k < nwords ; k++)
+            {
+                cnvals += GB_POPCOUNT64 (Cb64 [k]) ;
+            }
+            // the bits past the last position must be zero
+            if (nwords > 0 && full_size % 64 != 0)
+            {
+                ok = (Cb64 [nwords-1] >> (full_size % 64)) == 0 ;
+            }
+        }
+        else
+        {
+            const int8_t *Cb = C->b ;
+            int nthreads = GB_nthreads (full_size, chunk, nthreads_max) ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static) \
+                reduction(+:cnvals) reduction(&&:ok)
+            for (k = 0 ; k < full_size ; k++)
+            {
+                ok = ok && (Cb [k] == 0 || Cb [k] == 1) ;
+                cnvals += Cb [k] ;
+            }
+        }
+        ok = ok && (cnvals == nvals) ;
+    }
+
+    if (!ok)
+    {
+        // the blob is invalid
+        GB_FREE_ALL ;
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    if (is_hyper_or_sparse)
+    {
+        C->nvec_nonempty = -1 ;     // not computed; delay until required
+    }
+    C->magic = GB_MAGIC ;
+    ASSERT_MATRIX_OK (C, "C deserialized", GB0) ;
+    (*Chandle) = C ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -0,0 +1,115 @@
+//------------------------------------------------------------------------------
+// GB_deserialize_ints: uncompress an integer array
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Uncompresses A->p, A->h, or A->i for GxB_Matrix_deserialize, written by
+// GB_serialize_ints (see GB_serialize.h).  Each block is uncompressed
+// independently, in parallel.  The blob may have been corrupted, so the
+// section is never read out of bounds and each integer must be non-negative
+// and fit in X.  Returns false if the section is invalid.  The values of the
+// integers are checked by the caller.
+
+#include "GB_serialize.h"
+
+bool GB_deserialize_ints        // uncompress an integer array
+(
+    // output:
+    void *X,                    // integer array, of size n
+    // input:
+    bool X_is_32,               // if true, X is int32_t, else int64_t
+    int64_t n,                  // size of X
+    const GB_void *GB_RESTRICT S,   // the compressed section of the blob
+    int64_t S_len,              // size of the section, in bytes
+    int nthreads                // # of threads to use
+)
+{
+
+    //--------------------------------------------------------------------------
+    // get the block boundaries
+    //--------------------------------------------------------------------------
+
+    int64_t nblocks = GB_ICEIL (n, GB_BLOB_BLOCKSIZE) ;
+    if (S_len < (int64_t) (nblocks * sizeof (int64_t)))
+    {
+        return (false) ;
+    }
+    const int64_t *GB_RESTRICT Bend = (const int64_t *) S ;
+    const GB_void *GB_RESTRICT D = S + nblocks * sizeof (int64_t) ;
+    int64_t D_len = S_len - nblocks * sizeof (int64_t) ;
+
+    int64_t b ;
+    int64_t blast = 0 ;
+    for (b = 0 ; b < nblocks ; b++)
+    {
+        if (Bend [b] < blast || Bend [b] > D_len)
+        {
+            return (false) ;
+        }
+        blast = Bend [b] ;
+    }
+    if (blast != D_len)
+    {
+        return (false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // uncompress each block
+    //--------------------------------------------------------------------------
+
+    const int64_t xmax = X_is_32 ? INT32_MAX : INT64_MAX ;
+    bool ok = true ;
+
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
+        reduction(&&:ok)
+    for (b = 0 ; b < nblocks ; b++)
+    {
+        int64_t kstart = b * GB_BLOB_BLOCKSIZE ;
+        int64_t kend = GB_IMIN (kstart + GB_BLOB_BLOCKSIZE, n) ;
+        int64_t s = (b == 0) ? 0 : Bend [b-1] ;
+        int64_t send = Bend [b] ;
+        int64_t xlast = 0 ;
+        bool my_ok = true ;
+        for (int64_t k = kstart ; my_ok && k < kend ; k++)
+        {
+            // read z, 7 bits at a time, least significant bits first
+            uint64_t z = 0 ;
+            int shift = 0 ;
+            GB_void c = 0x80 ;
+            while (my_ok && (c & 0x80))
+            {
+                my_ok = (s < send && shift < 64) ;
+                if (my_ok)
+                {
+                    c = D [s++] ;
+                    z |= ((uint64_t) (c & 0x7F)) << shift ;
+                    shift += 7 ;
+                }
+            }
+            int64_t x = (int64_t) ((uint64_t) xlast
+                + (uint64_t) GB_UNZIGZAG (z)) ;
+            my_ok = my_ok && (x >= 0 && x <= xmax) ;
+            if (my_ok)
+            {
+                if (X_is_32)
+                {
+                    ((int32_t *) X) [k] = (int32_t) x ;
+                }
+                else
+                {
+                    ((int64_t *) X) [k] = x ;
+                }
+            }
+            xlast = x ;
+        }
+        // the block must be used exactly
+        ok = ok && my_ok && (s == send) ;
+    }
+
+    return (ok) ;
+}
+
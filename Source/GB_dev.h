@@ -40,13 +40,16 @@
 // FUTURE: can handle transpose of full or bitmap input matrices just by
 // changing how they are accessed
 // 
-// FUTURE: add matrix I/O in binary format (see draft LAGraph_binread/binwrite)
+// FUTURE: matrix I/O in binary format is supported by GxB_Matrix_serialize
+//      and GxB_Matrix_deserialize (see GB_serialize.h), but the blob is held
+//      in native byte order, and the numerical values are not compressed.
 // 
 // For PageRank:
 // 
-//  FUTURE: constant-valued matrices/vectors (for r(:)=teleport)
-//      probably coupled with lazy malloc/free of A->x when converting from
-//      full (non-constant) to constant-valued.
+//  FUTURE: constant-valued matrices/vectors (for r(:)=teleport) are now
+//      supported as iso matrices (see GB_iso.h), but GrB_assign and many
+//      kernels still expand them.  Assigning a scalar to all of a full C
+//      could return C as iso.
 //      need aggressive exploit of non-blocking mode, for x = sum (abs (t-r)),
 //      or GrB_vxv dot product, with PLUS_ABSDIFF semiring
 
@@ -9,7 +9,8 @@
 
 // C = A, making a deep copy.  The header for C may already exist.
 
-// if numeric is false, C->x is allocated but not initialized.
+// if numeric is false, C->x is allocated but not initialized.  If numeric is
+// true and A is iso, then so is C.
 
 #include "GB.h"
 
@@ -33,6 +34,9 @@ GrB_Info GB_dup2            // make an exact copy of a matrix
     // get A
     //--------------------------------------------------------------------------
 
+    // the pattern of A is copied as int64_t, and its bitmap as int8_t
+    ASSERT (!GB_INDEX32 (A)) ;
+    ASSERT (!GB_BITMAP_PACKED (A)) ;
     int64_t anz = GB_NNZ_HELD (A) ;
     int64_t *Ap = A->p ;
     int64_t *Ah = A->h ;
@@ -44,7 +48,10 @@ GrB_Info GB_dup2            // make an exact copy of a matrix
     int64_t anvec_nonempty = A->nvec_nonempty ;
     bool A_jumbled = A->jumbled ;
     int sparsity = A->sparsity ;
+    int index32_control = A->index32_control ;
+    int bitmap_pack_control = A->bitmap_pack_control ;
     GrB_Type atype = A->type ;
+    bool C_iso = numeric && A->iso ;
 
     //--------------------------------------------------------------------------
     // create C
@@ -58,7 +65,21 @@ GrB_Info GB_dup2            // make an exact copy of a matrix
     GrB_Matrix C = (*Chandle) ;
     GrB_Info info = GB_new_bix (&C, // same sparsity as A; old or new header
         numeric ? atype : ctype, A->vlen, A->vdim, GB_Ap_malloc, A->is_csc,
-        GB_sparsity (A), false, A->hyper_switch, A->plen, anz, true, Context) ;
+        GB_sparsity (A), false, A->hyper_switch, A->plen, anz, !C_iso,
+        Context) ;
+    if (info == GrB_SUCCESS && C_iso)
+    { 
+        // C->x has size 1 if C is iso
+        C->x = GB_MALLOC (atype->size, GB_void) ;
+        C->x_size = atype->size ;
+        C->iso = true ;
+        if (C->x == NULL)
+        { 
+            // out of memory
+            GB_Matrix_free (&C) ;
+            info = GrB_OUT_OF_MEMORY ;
+        }
+    }
     if (info != GrB_SUCCESS)
     { 
         // out of memory
@@ -74,6 +95,8 @@ GrB_Info GB_dup2            // make an exact copy of a matrix
     C->nvals = anvals ;             // for bitmap only
     C->jumbled = A_jumbled ;        // C is jumbled if A is jumbled
     C->sparsity = sparsity ;        // copy in the sparsity control
+    C->index32_control = index32_control ;
+    C->bitmap_pack_control = bitmap_pack_control ;
 
     if (Ap != NULL)
     { 
@@ -93,7 +116,7 @@ GrB_Info GB_dup2            // make an exact copy of a matrix
     }
     if (numeric)
     { 
-        GB_memcpy (C->x, Ax, anz * atype->size, nthreads_max) ;
+        GB_memcpy (C->x, Ax, (C_iso ? 1 : anz) * atype->size, nthreads_max) ;
     }
 
     C->magic = GB_MAGIC ;      // C->p and C->h are now initialized
@@ -20,6 +20,9 @@
 // On input, ntasks is the # of tasks requested.  On output, it may be
 // modified if too large or too small.
 
+// The three arrays are workspace, taken from the memory pool if it is enabled
+// (see GB_pool_malloc).  They must be freed with GB_ek_slice_free.
+
 // A can have any sparsity structure (sparse, hyper, bitmap, or full)
 
 #include "GB_ek_slice.h"
@@ -78,9 +81,9 @@ bool GB_ek_slice        // true if successful, false if out of memory
     (*kfirst_slice_handle) = NULL ;
     (*klast_slice_handle ) = NULL ;
 
-    int64_t *GB_RESTRICT pstart_slice = GB_CALLOC (ntasks+1, int64_t) ;
-    int64_t *GB_RESTRICT kfirst_slice = GB_CALLOC (ntasks  , int64_t) ;
-    int64_t *GB_RESTRICT klast_slice  = GB_CALLOC (ntasks  , int64_t) ;
+    int64_t *GB_RESTRICT pstart_slice = GB_CALLOC_POOL (ntasks+1, int64_t) ;
+    int64_t *GB_RESTRICT kfirst_slice = GB_CALLOC_POOL (ntasks  , int64_t) ;
+    int64_t *GB_RESTRICT klast_slice  = GB_CALLOC_POOL (ntasks  , int64_t) ;
 
     if (pstart_slice == NULL || kfirst_slice == NULL || klast_slice == NULL)
     { 
@@ -19,7 +19,7 @@
 {                                                                              \
     X ## _nthreads = GB_nthreads (GB_NNZ (X) + X->nvec, chunk, nthreads_max) ; \
     X ## _ntasks = (X ## _nthreads == 1) ? 1 :                                 \
-        ((NTASKS_PER_THREAD) * (X ## _nthreads)) ;                             \
+        (GB_NUMA_NTASKS (NTASKS_PER_THREAD) * (X ## _nthreads)) ;              \
     if (!GB_ek_slice (&(pstart_ ## X ## slice), &(kfirst_ ## X ## slice),      \
         &(klast_ ## X ## slice), X, &(X ## _ntasks)))                          \
     {                                                                          \
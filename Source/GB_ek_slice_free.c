@@ -16,8 +16,8 @@ void GB_ek_slice_free
     int64_t *GB_RESTRICT *klast_slice_handle
 )
 { 
-    GB_FREE (*pstart_slice_handle) ;
-    GB_FREE (*kfirst_slice_handle) ;
-    GB_FREE (*klast_slice_handle) ;
+    GB_FREE_POOL (*pstart_slice_handle) ;
+    GB_FREE_POOL (*kfirst_slice_handle) ;
+    GB_FREE_POOL (*klast_slice_handle) ;
 }
 
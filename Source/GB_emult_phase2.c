@@ -148,6 +148,7 @@ GrB_Info GB_emult_phase2                // C=A.*B or C<M>=A.*B
     { 
         C->nvec_nonempty = Cnvec_nonempty ;
         C->p = (int64_t *) Cp ;
+        C->p_size = (Cnvec+1) * sizeof (int64_t) ;
     }
 
     // add Ch as the the hypersparse list for C, from GB_emult_phase0
@@ -11,12 +11,17 @@
 // optionally transposed.  Does the work for GrB_eWiseAdd_* and
 // GrB_eWiseMult_*.  Handles all cases of the mask.
 
+// If A, B, or M are iso, GB_ewise passes expanded copies of them to
+// GB_ewise_worker.  T is iso if GB_iso_ewise determines that all its entries
+// have the same value.
+
 #include "GB_ewise.h"
 #include "GB_add.h"
 #include "GB_emult.h"
 #include "GB_transpose.h"
 #include "GB_accum_mask.h"
 #include "GB_dense.h"
+#include "GB_iso.h"
 
 #define GB_FREE_ALL         \
 {                           \
@@ -26,7 +31,11 @@
     GB_Matrix_free (&MT) ;  \
 }
 
-GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
+//------------------------------------------------------------------------------
+// GB_ewise_worker: C<M> = accum (C, A+B) or A.*B, where A, B, M are not iso
+//------------------------------------------------------------------------------
+
+static GrB_Info GB_ewise_worker     // C<M> = accum (C, A+B) or A.*B
 (
     GrB_Matrix C,                   // input/output matrix for results
     const bool C_replace,           // if true, clear C before writing to it
@@ -41,6 +50,7 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
     bool B_transpose,               // if true, use B' instead of B
     bool eWiseAdd,                  // if true, do set union (like A+B),
                                     // otherwise do intersection (like A.*B)
+    const GB_void *T_iso_value,     // value of T if iso, or NULL if not iso
     GB_Context Context
 )
 {
@@ -189,10 +199,11 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
     if (M_transpose)
     { 
         // MT = M'
-        // transpose: no typecast, no op, not in-place
+        // transpose: typecast, no op, not in-place; pattern only if the
+        // mask is structural
         GBURBLE ("(M transpose) ") ;
-        GB_OK (GB_transpose (&MT, GrB_BOOL, T_is_csc, M,
-            NULL, NULL, NULL, false, Context)) ;
+        GB_OK (GB_transpose_cast (&MT, GrB_BOOL, T_is_csc, M, Mask_struct,
+            Context)) ;
         M1 = MT ;
     }
 
@@ -281,6 +292,12 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
         && !any_bitmap)
     {
 
+        if (C_is_dense)
+        { 
+            // C is modified in-place below, so a shallow C is copied first
+            GB_OK (GB_unshallow (C, Context)) ;
+        }
+
         if (C_is_dense                      // C is dense
         && accum == op                      // accum is same as the op
         && (opcode >= GB_MIN_opcode)        // subset of binary operators
@@ -453,6 +470,12 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
         }
     }
 
+    if (T_iso_value != NULL && !T->iso)
+    { 
+        // all entries of T have the same value
+        GB_OK (GB_iso_compress (T, T_iso_value, Context)) ;
+    }
+
     //--------------------------------------------------------------------------
     // free the transposed matrices
     //--------------------------------------------------------------------------
@@ -490,3 +513,68 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
     }
 }
 
+//------------------------------------------------------------------------------
+// GB_ewise: C<M> = accum (C, A+B) or A.*B
+//------------------------------------------------------------------------------
+
+#undef  GB_FREE_ALL
+#define GB_FREE_ALL             \
+{                               \
+    GB_Matrix_free (&M2) ;      \
+    GB_Matrix_free (&A2) ;      \
+    GB_Matrix_free (&B2) ;      \
+}
+
+GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const bool C_replace,           // if true, clear C before writing to it
+    const GrB_Matrix M,             // optional mask for C, unused if NULL
+    const bool Mask_comp,           // if true, complement the mask M
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_BinaryOp op_in,       // defines '+' for C=A+B, or .* for A.*B
+    const GrB_Matrix A,             // input matrix
+    bool A_transpose,               // if true, use A' instead of A
+    const GrB_Matrix B,             // input matrix
+    bool B_transpose,               // if true, use B' instead of B
+    bool eWiseAdd,                  // if true, do set union (like A+B),
+                                    // otherwise do intersection (like A.*B)
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // determine if T is iso
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GrB_Matrix M2 = NULL, A2 = NULL, B2 = NULL ;
+    ASSERT_BINARYOP_OK (op_in, "op for GB_ewise", GB0) ;
+    GB_void T_iso_value [GB_VLA(op_in->ztype->size)] ;
+    bool T_iso = GB_iso_ewise (T_iso_value, op_in, eWiseAdd, A, B) ;
+
+    //--------------------------------------------------------------------------
+    // expand any iso matrices
+    //--------------------------------------------------------------------------
+
+    bool M_struct = Mask_struct ;
+    GB_OK (GB_iso_expand (C, Context)) ;
+    GB_OK (GB_convert_int32_to_int64 (C, Context)) ;
+    GB_OK (GB_convert_packed_to_bitmap (C, Context)) ;
+    GB_OK (GB_iso_mask (&M2, &M_struct, M, Context)) ;
+    GB_OK (GB_iso_expand_copy (&A2, A, Context)) ;
+    GB_OK (GB_iso_expand_copy (&B2, B, Context)) ;
+
+    //--------------------------------------------------------------------------
+    // C<M> = accum (C, A+B) or A.*B
+    //--------------------------------------------------------------------------
+
+    info = GB_ewise_worker (C, C_replace,
+        (M2 == NULL) ? M : M2, Mask_comp, M_struct, accum, op_in,
+        (A2 == NULL) ? A : A2, A_transpose,
+        (B2 == NULL) ? B : B2, B_transpose,
+        eWiseAdd, T_iso ? T_iso_value : NULL, Context) ;
+    GB_FREE_ALL ;
+    return (info) ;
+}
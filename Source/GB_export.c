@@ -8,9 +8,10 @@
 //------------------------------------------------------------------------------
 
 // No conversion is done, and the matrix is exported in its current sparsity
-// structure and by-row/by-col format.
+// structure and by-row/by-col format.  An iso matrix is expanded first.
 
 #include "GB_export.h"
+#include "GB_iso.h"
 
 GrB_Info GB_export      // export a matrix in any format
 (
@@ -86,33 +87,74 @@ GrB_Info GB_export      // export a matrix in any format
         default: ;
     }
 
+    //--------------------------------------------------------------------------
+    // expand an iso matrix, hold its pattern in 64-bit integers, and unpack
+    //--------------------------------------------------------------------------
+
+    // the exported arrays are owned by the user application, so the shallow
+    // components of a matrix imported with GxB_SHALLOW_IMPORT are copied
+    GrB_Info info = GB_unshallow (*A, Context) ;
+    if (info == GrB_SUCCESS)
+    { 
+        info = GB_iso_expand (*A, Context) ;
+    }
+    if (info == GrB_SUCCESS)
+    { 
+        // the exported arrays are int64_t
+        info = GB_convert_int32_to_int64 (*A, Context) ;
+    }
+    if (info == GrB_SUCCESS)
+    { 
+        // the exported bitmap is int8_t
+        info = GB_convert_packed_to_bitmap (*A, Context) ;
+    }
+    if (info != GrB_SUCCESS)
+    { 
+        // out of memory
+        return (info) ;
+    }
+
     //--------------------------------------------------------------------------
     // export the matrix
     //--------------------------------------------------------------------------
 
+    // the size of each exported array is the space actually allocated for it,
+    // which may exceed A->nzmax or A->plen
+    int64_t nzmax = (*A)->nzmax ;
+    int64_t plen = (*A)->plen ;
+    int64_t ap_size = (*A)->p_size / sizeof (int64_t) ;
+    int64_t ah_size = (*A)->h_size / sizeof (int64_t) ;
+    int64_t ab_size = (*A)->b_size / sizeof (int8_t) ;
+    int64_t ai_size = (*A)->i_size / sizeof (int64_t) ;
+    int64_t ax_size = (*A)->x_size / (*A)->type->size ;
     (*type) = (*A)->type ;
     (*vlen) = (*A)->vlen ;
     (*vdim) = (*A)->vdim ;
-    (*Ax) = (*A)->x ; (*A)->x = NULL ; (*Ax_size) = (*A)->nzmax ;
+    (*Ax) = (*A)->x ; (*A)->x = NULL ;
+    (*Ax_size) = GB_IMAX (nzmax, ax_size) ;
 
     switch (s)
     {
         case GxB_HYPERSPARSE : 
             (*nvec) = (*A)->nvec ;
-            (*Ah) = (*A)->h ; (*A)->h = NULL ; (*Ah_size) = (*A)->plen ;
+            (*Ah) = (*A)->h ; (*A)->h = NULL ;
+            (*Ah_size) = GB_IMAX (plen, ah_size) ;
 
         case GxB_SPARSE : 
             if (jumbled != NULL)
             { 
                 (*jumbled) = (*A)->jumbled ;
             }
-            (*Ap) = (*A)->p ; (*A)->p = NULL ; (*Ap_size) = (*A)->plen + 1 ;
-            (*Ai) = (*A)->i ; (*A)->i = NULL ; (*Ai_size) = (*A)->nzmax ;
+            (*Ap) = (*A)->p ; (*A)->p = NULL ;
+            (*Ap_size) = GB_IMAX (plen+1, ap_size) ;
+            (*Ai) = (*A)->i ; (*A)->i = NULL ;
+            (*Ai_size) = GB_IMAX (nzmax, ai_size) ;
             break ;
 
         case GxB_BITMAP : 
             (*nvals) = (*A)->nvals ;
-            (*Ab) = (*A)->b ; (*A)->b = NULL ; (*Ab_size) = (*A)->nzmax ;
+            (*Ab) = (*A)->b ; (*A)->b = NULL ;
+            (*Ab_size) = GB_IMAX (nzmax, ab_size) ;
 
         case GxB_FULL : 
 
@@ -45,6 +45,7 @@ GrB_Info GB_import      // import a matrix in any format
     // information for all formats:
     int sparsity,       // hypersparse, sparse, bitmap, or full
     bool is_csc,        // if true then matrix is by-column, else by-row
+    bool shallow,       // if true, the user arrays are not transplanted
     GB_Context Context
 ) ;
 
@@ -19,11 +19,19 @@
 
 // C<M> = accum (C, A(Cols,Rows)')
 
+// If A is iso, T is extracted from an expanded copy of A, and is then made
+// iso with the same value as A.
+
 #include "GB_extract.h"
 #include "GB_subref.h"
 #include "GB_accum_mask.h"
+#include "GB_iso.h"
 
-#define GB_FREE_ALL ;
+#define GB_FREE_ALL             \
+{                               \
+    GB_Matrix_free (&A2) ;      \
+    GB_Matrix_free (&T) ;       \
+}
 
 GrB_Info GB_extract                 // C<M> = accum (C, A(I,J))
 (
@@ -50,6 +58,7 @@ GrB_Info GB_extract                 // C<M> = accum (C, A(I,J))
     // C may be aliased with M and/or A
 
     GrB_Info info ;
+    GrB_Matrix A2 = NULL, T = NULL ;
     GB_RETURN_IF_NULL (Rows) ;
     GB_RETURN_IF_NULL (Cols) ;
     GB_RETURN_IF_FAULTY_OR_POSITIONAL (accum) ;
@@ -159,8 +168,15 @@ GrB_Info GB_extract                 // C<M> = accum (C, A(I,J))
     // T = A (I,J)
     //--------------------------------------------------------------------------
 
-    GrB_Matrix T ;
-    GB_OK (GB_subref (&T, T_is_csc, A, I, ni, J, nj, false, Context)) ;
+    GB_OK (GB_iso_expand_copy (&A2, A, Context)) ;
+    GB_OK (GB_subref (&T, T_is_csc, (A2 == NULL) ? A : A2, I, ni, J, nj, false,
+        Context)) ;
+    GB_Matrix_free (&A2) ;
+    if (A->iso)
+    { 
+        // all entries of T have the same value as A
+        GB_OK (GB_iso_compress (T, (GB_void *) A->x, Context)) ;
+    }
     ASSERT_MATRIX_OK (T, "T extracted", GB0) ;
     ASSERT (GB_JUMBLED_OK (T)) ;
 
@@ -16,6 +16,9 @@
 // This function does the work for the user-callable GrB_*_extractTuples
 // functions.
 
+// If A is iso, its single value is typecasted into X [0] and then copied into
+// the rest of X.
+
 #include "GB.h"
 
 #define GB_FREE_ALL         \
@@ -78,6 +81,7 @@ GrB_Info GB_extractTuples       // extract all tuples from a matrix
     }
 
     const size_t asize = A->type->size ;
+    const bool A_iso = A->iso ;
 
     //-------------------------------------------------------------------------
     // determine the number of threads to use
@@ -113,7 +117,7 @@ GrB_Info GB_extractTuples       // extract all tuples from a matrix
         // allocate workspace
         //----------------------------------------------------------------------
 
-        bool need_typecast = (X != NULL) && (xcode != acode) ;
+        bool need_typecast = (X != NULL) && (xcode != acode) && !A_iso ;
         if (need_typecast)
         { 
             // X must be typecasted
@@ -136,7 +140,7 @@ GrB_Info GB_extractTuples       // extract all tuples from a matrix
         // typecasting.  This works for now, however.
 
         GB_OK (GB_convert_bitmap_worker (Ap, I, J,
-            need_typecast ? X_bitmap : X, NULL, A, Context)) ;
+            A_iso ? NULL : (need_typecast ? X_bitmap : X), NULL, A, Context)) ;
 
         //----------------------------------------------------------------------
         // typecast the result if needed
@@ -197,7 +201,7 @@ GrB_Info GB_extractTuples       // extract all tuples from a matrix
         // extract the values
         //----------------------------------------------------------------------
 
-        if (X != NULL)
+        if (X != NULL && !A_iso)
         { 
             // typecast or copy the values from A into X
             GB_cast_array ((GB_void *) X, xcode, (GB_void *) A->x,
@@ -205,6 +209,25 @@ GrB_Info GB_extractTuples       // extract all tuples from a matrix
         }
     }
 
+    //--------------------------------------------------------------------------
+    // extract the values of an iso matrix
+    //--------------------------------------------------------------------------
+
+    if (X != NULL && A_iso)
+    { 
+        // X [0] = (xtype) A->x [0], then copy X [0] into all of X
+        GB_cast_array ((GB_void *) X, xcode, (GB_void *) A->x,
+            acode, NULL, asize, 1, 1) ;
+        const size_t xsize = GB_code_size (xcode, asize) ;
+        GB_void *GB_RESTRICT Xv = (GB_void *) X ;
+        int64_t p ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (p = 1 ; p < anz ; p++)
+        { 
+            memcpy (Xv + p * xsize, Xv, xsize) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // free workspace and return result 
     //--------------------------------------------------------------------------
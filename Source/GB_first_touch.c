@@ -0,0 +1,133 @@
+//------------------------------------------------------------------------------
+// GB_first_touch: prepare a large block of memory for use by many threads
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Called by GB_malloc_memory and GB_calloc_memory for each block of at least
+// GB_FIRST_TOUCH_MIN bytes.  If GxB_MEMORY_HUGE_PAGES is enabled, the block is
+// advised to be backed by transparent huge pages, where the operating system
+// supports them.  If clear is true, the block is set to zero in parallel,
+// with a static partition of the block across the threads, so that each page
+// is first touched (and thus placed, on a NUMA system) by the thread that is
+// likely to use it in the kernels, which partition their bitmap and full
+// matrices in the same way (see GB_PARTITION).  The number of threads is
+// determined by the global nthreads_max and chunk settings.
+
+// The GxB_NUMA_POLICY modifies how the pages are touched.  With
+// GxB_NUMA_INTERLEAVE, the pages are touched round-robin by all the threads.
+// With GxB_NUMA_BY_TASK, each thread touches its own part of the block, with
+// the static partition above.  With either policy, a block that is not
+// cleared is still touched (one byte per page), so its pages are placed now
+// rather than by the first thread that writes to them later.
+
+#include "GB.h"
+#if defined ( __linux__ )
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+void GB_first_touch
+(
+    void *p,                // block of memory to prepare
+    size_t size,            // size of the block, in bytes
+    bool clear              // if true, set the block to zero
+)
+{
+
+    //--------------------------------------------------------------------------
+    // advise the operating system to use huge pages
+    //--------------------------------------------------------------------------
+
+    #if defined ( __linux__ ) && defined ( MADV_HUGEPAGE )
+    if (GB_Global_huge_pages_get ( ) && size >= GB_HUGE_PAGE_SIZE)
+    { 
+        // madvise requires the start of the region to be page-aligned.  The
+        // advice is ignored if it fails.
+        uintptr_t page = (uintptr_t) sysconf (_SC_PAGESIZE) ;
+        uintptr_t start = ((uintptr_t) p + page - 1) & ~(page - 1) ;
+        uintptr_t end = ((uintptr_t) p + size) & ~(page - 1) ;
+        if (end > start)
+        { 
+            madvise ((void *) start, end - start, MADV_HUGEPAGE) ;
+        }
+    }
+    #endif
+
+    //--------------------------------------------------------------------------
+    // clear or touch the block in parallel
+    //--------------------------------------------------------------------------
+
+    int policy = GB_Global_numa_policy_get ( ) ;
+    if (!clear && policy == GxB_NUMA_DEFAULT)
+    { 
+        // nothing to do
+        return ;
+    }
+
+    int nthreads = GB_nthreads (size, GB_Global_chunk_get ( ),
+        GB_Global_nthreads_max_get ( )) ;
+    if (!clear && nthreads == 1)
+    { 
+        // a single thread touches all pages of the block; leave the pages to
+        // be placed by the thread that first writes to them
+        return ;
+    }
+
+    GB_void *pdest = (GB_void *) p ;
+
+    if (policy == GxB_NUMA_INTERLEAVE)
+    {
+
+        //----------------------------------------------------------------------
+        // touch the pages round-robin across the threads
+        //----------------------------------------------------------------------
+
+        int64_t npages = GB_ICEIL (size, GB_PAGE_SIZE) ;
+        int64_t kpage ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+        for (kpage = 0 ; kpage < npages ; kpage++)
+        {
+            int64_t pstart = kpage * GB_PAGE_SIZE ;
+            int64_t pend = GB_IMIN (pstart + GB_PAGE_SIZE, (int64_t) size) ;
+            if (clear)
+            { 
+                memset (pdest + pstart, 0, pend - pstart) ;
+            }
+            else
+            { 
+                pdest [pstart] = 0 ;
+            }
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // each thread touches a contiguous part of the block
+        //----------------------------------------------------------------------
+
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            int64_t pstart, pend ;
+            GB_PARTITION (pstart, pend, size, tid, nthreads) ;
+            if (clear)
+            { 
+                memset (pdest + pstart, 0, pend - pstart) ;
+            }
+            else
+            {
+                for (int64_t pp = pstart ; pp < pend ; pp += GB_PAGE_SIZE)
+                { 
+                    pdest [pp] = 0 ;
+                }
+            }
+        }
+    }
+}
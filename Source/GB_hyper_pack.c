@@ -40,6 +40,8 @@ GrB_Matrix GB_hyper_pack            // return C
     C->p_shallow = true ;
     C->i_shallow = true ;
     C->x_shallow = true ;
+    C->mmap_shallow = (A->mmap_base != NULL) ;
+    GB_PATTERN_CHANGED (C) ;
 
     // C reduces in dimension to the # of vectors in A
     C->vdim = C->nvec ;
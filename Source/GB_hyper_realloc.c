@@ -59,6 +59,8 @@ GrB_Info GB_hyper_realloc
 
         // size of A->p and A->h has been changed
         A->plen = plen_new ;
+        A->p_size = (plen_new+1) * sizeof (int64_t) ;
+        A->h_size = plen_new * sizeof (int64_t) ;
     }
 
     //--------------------------------------------------------------------------
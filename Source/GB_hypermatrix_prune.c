@@ -23,6 +23,7 @@ GrB_Info GB_hypermatrix_prune
     ASSERT (A != NULL) ;
     ASSERT (GB_ZOMBIES_OK (A)) ;        // pattern not accessed
     ASSERT (GB_JUMBLED_OK (A)) ;
+    GB_PATTERN_CHANGED (A) ;
 
     if (!GB_IS_HYPERSPARSE (A))
     { 
@@ -61,6 +62,8 @@ GrB_Info GB_hypermatrix_prune
         // transplant the new hyperlist into A
         A->p = Ap_new ;
         A->h = Ah_new ;
+        A->p_size = (nvec_new+1) * sizeof (int64_t) ;
+        A->h_size = nvec_new * sizeof (int64_t) ;
         A->nvec = nvec_new ;
         A->plen = nvec_new ;
         A->nvec_nonempty = nvec_new ;
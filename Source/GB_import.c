@@ -7,7 +7,11 @@
 
 //------------------------------------------------------------------------------
 
-// TODO: import shallow for MATLAB
+// If shallow is true, the arrays of the user application are not transplanted
+// into A, but are held in A as shallow components, and the user pointers are
+// left unchanged.  The user application still owns the arrays, and must not
+// modify or free them until A is freed.  A method that needs to modify A
+// in-place first makes its own copy of the arrays (see GB_unshallow).
 
 #include "GB_export.h"
 
@@ -52,6 +56,7 @@ GrB_Info GB_import      // import a matrix in any format
     // information for all formats:
     int sparsity,       // hypersparse, sparse, bitmap, or full
     bool is_csc,        // if true then matrix is by-column, else by-row
+    bool shallow,       // if true, the user arrays are not transplanted
     GB_Context Context
 )
 {
@@ -177,27 +182,37 @@ GrB_Info GB_import      // import a matrix in any format
     // transplant the user's content into the matrix
     (*A)->magic = GB_MAGIC ;
 
-    // TODO: keep Ap_size, Ah_size, Ab_size, Ai_size, Ax_size in the
-    // GrB_Matrix data structure, and remove A->nzmax.
+    // The sizes of the user arrays are kept in the matrix, so that any space
+    // beyond what A->plen and A->nzmax require can be reused.  A shallow
+    // component has a size of zero, since it is not owned by the matrix.
+    const size_t ssize = shallow ? 0 : sizeof (int64_t) ;
 
     switch (sparsity)
     {
         case GxB_HYPERSPARSE : 
             // transplant Ah and fall through to sparse case
             (*A)->nvec = nvec ;
-            (*A)->h = (int64_t *) (*Ah) ; (*Ah) = NULL ;
+            (*A)->h = (int64_t *) (*Ah) ; if (!shallow) (*Ah) = NULL ;
+            (*A)->h_size = Ah_size * ssize ;
+            (*A)->h_shallow = shallow ;
 
         case GxB_SPARSE : 
             (*A)->jumbled = jumbled ;   // import jumbled status
             (*A)->nvec_nonempty = -1 ;  // not computed; delay until required
-            (*A)->p = (int64_t *) (*Ap) ; (*Ap) = NULL ;
-            (*A)->i = (int64_t *) (*Ai) ; (*Ai) = NULL ;
+            (*A)->p = (int64_t *) (*Ap) ; if (!shallow) (*Ap) = NULL ;
+            (*A)->i = (int64_t *) (*Ai) ; if (!shallow) (*Ai) = NULL ;
+            (*A)->p_size = Ap_size * ssize ;
+            (*A)->i_size = Ai_size * ssize ;
+            (*A)->p_shallow = shallow ;
+            (*A)->i_shallow = shallow ;
             (*A)->nzmax = GB_IMIN (Ai_size, Ax_size) ;
             break ;
 
         case GxB_BITMAP : 
             (*A)->nvals = nvals ;
-            (*A)->b = (*Ab) ; (*Ab) = NULL ;
+            (*A)->b = (*Ab) ; if (!shallow) (*Ab) = NULL ;
+            (*A)->b_size = shallow ? 0 : (Ab_size * sizeof (int8_t)) ;
+            (*A)->b_shallow = shallow ;
             (*A)->nzmax = GB_IMIN (Ab_size, Ax_size) ;
             break ;
 
@@ -210,7 +225,9 @@ GrB_Info GB_import      // import a matrix in any format
 
     if (Ax != NULL)
     { 
-        (*A)->x = (*Ax) ; (*Ax) = NULL ;
+        (*A)->x = (*Ax) ; if (!shallow) (*Ax) = NULL ;
+        (*A)->x_size = shallow ? 0 : (Ax_size * type->size) ;
+        (*A)->x_shallow = shallow && ((*A)->x != NULL) ;
     }
 
     //--------------------------------------------------------------------------
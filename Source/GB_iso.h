@@ -0,0 +1,99 @@
+//------------------------------------------------------------------------------
+// GB_iso.h: definitions for iso-valued matrices
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// An iso-valued matrix has A->iso true, and all of its entries have the same
+// value, held in A->x [0].  A->x has size 1 (one entry of size A->type->size)
+// instead of A->nzmax.  The pattern of an iso matrix is held as usual, in any
+// sparsity structure (hypersparse, sparse, bitmap, or full).
+
+// Iso matrices are created by GrB_Matrix_build when all the values are the
+// same, and are propagated through GrB_mxm (with PAIR, or with FIRST or
+// SECOND and an iso input, and an idempotent monoid: ANY, MIN, MAX, LOR,
+// LAND, BOR, or BAND), GrB_eWiseMult, GrB_eWiseAdd, GxB_select, GrB_apply,
+// GrB_transpose, and GrB_Matrix_dup, when the result has a single value.
+// Conversions between sparsity structures preserve the iso property.
+
+// Methods that do not exploit iso matrices work on a temporary copy of their
+// iso inputs, with A->x expanded to its full size (see GB_iso_expand_copy).
+// A matrix that is modified in-place (by GrB_setElement, GrB_assign,
+// GxB_subassign, GrB_Matrix_resize, or an export) is first expanded in-place
+// with GB_iso_expand, and is then no longer iso.
+
+#ifndef GB_ISO_H
+#define GB_ISO_H
+#include "GB.h"
+
+GrB_Info GB_iso_expand          // expand an iso matrix into a non-iso matrix
+(
+    GrB_Matrix A,               // matrix to expand, in-place
+    GB_Context Context
+) ;
+
+GrB_Info GB_iso_expand_copy     // C = A, with A->x expanded
+(
+    GrB_Matrix *Chandle,        // output matrix, or NULL if A is not iso
+    const GrB_Matrix A,         // input matrix, not modified
+    GB_Context Context
+) ;
+
+bool GB_iso_check               // true if all entries of A are the same
+(
+    const GrB_Matrix A,         // matrix to check
+    GB_Context Context
+) ;
+
+GrB_Info GB_iso_compress        // convert a matrix to iso
+(
+    GrB_Matrix A,               // matrix to convert, in-place
+    const GB_void *value,       // value of all entries of A, of type A->type
+    GB_Context Context
+) ;
+
+bool GB_iso_binop               // true if z=op(x,y) is the same for all x,y
+(
+    // output:
+    GB_void *z,                 // the value of z, of type op->ztype
+    // input:
+    const GrB_BinaryOp op,      // binary operator
+    const bool flipxy,          // if true, z=op(b,a) instead of op(a,b)
+    const GrB_Matrix A,         // all entries a of A
+    const GrB_Matrix B          // all entries b of B
+) ;
+
+bool GB_iso_ewise               // true if C=A+B or C=A.*B is iso
+(
+    // output:
+    GB_void *z,                 // the value of C, of type op->ztype
+    // input:
+    const GrB_BinaryOp op,      // binary operator for A+B or A.*B
+    const bool eWiseAdd,        // if true, C=A+B, otherwise C=A.*B
+    const GrB_Matrix A,
+    const GrB_Matrix B
+) ;
+
+bool GB_iso_semiring            // true if C=A*B is iso
+(
+    // output:
+    GB_void *z,                 // the value of C, of type semiring ztype
+    // input:
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool flipxy,          // if true, do z=fmult(b,a) vs fmult(a,b)
+    const GrB_Matrix A,
+    const GrB_Matrix B
+) ;
+
+GrB_Info GB_iso_mask            // prepare an iso mask for use
+(
+    GrB_Matrix *M2_handle,      // expanded copy of M, if needed; else NULL
+    bool *Mask_struct,          // set true if M is iso and nonzero
+    const GrB_Matrix M,         // mask matrix, may be NULL
+    GB_Context Context
+) ;
+
+#endif
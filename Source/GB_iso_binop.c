@@ -0,0 +1,168 @@
+//------------------------------------------------------------------------------
+// GB_iso_binop: determine if z=op(a,b) is the same for all entries a and b
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Returns true if z=op(a,b) has the same value for all entries a in A and b in
+// B (or z=op(b,a) if flipxy is true), and returns that value in z.  This holds
+// if A is iso, or if the op does not depend on a, and likewise for B.  The
+// positional operators depend on the position of a and b, not their values,
+// so their result is never iso.  The values of A and B are typecasted to the
+// op->xtype and op->ytype.  A or B may be NULL, if the op does not depend on
+// them.
+
+#include "GB_iso.h"
+
+bool GB_iso_binop               // true if z=op(x,y) is the same for all x,y
+(
+    // output:
+    GB_void *z,                 // the value of z, of type op->ztype
+    // input:
+    const GrB_BinaryOp op,      // binary operator
+    const bool flipxy,          // if true, z=op(b,a) instead of op(a,b)
+    const GrB_Matrix A,         // all entries a of A
+    const GrB_Matrix B          // all entries b of B
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    if (op == NULL || op->function == NULL || GB_OP_IS_POSITIONAL (op))
+    { 
+        // the implicit FIRST operator of GB_reduce_to_vector and the
+        // positional operators are not considered
+        return (false) ;
+    }
+
+    // X is the matrix whose values are passed as x to the op, Y for y
+    GrB_Matrix X = (flipxy) ? B : A ;
+    GrB_Matrix Y = (flipxy) ? A : B ;
+
+    GB_Opcode opcode = op->opcode ;
+    bool op_uses_x = !(opcode == GB_SECOND_opcode || opcode == GB_PAIR_opcode) ;
+    bool op_uses_y = !(opcode == GB_FIRST_opcode  || opcode == GB_PAIR_opcode) ;
+    if ((op_uses_x && (X == NULL || !X->iso)) ||
+        (op_uses_y && (Y == NULL || !Y->iso)))
+    { 
+        // the result depends on an input that is not iso
+        return (false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // z = op (x,y)
+    //--------------------------------------------------------------------------
+
+    GB_void x [GB_VLA(op->xtype->size)] ;
+    GB_void y [GB_VLA(op->ytype->size)] ;
+    memset (x, 0, op->xtype->size) ;
+    memset (y, 0, op->ytype->size) ;
+    if (op_uses_x)
+    { 
+        GB_cast_function cast_X = GB_cast_factory (op->xtype->code,
+            X->type->code) ;
+        cast_X (x, X->x, X->type->size) ;
+    }
+    if (op_uses_y)
+    { 
+        GB_cast_function cast_Y = GB_cast_factory (op->ytype->code,
+            Y->type->code) ;
+        cast_Y (y, Y->x, Y->type->size) ;
+    }
+    op->function (z, x, y) ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_iso_semiring: determine if C=A*B is iso
+//------------------------------------------------------------------------------
+
+// Returns true if all entries of C=A*B have the same value, for any pattern
+// of A and B.  This holds if z=mult(a,b) is the same for all entries, and if
+// the monoid is idempotent (z = add (z,z) for all z), so that summing any
+// number of identical terms gives the same result.
+
+bool GB_iso_semiring            // true if C=A*B is iso
+(
+    // output:
+    GB_void *z,                 // the value of C, of type semiring ztype
+    // input:
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool flipxy,          // if true, do z=fmult(b,a) vs fmult(a,b)
+    const GrB_Matrix A,
+    const GrB_Matrix B
+)
+{
+
+    GrB_BinaryOp add = semiring->add->op ;
+    bool idempotent ;
+    switch (add->opcode)
+    {
+        case GB_ANY_opcode :
+        case GB_MIN_opcode :
+        case GB_MAX_opcode :
+        case GB_BOR_opcode :
+        case GB_BAND_opcode :
+            idempotent = true ;
+            break ;
+        case GB_LOR_opcode :
+        case GB_LAND_opcode :
+            // z = (x != 0) || (x != 0) is equal to x only if x is boolean
+            idempotent = (add->ztype == GrB_BOOL) ;
+            break ;
+        default :
+            idempotent = false ;
+            break ;
+    }
+
+    return (idempotent && GB_iso_binop (z, semiring->multiply, flipxy, A, B)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_iso_ewise: determine if C=A+B or C=A.*B is iso
+//------------------------------------------------------------------------------
+
+// C=A.*B is iso if z=op(a,b) is the same for all entries.  Entries of C=A+B
+// that appear in just A or B are typecasted from A or B, not computed with the
+// op, so both A and B must be iso and their values, typecasted to op->ztype,
+// must also equal z.
+
+bool GB_iso_ewise               // true if C=A+B or C=A.*B is iso
+(
+    // output:
+    GB_void *z,                 // the value of C, of type op->ztype
+    // input:
+    const GrB_BinaryOp op,      // binary operator for A+B or A.*B
+    const bool eWiseAdd,        // if true, C=A+B, otherwise C=A.*B
+    const GrB_Matrix A,
+    const GrB_Matrix B
+)
+{
+
+    if (!GB_iso_binop (z, op, false, A, B))
+    { 
+        return (false) ;
+    }
+    if (!eWiseAdd)
+    { 
+        return (true) ;
+    }
+    if (!A->iso || !B->iso)
+    { 
+        return (false) ;
+    }
+
+    GrB_Type ztype = op->ztype ;
+    size_t zsize = ztype->size ;
+    GB_void a [GB_VLA(zsize)], b [GB_VLA(zsize)] ;
+    GB_cast_function cast_A = GB_cast_factory (ztype->code, A->type->code) ;
+    GB_cast_function cast_B = GB_cast_factory (ztype->code, B->type->code) ;
+    cast_A (a, A->x, A->type->size) ;
+    cast_B (b, B->x, B->type->size) ;
+    return (memcmp (a, z, zsize) == 0 && memcmp (b, z, zsize) == 0) ;
+}
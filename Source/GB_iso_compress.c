@@ -0,0 +1,152 @@
+//------------------------------------------------------------------------------
+// GB_iso_compress: convert a matrix with all entries the same into iso form
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_iso_check returns true if all entries in a non-iso matrix A have the same
+// value.  Each task stops at the first entry that differs from the first entry
+// in A, so the test is fast for a matrix that is not iso.  Zombies are not
+// checked, since their values are ignored.
+
+// GB_iso_compress converts a matrix A whose entries all have the given value
+// into an iso matrix, by replacing A->x with a single entry.
+
+#include "GB_iso.h"
+
+//------------------------------------------------------------------------------
+// GB_iso_check: check if all entries of A are the same
+//------------------------------------------------------------------------------
+
+bool GB_iso_check               // true if all entries of A are the same
+(
+    const GrB_Matrix A,         // matrix to check
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (A, "A to check if iso", GB0) ;
+    ASSERT (!GB_PENDING (A)) ;
+    if (A->iso)
+    { 
+        return (true) ;
+    }
+
+    int64_t anz = GB_NNZ_HELD (A) ;
+    if (anz == 0 || A->x == NULL)
+    { 
+        // an empty matrix is not made iso
+        return (false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // find the first entry in A
+    //--------------------------------------------------------------------------
+
+    const int8_t  *GB_RESTRICT Ab = A->b ;
+    const int64_t *GB_RESTRICT Ai = A->i ;
+    const GB_void *GB_RESTRICT Ax = (GB_void *) A->x ;
+    size_t asize = A->type->size ;
+    int64_t pfirst = 0 ;
+    while (pfirst < anz &&
+        ((Ab != NULL && !Ab [pfirst]) || (Ai != NULL && GB_IS_ZOMBIE (Ai [pfirst]))))
+    {
+        pfirst++ ;
+    }
+    if (pfirst == anz)
+    { 
+        // no entries in A
+        return (false) ;
+    }
+    const GB_void *GB_RESTRICT a = Ax + pfirst * asize ;
+
+    //--------------------------------------------------------------------------
+    // compare all entries in A with the first one
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (anz, chunk, nthreads_max) ;
+    int ntasks = (nthreads == 1) ? 1 : (8 * nthreads) ;
+    ntasks = GB_IMIN (ntasks, anz) ;
+    ntasks = GB_IMAX (ntasks, 1) ;
+
+    bool differ = false ;
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
+        reduction(||:differ)
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+        int64_t pstart, pend ;
+        GB_PARTITION (pstart, pend, anz, tid, ntasks) ;
+        for (int64_t p = pstart ; p < pend ; p++)
+        {
+            if (Ab != NULL && !Ab [p]) continue ;
+            if (Ai != NULL && GB_IS_ZOMBIE (Ai [p])) continue ;
+            if (memcmp (Ax + p * asize, a, asize) != 0)
+            { 
+                differ = true ;
+                break ;
+            }
+        }
+    }
+
+    return (!differ) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_iso_compress: convert a matrix to iso
+//------------------------------------------------------------------------------
+
+GrB_Info GB_iso_compress        // convert a matrix to iso
+(
+    GrB_Matrix A,               // matrix to convert, in-place
+    const GB_void *value,       // value of all entries of A, of type A->type
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (A != NULL) ;
+    ASSERT (value != NULL) ;
+    ASSERT (!GB_PENDING (A)) ;
+    if (A->iso)
+    { 
+        // A is already iso
+        ASSERT (memcmp (A->x, value, A->type->size) == 0) ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // replace A->x with a single entry
+    //--------------------------------------------------------------------------
+
+    size_t asize = A->type->size ;
+    GB_void *GB_RESTRICT X = GB_MALLOC (asize, GB_void) ;
+    if (X == NULL)
+    { 
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    memcpy (X, value, asize) ;
+    if (!A->x_shallow)
+    { 
+        GB_FREE (A->x) ;
+    }
+    A->x = X ;
+    A->x_size = asize ;
+    A->x_shallow = false ;
+    A->iso = true ;
+    GBURBLE ("(iso) ") ;
+    ASSERT_MATRIX_OK (A, "A compressed to iso", GB0) ;
+    return (GrB_SUCCESS) ;
+}
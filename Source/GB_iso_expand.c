@@ -0,0 +1,243 @@
+//------------------------------------------------------------------------------
+// GB_iso_expand: expand the values of an iso matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_iso_expand converts an iso matrix A into a non-iso matrix, in-place, by
+// replacing A->x with an array of size A->nzmax, with all entries equal to the
+// iso value.  GB_iso_expand_copy does the same for a copy of A with a shallow
+// pattern, so that A itself is unmodified.  GB_iso_mask handles an iso mask M: if
+// its value is nonzero, M is used as a structural mask instead, and otherwise
+// an expanded copy of M is returned.
+
+#include "GB_iso.h"
+
+//------------------------------------------------------------------------------
+// GB_iso_expand_values: allocate and fill an expanded value array
+//------------------------------------------------------------------------------
+
+static GB_void *GB_iso_expand_values    // return expanded array, or NULL
+(
+    const GrB_Matrix A,
+    GB_Context Context
+)
+{
+
+    int64_t n = GB_IMAX (A->nzmax, 1) ;
+    size_t asize = A->type->size ;
+    GB_void *GB_RESTRICT X = GB_MALLOC (n * asize, GB_void) ;
+    if (X == NULL)
+    { 
+        // out of memory
+        return (NULL) ;
+    }
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (n, chunk, nthreads_max) ;
+    const GB_void *GB_RESTRICT value = (GB_void *) A->x ;
+    int64_t p ;
+
+    switch (asize)
+    {
+        case 1 :
+        { 
+            memset (X, value [0], n) ;
+        }
+        break ;
+
+        case 2 :
+        { 
+            uint16_t *GB_RESTRICT Z = (uint16_t *) X ;
+            uint16_t z = *((uint16_t *) value) ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (p = 0 ; p < n ; p++) Z [p] = z ;
+        }
+        break ;
+
+        case 4 :
+        { 
+            uint32_t *GB_RESTRICT Z = (uint32_t *) X ;
+            uint32_t z = *((uint32_t *) value) ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (p = 0 ; p < n ; p++) Z [p] = z ;
+        }
+        break ;
+
+        case 8 :
+        { 
+            uint64_t *GB_RESTRICT Z = (uint64_t *) X ;
+            uint64_t z = *((uint64_t *) value) ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (p = 0 ; p < n ; p++) Z [p] = z ;
+        }
+        break ;
+
+        default :
+        { 
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (p = 0 ; p < n ; p++)
+            {
+                memcpy (X + p*asize, value, asize) ;
+            }
+        }
+        break ;
+    }
+
+    return (X) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_iso_expand: expand an iso matrix in-place
+//------------------------------------------------------------------------------
+
+GrB_Info GB_iso_expand          // expand an iso matrix into a non-iso matrix
+(
+    GrB_Matrix A,               // matrix to expand, in-place
+    GB_Context Context
+)
+{
+
+    ASSERT (A != NULL) ;
+    if (!A->iso)
+    { 
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    GBURBLE ("(iso expand) ") ;
+    GB_void *X = GB_iso_expand_values (A, Context) ;
+    if (X == NULL)
+    { 
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    if (!A->x_shallow)
+    { 
+        GB_FREE (A->x) ;
+    }
+    A->x = X ;
+    A->x_size = GB_IMAX (A->nzmax, 1) * A->type->size ;
+    A->x_shallow = false ;
+    A->iso = false ;
+    ASSERT_MATRIX_OK (A, "A iso expanded", GB0) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_iso_expand_copy: C = A, with the values of A expanded
+//------------------------------------------------------------------------------
+
+GrB_Info GB_iso_expand_copy     // C = A, with A->x expanded
+(
+    GrB_Matrix *Chandle,        // output matrix, or NULL if A is not iso
+    const GrB_Matrix A,         // input matrix, not modified
+    GB_Context Context
+)
+{
+
+    ASSERT (Chandle != NULL) ;
+    (*Chandle) = NULL ;
+    if (A == NULL || !A->iso)
+    { 
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    ASSERT (!GB_PENDING (A)) ;
+    ASSERT (GB_ZOMBIES_OK (A)) ;
+    ASSERT (GB_JUMBLED_OK (A)) ;
+
+    //--------------------------------------------------------------------------
+    // allocate the header of C
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GrB_Matrix C = NULL ;
+    info = GB_new (&C, // any sparsity, new header
+        A->type, A->vlen, A->vdim, GB_Ap_null, A->is_csc,
+        GB_sparsity (A), A->hyper_switch, 0, Context) ;
+    if (info != GrB_SUCCESS)
+    { 
+        // out of memory
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // expand the values of A into C->x
+    //--------------------------------------------------------------------------
+
+    GB_void *X = GB_iso_expand_values (A, Context) ;
+    if (X == NULL)
+    { 
+        // out of memory
+        GB_Matrix_free (&C) ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // C has a shallow copy of the pattern of A, and its own values
+    //--------------------------------------------------------------------------
+
+    // Unlike GB_shallow_copy, A may have zombies or be jumbled.
+    C->p = A->p ; C->p_shallow = (A->p != NULL) ;
+    C->h = A->h ; C->h_shallow = (A->h != NULL) ;
+    C->b = A->b ; C->b_shallow = (A->b != NULL) ;
+    C->i = A->i ; C->i_shallow = (A->i != NULL) ;
+    C->p_is_32 = A->p_is_32 ;
+    C->h_is_32 = A->h_is_32 ;
+    C->i_is_32 = A->i_is_32 ;
+    C->b_is_packed = A->b_is_packed ;
+    C->x = X ;    C->x_shallow = false ;
+    C->x_size = GB_IMAX (A->nzmax, 1) * A->type->size ;
+    C->plen = A->plen ;
+    C->nvec = A->nvec ;
+    C->nvec_nonempty = A->nvec_nonempty ;
+    C->nzmax = A->nzmax ;
+    C->nvals = A->nvals ;
+    C->nzombies = A->nzombies ;
+    C->jumbled = A->jumbled ;
+    C->sparsity = A->sparsity ;
+    C->bitmap_switch = A->bitmap_switch ;
+    C->pattern_version = A->pattern_version ;
+    C->iso = false ;
+    C->magic = GB_MAGIC ;
+    ASSERT_MATRIX_OK (C, "C iso expanded copy", GB0) ;
+    (*Chandle) = C ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_iso_mask: prepare an iso mask for use
+//------------------------------------------------------------------------------
+
+GrB_Info GB_iso_mask            // prepare an iso mask for use
+(
+    GrB_Matrix *M2_handle,      // expanded copy of M, if needed; else NULL
+    bool *Mask_struct,          // set true if M is iso and nonzero
+    const GrB_Matrix M,         // mask matrix, may be NULL
+    GB_Context Context
+)
+{
+
+    (*M2_handle) = NULL ;
+    if (M == NULL || !M->iso || (*Mask_struct))
+    { 
+        // M is not iso, or only its structure is used
+        return (GrB_SUCCESS) ;
+    }
+
+    if (GB_mcast ((GB_void *) M->x, 0, M->type->size))
+    { 
+        // all entries of M are true, so only its structure is needed
+        (*Mask_struct) = true ;
+        return (GrB_SUCCESS) ;
+    }
+
+    // all entries in M are false; expand M
+    return (GB_iso_expand_copy (M2_handle, M, Context)) ;
+}
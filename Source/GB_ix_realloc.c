@@ -9,7 +9,9 @@
 
 // Does not modify A->p.  Reallocates A->x and A->i to the requested size,
 // preserving the existing content of A->x and A->i.  Preserves pending tuples
-// and zombies, if any.  If numeric is false, then A->x is freed instead.
+// and zombies, if any.  If numeric is false, then A->x is freed instead.  If A
+// is iso, A->x is not changed.  A->i and A->x are not reallocated if their
+// existing space (A->i_size and A->x_size) is already large enough.
 
 #include "GB.h"
 
@@ -55,17 +57,36 @@ GrB_Info GB_ix_realloc      // reallocate space in a matrix
     // reallocate the space
     //--------------------------------------------------------------------------
 
+    // A->i and A->x are reallocated only if they are too small to hold
+    // nzmax_new entries.  Otherwise, their existing space is reused.
+
+    ASSERT (!A->i_is_32) ;
     size_t nzmax_new1 = GB_IMAX (nzmax_new, 1) ;
+    size_t asize = A->type->size ;
     bool ok1 = true, ok2 = true ;
-    GB_REALLOC (A->i, nzmax_new1, A->nzmax, int64_t, &ok1) ;
-    if (numeric)
+    if (A->i_size < nzmax_new1 * sizeof (int64_t))
+    { 
+        size_t ni_old = A->i_size / sizeof (int64_t) ;
+        GB_REALLOC (A->i, nzmax_new1, ni_old, int64_t, &ok1) ;
+        if (ok1) A->i_size = nzmax_new1 * sizeof (int64_t) ;
+    }
+    if (numeric && A->iso)
+    { 
+        // the single value A->x [0] of an iso matrix is unchanged
+        ;
+    }
+    else if (numeric)
     { 
-        size_t asize = A->type->size ;
-        GB_REALLOC (A->x, nzmax_new1*asize, (A->nzmax)*asize, GB_void, &ok2) ;
+        if (A->x_size < nzmax_new1 * asize)
+        { 
+            GB_REALLOC (A->x, nzmax_new1*asize, A->x_size, GB_void, &ok2) ;
+            if (ok2) A->x_size = nzmax_new1 * asize ;
+        }
     }
     else
     { 
         GB_FREE (A->x) ;
+        A->x_size = 0 ;
     }
     bool ok = ok1 && ok2 ;
 
@@ -10,6 +10,8 @@
 // nnz(A) has, or will, change.  The # of nonzeros may decrease significantly,
 // in which case the extra space is trimmed.  If the existing space is not
 // sufficient, the matrix is doubled in size to accomodate the new entries.
+// If A->i and A->x already have enough space (as given by A->i_size and
+// A->x_size), A->nzmax is increased and nothing is reallocated.
 
 #include "GB.h"
 
@@ -47,6 +49,26 @@ GrB_Info GB_ix_resize           // resize a matrix
     //--------------------------------------------------------------------------
 
     ASSERT (anz_new > anzmax_orig) ;
+
+    // the space allocated for A->i and A->x may exceed A->nzmax (if A was
+    // imported, for example); reuse it if it is large enough
+    int64_t anzmax_held = A->i_size / sizeof (int64_t) ;
+    if (!A->iso)
+    { 
+        anzmax_held = GB_IMIN (anzmax_held, A->x_size / A->type->size) ;
+    }
+
+    if (anz_new <= anzmax_held)
+    { 
+
+        //----------------------------------------------------------------------
+        // reuse the existing space
+        //----------------------------------------------------------------------
+
+        A->nzmax = anzmax_held ;
+
+    }
+    else
     {
 
         //----------------------------------------------------------------------
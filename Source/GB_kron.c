@@ -9,16 +9,20 @@
 
 // C<M> = accum (C, kron(A,B))
 
-// The input matrices A and B are optionally transposed.
+// The input matrices A and B are optionally transposed.  If A or B are iso
+// and their values are used, expanded copies of them are used instead.
 
 #include "GB_kron.h"
 #include "GB_mxm.h"
 #include "GB_transpose.h"
 #include "GB_accum_mask.h"
+#include "GB_iso.h"
 
 #define GB_FREE_ALL         \
     GB_Matrix_free (&AT) ;  \
-    GB_Matrix_free (&BT) ;
+    GB_Matrix_free (&BT) ;  \
+    GB_Matrix_free (&A2) ;  \
+    GB_Matrix_free (&B2) ;
 
 GrB_Info GB_kron                    // C<M> = accum (C, kron(A,B))
 (
@@ -46,6 +50,8 @@ GrB_Info GB_kron                    // C<M> = accum (C, kron(A,B))
     GrB_Info info ;
     GrB_Matrix AT = NULL ;
     GrB_Matrix BT = NULL ;
+    GrB_Matrix A2 = NULL ;
+    GrB_Matrix B2 = NULL ;
     GrB_BinaryOp op = op_in ;
 
     GB_RETURN_IF_NULL_OR_FAULTY (C) ;
@@ -124,17 +130,30 @@ GrB_Info GB_kron                    // C<M> = accum (C, kron(A,B))
         }
     }
 
-    // TODO: if A, B are pattern: do not compute values of AT=A', BT=B'
+    // if A or B are pattern, the values of AT=A' or BT=B' are not computed
     bool A_is_pattern, B_is_pattern ;
     GB_AxB_pattern (&A_is_pattern, &B_is_pattern, false, op->opcode) ;
 
+    // expand A and B if they are iso and their values are used
+    GrB_Matrix A1 = A, B1 = B ;
+    if (!A_is_pattern)
+    { 
+        GB_OK (GB_iso_expand_copy (&A2, A, Context)) ;
+        if (A2 != NULL) A1 = A2 ;
+    }
+    if (!B_is_pattern)
+    { 
+        GB_OK (GB_iso_expand_copy (&B2, B, Context)) ;
+        if (B2 != NULL) B1 = B2 ;
+    }
+
     if (A_transpose)
     {
         // AT = A' and typecast to op->xtype
         // transpose: typecast, no op, not in-place
         GBURBLE ("(A transpose) ") ;
-        GB_OK (GB_transpose (&AT, A_is_pattern ? A->type : op->xtype, T_is_csc,
-            A, NULL, NULL, NULL, false, Context)) ;
+        GB_OK (GB_transpose_cast (&AT, A_is_pattern ? A->type : op->xtype,
+            T_is_csc, A1, A_is_pattern, Context)) ;
         ASSERT_MATRIX_OK (A , "A after AT kron", GB0) ;
         ASSERT_MATRIX_OK (AT, "AT kron", GB0) ;
     }
@@ -144,8 +163,8 @@ GrB_Info GB_kron                    // C<M> = accum (C, kron(A,B))
         // BT = B' and typecast to op->ytype
         // transpose: typecast, no op, not in-place
         GBURBLE ("(B transpose) ") ;
-        GB_OK (GB_transpose (&BT, B_is_pattern ? B->type : op->ytype, T_is_csc,
-            B, NULL, NULL, NULL, false, Context)) ;
+        GB_OK (GB_transpose_cast (&BT, B_is_pattern ? B->type : op->ytype,
+            T_is_csc, B1, B_is_pattern, Context)) ;
         ASSERT_MATRIX_OK (BT, "BT kron", GB0) ;
     }
 
@@ -155,8 +174,8 @@ GrB_Info GB_kron                    // C<M> = accum (C, kron(A,B))
 
     GrB_Matrix T ;
     GB_OK (GB_kroner (&T, T_is_csc, op,
-        A_transpose ? AT : A, A_is_pattern,
-        B_transpose ? BT : B, B_is_pattern, Context)) ;
+        A_transpose ? AT : A1, A_is_pattern,
+        B_transpose ? BT : B1, B_is_pattern, Context)) ;
 
     // free workspace
     GB_FREE_ALL ;
@@ -84,6 +84,13 @@ void *GB_malloc_memory      // pointer to allocated block of memory
             p = (void *) GB_Global_malloc_function (size) ;
         }
 
+        if (p != NULL && size >= GB_FIRST_TOUCH_MIN)
+        { 
+            // advise the use of huge pages, and place the pages of the block
+            // according to the NUMA policy, if enabled.  The block is not
+            // cleared.
+            GB_first_touch (p, size, false) ;
+        }
     }
     return (p) ;
 }
@@ -194,9 +194,9 @@ GrB_Info GB_mask                // C<M> = Z
 
             // C_result = Z, but make sure a deep copy is made as needed.  It is
             // possible that Z is a shallow copy of another matrix.
-            // Z is freed by GB_transplant_conform.
-            ASSERT (!C_result->p_shallow) ;
-            ASSERT (!C_result->h_shallow) ;
+            // Z is freed by GB_transplant_conform.  C_result may be shallow
+            // if it was imported with GxB_SHALLOW_IMPORT; its content is
+            // discarded, not modified, by GB_transplant_conform.
 
             // transplant Z into C_result and conform to desired hypersparsity
             return (GB_transplant_conform (C_result, C_result->type, Zhandle,
@@ -126,12 +126,14 @@ GrB_Info GB_masker_phase2           // phase2 for R = masker (C,M,Z)
     { 
         R->nvec_nonempty = Rnvec_nonempty ;
         R->p = (int64_t *) Rp ;
+        R->p_size = (Rnvec+1) * sizeof (int64_t) ;
     }
 
     // add Rh as the hypersparse list for R, from GB_add_phase0
     if (R_is_hyper)
     { 
         R->h = (int64_t *) Rh ;
+        R->h_size = Rnvec * sizeof (int64_t) ;
         R->nvec = Rnvec ;
     }
 
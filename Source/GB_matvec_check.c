@@ -111,6 +111,21 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
     { 
         GBPR0 (" (jumbled)") ;
     }
+    if (A->iso)
+    { 
+        // all entries have the same value, held in A->x [0]
+        GBPR0 (" (iso)") ;
+    }
+    if (GB_INDEX32 (A))
+    { 
+        // A->p, A->h, and/or A->i are held in 32-bit integers
+        GBPR0 (" (32-bit)") ;
+    }
+    if (GB_BITMAP_PACKED (A))
+    { 
+        // A->b is held as a packed bitmap
+        GBPR0 (" (packed)") ;
+    }
     GBPR0 (" %s\n", A->is_csc ? "by col" : "by row") ;
 
     #if GB_DEVELOPER
@@ -347,19 +362,73 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
     // check the content of p
     //--------------------------------------------------------------------------
 
+    // A->p, A->h, and A->i may be held in 32-bit integers
+    #define GB_AP(k) \
+        (A->p_is_32 ? ((int64_t) ((int32_t *) A->p) [k]) : A->p [k])
+    #define GB_AH(k) \
+        (A->h_is_32 ? ((int64_t) ((int32_t *) A->h) [k]) : A->h [k])
+    #define GB_AI(p) \
+        (A->i_is_32 ? ((int64_t) ((int32_t *) A->i) [p]) : A->i [p])
+
+    // A->b may be held as a packed bitmap
+    #define GB_AB(p) \
+        (A->b_is_packed ?  GB_BITMAP_PACKED_GET ((uint64_t *) A->b, p) \
+                        :  A->b [p])
+
+    if (GB_INDEX32 (A) && !(is_hyper || is_sparse))
+    { 
+        GBPR0 ("  bitmap or full %s cannot have 32-bit integers\n", kind) ;
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    if (A->b_is_packed)
+    {
+        if (!is_bitmap)
+        { 
+            GBPR0 ("  packed bitmap %s must be bitmap\n", kind) ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+        // count the entries in the packed bitmap, one word at a time
+        int64_t anz_held = A->vlen * A->vdim ;
+        int64_t anvals = 0 ;
+        int64_t nwords = GB_BITMAP_NWORDS (anz_held) ;
+        const uint64_t *Ab64 = (uint64_t *) A->b ;
+        for (int64_t w = 0 ; w < nwords ; w++)
+        {
+            uint64_t word = Ab64 [w] ;
+            if (w == nwords-1 && anz_held % 64 != 0)
+            {
+                // the bits past the last position must be zero
+                if (word >> (anz_held % 64) != 0)
+                { 
+                    GBPR0 ("  packed bitmap %s has invalid bits\n", kind) ;
+                    return (GrB_INVALID_OBJECT) ;
+                }
+            }
+            anvals += GB_POPCOUNT64 (word) ;
+        }
+        if (anvals != A->nvals)
+        { 
+            GBPR0 ("  packed bitmap %s has " GBd " entries, not " GBd "\n",
+                kind, anvals, A->nvals) ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+    }
+
     if (is_hyper || is_sparse)
     {
-        if (A->p [0] != 0)
+        if (GB_AP (0) != 0)
         { 
-            GBPR0 ("  ->p [0] = " GBd " invalid\n", A->p [0]) ;
+            GBPR0 ("  ->p [0] = " GBd " invalid\n", GB_AP (0)) ;
             return (GrB_INVALID_OBJECT) ;
         }
 
         for (int64_t j = 0 ; j < A->nvec ; j++)
         {
-            if (A->p [j+1] < A->p [j] || A->p [j+1] > A->nzmax)
+            if (GB_AP (j+1) < GB_AP (j) || GB_AP (j+1) > A->nzmax)
             { 
-                GBPR0 ("  ->p [" GBd "] = " GBd " invalid\n", j+1, A->p [j+1]) ;
+                GBPR0 ("  ->p [" GBd "] = " GBd " invalid\n", j+1,
+                    GB_AP (j+1)) ;
                 return (GrB_INVALID_OBJECT) ;
             }
         }
@@ -374,7 +443,7 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
         int64_t jlast = -1 ;
         for (int64_t k = 0 ; k < A->nvec ; k++)
         {
-            int64_t j = A->h [k] ;
+            int64_t j = GB_AH (k) ;
             if (jlast >= j || j < 0 || j >= A->vdim)
             { 
                 GBPR0 ("  ->h [" GBd "] = " GBd " invalid\n", k, j) ;
@@ -384,6 +453,24 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
         }
     }
 
+    //--------------------------------------------------------------------------
+    // check the allocated sizes
+    //--------------------------------------------------------------------------
+
+    // each component that is not shallow must be large enough for its content
+    #define GB_SIZE_OK(X,n) \
+        (A->X == NULL || A->X ## _shallow || A->X ## _size >= (size_t) (n))
+    #define GB_INT_SIZE(is_32) ((is_32) ? sizeof (int32_t) : sizeof (int64_t))
+    ASSERT (GB_SIZE_OK (p, (A->plen+1) * GB_INT_SIZE (A->p_is_32))) ;
+    ASSERT (GB_SIZE_OK (h, A->plen * GB_INT_SIZE (A->h_is_32))) ;
+    ASSERT (!(is_hyper || is_sparse) ||
+        GB_SIZE_OK (i, GB_AP (A->nvec) * GB_INT_SIZE (A->i_is_32))) ;
+    ASSERT (GB_SIZE_OK (b, A->b_is_packed ?
+        (GB_BITMAP_NWORDS (A->vlen * A->vdim) * sizeof (uint64_t)) :
+        (A->vlen * A->vdim))) ;
+    ASSERT (GB_SIZE_OK (x, A->type->size * (A->iso ? 1 :
+        ((is_hyper || is_sparse) ? GB_AP (A->nvec) : (A->vlen * A->vdim))))) ;
+
     //--------------------------------------------------------------------------
     // report name and number of entries
     //--------------------------------------------------------------------------
@@ -453,6 +540,13 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
         }
     }
 
+    if (GB_INDEX32 (A) && GB_ANY_PENDING_WORK (A))
+    { 
+        // 32-bit integers are only used for a matrix with no pending work
+        GBPR0 ("  %s with 32-bit integers cannot have pending work\n", kind) ;
+        return (GrB_INVALID_OBJECT) ;
+    }
+
     //--------------------------------------------------------------------------
     // check and print the row indices and numerical values
     //--------------------------------------------------------------------------
@@ -472,9 +566,9 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
     {
         if (phantom) break ;
         int64_t ilast = -1 ;
-        int64_t j = GBH (A->h, k) ;
-        int64_t p = GBP (A->p, k, A->vlen) ;
-        int64_t pend = GBP (A->p, k+1, A->vlen) ;
+        int64_t j = (A->h == NULL) ? k : GB_AH (k) ;
+        int64_t p = (A->p == NULL) ? (k * A->vlen) : GB_AP (k) ;
+        int64_t pend = (A->p == NULL) ? ((k+1) * A->vlen) : GB_AP (k+1) ;
 
         // count the entries in A(:,j)
         int64_t ajnz = pend - p ;
@@ -483,7 +577,7 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
             ajnz = 0 ;
             for (int64_t p2 = p ; p2 < pend ; p2++)
             {
-                int8_t ab = A->b [p2] ;
+                int8_t ab = GB_AB (p2) ;
                 if (ab < 0 || ab > 1)
                 { 
                     // bitmap with value other than 0, 1
@@ -508,11 +602,11 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
         // for each entry in A(:,j), the kth vector of A
         for ( ; p < pend ; p++)
         {
-            if (!GBB (A->b, p)) continue ;
+            if (A->b != NULL && !GB_AB (p)) continue ;
             anz_actual++ ;
             icount++ ;
 
-            int64_t i = GBI (A->i, p, A->vlen) ;
+            int64_t i = (A->i == NULL) ? (p % A->vlen) : GB_AI (p) ;
             bool is_zombie = GB_IS_ZOMBIE (i) ;
             i = GB_UNFLIP (i) ;
             if (is_zombie) nzombies++ ;
@@ -558,7 +652,8 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
                 else if (A->x != NULL)
                 { 
                     GB_void *Ax = (GB_void *) A->x ;
-                    info = GB_entry_check (A->type, Ax +(p * (A->type->size)),
+                    int64_t px = A->iso ? 0 : p ;
+                    info = GB_entry_check (A->type, Ax +(px * (A->type->size)),
                         pr, f) ;
                     if (info != GrB_SUCCESS) return (info) ;
                 }
@@ -697,6 +792,36 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
             return (GrB_INVALID_OBJECT) ;
         }
 
+        // each closed run of the pending tuples must be sorted
+        int nruns = Pending->nruns ;
+        if (nruns < 0 || nruns > GB_PENDING_MAXRUNS || Pending->run [0] != 0
+            || Pending->run [nruns] > Pending->n)
+        { 
+            GBPR0 ("  invalid pending tuples: invalid runs\n") ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+
+        for (int r = 0 ; r < nruns ; r++)
+        {
+            if (Pending->run [r] >= Pending->run [r+1])
+            { 
+                GBPR0 ("  invalid pending tuples: invalid runs\n") ;
+                return (GrB_INVALID_OBJECT) ;
+            }
+            for (int64_t k = Pending->run [r] + 1 ; k < Pending->run [r+1] ; k++)
+            {
+                int64_t i = Pending->i [k] ;
+                int64_t j = (A->vdim <= 1) ? 0 : (Pending->j [k]) ;
+                ilast = Pending->i [k-1] ;
+                jlast = (A->vdim <= 1) ? 0 : (Pending->j [k-1]) ;
+                if (!((jlast < j) || (jlast == j && ilast <= i)))
+                { 
+                    GBPR0 ("  invalid pending tuples: unsorted run\n") ;
+                    return (GrB_INVALID_OBJECT) ;
+                }
+            }
+        }
+
         if (Pending->op == NULL)
         { 
             GBPR0 ("  pending operator: implicit 2nd\n") ;
@@ -0,0 +1,128 @@
+//------------------------------------------------------------------------------
+// GB_mmap: create a matrix held in a read-only mapping of a file
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The file is mapped read-only into memory, and C is constructed by
+// GB_deserialize as a shallow view of the mapping, which C then owns; the
+// mapping is unmapped by GB_phbix_free when C is freed.  The header of the
+// file is checked, but its content is trusted, as for GxB_SHALLOW_IMPORT.  If
+// the file holds a compressed blob, C is constructed in memory instead, and
+// the mapping is not kept.  Where mmap is not available, the file is read
+// into memory and C is constructed from it by GB_deserialize.
+
+#include "GB_mmap.h"
+#if GB_HAS_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+GrB_Info GB_mmap                // create a matrix held in a file mapping
+(
+    // output:
+    GrB_Matrix *Chandle,        // output matrix mapped from the file
+    // input:
+    GrB_Type ctype,             // type of C; may be NULL for built-in types
+    const char *filename,       // name of the file to map
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (Chandle != NULL && filename != NULL) ;
+    (*Chandle) = NULL ;
+
+    #if GB_HAS_MMAP
+
+        //----------------------------------------------------------------------
+        // map the file into memory
+        //----------------------------------------------------------------------
+
+        int fd = open (filename, O_RDONLY) ;
+        if (fd < 0)
+        {
+            GB_ERROR (GrB_INVALID_VALUE, "Unable to open file [%s]", filename) ;
+        }
+        struct stat st ;
+        if (fstat (fd, &st) != 0 || st.st_size <= 0)
+        {
+            // the file is empty, or its size is unknown
+            close (fd) ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+        size_t size = (size_t) st.st_size ;
+        void *base = mmap (NULL, size, PROT_READ, MAP_SHARED, fd, 0) ;
+        close (fd) ;
+        if (base == MAP_FAILED)
+        {
+            GB_ERROR (GrB_INVALID_VALUE, "Unable to map file [%s]", filename) ;
+        }
+
+        //----------------------------------------------------------------------
+        // construct C as a shallow view of the mapping
+        //----------------------------------------------------------------------
+
+        info = GB_deserialize (Chandle, ctype, (const GB_void *) base, size,
+            true, Context) ;
+        if (info == GrB_SUCCESS && GB_is_shallow (*Chandle))
+        {
+            // C owns the mapping
+            (*Chandle)->mmap_base = base ;
+            (*Chandle)->mmap_size = size ;
+        }
+        else
+        {
+            // the file is invalid, or C does not refer to the mapping
+            munmap (base, size) ;
+        }
+
+    #else
+
+        //----------------------------------------------------------------------
+        // read the file into memory
+        //----------------------------------------------------------------------
+
+        FILE *f = fopen (filename, "rb") ;
+        if (f == NULL)
+        {
+            GB_ERROR (GrB_INVALID_VALUE, "Unable to open file [%s]", filename) ;
+        }
+        int64_t size = -1 ;
+        if (fseek (f, 0, SEEK_END) == 0)
+        {
+            size = (int64_t) ftell (f) ;
+        }
+        if (size <= 0 || fseek (f, 0, SEEK_SET) != 0)
+        {
+            // the file is empty, or its size is unknown
+            fclose (f) ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+        GB_void *blob = GB_MALLOC (size, GB_void) ;
+        if (blob == NULL)
+        {
+            // out of memory
+            fclose (f) ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        bool ok = (fread (blob, 1, size, f) == (size_t) size) ;
+        fclose (f) ;
+        info = ok ? GB_deserialize (Chandle, ctype, blob, size, false, Context)
+            : GrB_INVALID_OBJECT ;
+        GB_FREE (blob) ;
+
+    #endif
+
+    return (info) ;
+}
+
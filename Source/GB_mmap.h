@@ -0,0 +1,65 @@
+//------------------------------------------------------------------------------
+// GB_mmap.h: definitions for file-backed matrices
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_mmap_write writes a matrix to a file in the layout of an
+// uncompressed blob (see GB_serialize.h), with the header and each section
+// padded to GB_MMAP_ALIGN bytes.  The matrix is written with 64-bit integers
+// and an unpacked bitmap, which is the form the kernels operate on.
+
+// GxB_Matrix_mmap maps such a file read-only into memory, and creates a
+// matrix whose components are shallow pointers into the mapping.  The pages
+// of the file are read by the operating system as the kernels access them, so
+// the matrix may be larger than the memory of the machine.  Kernels that
+// stream through a matrix call GB_mmap_readahead as each task starts, which
+// advises the operating system to read the part of the file the task and its
+// successor will access, so that the file is read in large requests ahead of
+// the computation, rather than one page fault at a time.  Any method that
+// modifies the matrix first copies it into memory (see GB_unshallow).
+
+// Where mmap is not available, GxB_Matrix_mmap reads the entire file into
+// memory instead.
+
+#ifndef GB_MMAP_H
+#define GB_MMAP_H
+#include "GB_serialize.h"
+
+#if defined ( __linux__ ) || defined ( __APPLE__ )
+#define GB_HAS_MMAP 1
+#else
+#define GB_HAS_MMAP 0
+#endif
+
+// each section of the file starts on a page boundary
+#define GB_MMAP_ALIGN_LOG2 12
+#define GB_MMAP_ALIGN (1 << GB_MMAP_ALIGN_LOG2)
+
+GrB_Info GB_mmap_write          // write a matrix to a file for GB_mmap
+(
+    const char *filename,       // name of the file to write
+    GrB_Matrix A,               // matrix to write
+    GB_Context Context
+) ;
+
+GrB_Info GB_mmap                // create a matrix held in a file mapping
+(
+    // output:
+    GrB_Matrix *Chandle,        // output matrix mapped from the file
+    // input:
+    GrB_Type ctype,             // type of C; may be NULL for built-in types
+    const char *filename,       // name of the file to map
+    GB_Context Context
+) ;
+
+void GB_mmap_free               // unmap the file mapping of a matrix
+(
+    GrB_Matrix A
+) ;
+
+#endif
+
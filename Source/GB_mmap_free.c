@@ -0,0 +1,41 @@
+//------------------------------------------------------------------------------
+// GB_mmap_free: unmap the file mapping of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Called by GB_phbix_free, after all components of A have been freed.  The
+// mapping is unmapped only if A owns it; a shallow copy of a file-backed
+// matrix just forgets it.
+
+#include "GB_mmap.h"
+#if GB_HAS_MMAP
+#include <sys/mman.h>
+#endif
+
+void GB_mmap_free               // unmap the file mapping of a matrix
+(
+    GrB_Matrix A
+)
+{
+
+    if (A == NULL)
+    {
+        return ;
+    }
+
+    #if GB_HAS_MMAP
+    if (A->mmap_base != NULL && !A->mmap_shallow)
+    {
+        munmap (A->mmap_base, A->mmap_size) ;
+    }
+    #endif
+
+    A->mmap_base = NULL ;
+    A->mmap_size = 0 ;
+    A->mmap_shallow = false ;
+}
+
@@ -0,0 +1,154 @@
+//------------------------------------------------------------------------------
+// GB_mmap_readahead: advise the OS of the part of a file a task will access
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Called by a streaming kernel at the start of task tid, for a matrix A that
+// the kernel accesses in the order of its task schedule.  If A is held in a
+// file mapping (see GB_mmap.h), the pages of A that the task will access are
+// advised with MADV_WILLNEED, so that the operating system reads them in large
+// requests ahead of the computation rather than one page fault at a time.
+
+// The tasks are executed in order, by nthreads threads.  Each of the first
+// nthreads tasks advises its own part of A, and each task advises the part of
+// the task nthreads ahead of it, which is likely to be the next task its
+// thread will execute.  Each part of A is thus advised once, about one task
+// before it is needed.
+
+// The schedule is either a slice of the entries of A (Slice [t] is the first
+// entry of task t, as computed by GB_ek_slice), a slice of the vectors of A
+// (Slice [t] is the first vector of task t, as computed by GB_pslice), or if
+// Slice is NULL, the entries of A are partitioned uniformly across the tasks
+// (GB_PARTITION).  Nothing is done if A is not held in a file mapping.
+
+#include "GB_mmap.h"
+#if GB_HAS_MMAP
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+//------------------------------------------------------------------------------
+// GB_advise: advise bytes start:end-1 of a component X of A
+//------------------------------------------------------------------------------
+
+static inline void GB_advise
+(
+    const GrB_Matrix A,
+    const void *X,
+    size_t start,
+    size_t end
+)
+{
+
+    #if GB_HAS_MMAP && defined ( MADV_WILLNEED )
+    if (X == NULL || end <= start)
+    {
+        return ;
+    }
+    // X may have been copied into memory (see GB_unshallow), so only advise
+    // the part of the range inside the mapping.  madvise requires the start
+    // of the region to be page-aligned; the mapping itself is page-aligned.
+    uintptr_t base = (uintptr_t) A->mmap_base ;
+    uintptr_t lo = GB_IMAX ((uintptr_t) X + start, base) ;
+    uintptr_t hi = GB_IMIN ((uintptr_t) X + end, base + A->mmap_size) ;
+    if (hi > lo)
+    {
+        uintptr_t page = (uintptr_t) sysconf (_SC_PAGESIZE) ;
+        lo = lo & ~(page - 1) ;
+        madvise ((void *) lo, hi - lo, MADV_WILLNEED) ;
+    }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_mmap_readahead
+//------------------------------------------------------------------------------
+
+void GB_mmap_readahead
+(
+    const GrB_Matrix A,     // matrix that may be held in a file mapping
+    const int64_t *Slice,   // task schedule of size ntasks+1, or NULL
+    bool Slice_by_vector,   // if true, Slice holds vectors, not entries
+    int tid,                // task about to start
+    int ntasks,             // # of tasks in the schedule
+    int nthreads            // # of threads executing the tasks
+)
+{
+
+    if (A == NULL || A->mmap_base == NULL)
+    {
+        // A is not held in a file mapping
+        return ;
+    }
+
+    nthreads = GB_IMAX (nthreads, 1) ;
+    int64_t anz_held = GB_NNZ_HELD (A) ;
+    size_t psize = A->p_is_32 ? sizeof (int32_t) : sizeof (int64_t) ;
+    size_t hsize = A->h_is_32 ? sizeof (int32_t) : sizeof (int64_t) ;
+    size_t isize = A->i_is_32 ? sizeof (int32_t) : sizeof (int64_t) ;
+    size_t asize = A->type->size ;
+
+    // advise the part of A for task tid if it is in the first wave of tasks,
+    // and for the task nthreads ahead of it
+    int t = (tid < nthreads) ? tid : (tid + nthreads) ;
+    for ( ; t <= tid + nthreads && t < ntasks ; t += nthreads)
+    {
+
+        //----------------------------------------------------------------------
+        // get the vectors and entries of A for task t
+        //----------------------------------------------------------------------
+
+        int64_t kstart = 0, kend = 0, pstart, pend ;
+        if (Slice == NULL)
+        {
+            GB_PARTITION (pstart, pend, anz_held, t, ntasks) ;
+        }
+        else if (!Slice_by_vector)
+        {
+            pstart = Slice [t] ;
+            pend   = Slice [t+1] ;
+        }
+        else if (A->p != NULL)
+        {
+            kstart = Slice [t] ;
+            kend   = Slice [t+1] ;
+            pstart = GB_GETX (A->p, A->p_is_32, kstart) ;
+            pend   = GB_GETX (A->p, A->p_is_32, kend) ;
+        }
+        else
+        {
+            // A is bitmap or full
+            pstart = Slice [t]   * A->vlen ;
+            pend   = Slice [t+1] * A->vlen ;
+        }
+
+        //----------------------------------------------------------------------
+        // advise the pages of A->p, A->h, A->b, A->i, and A->x
+        //----------------------------------------------------------------------
+
+        if (kend > kstart)
+        {
+            GB_advise (A, A->p, kstart * psize, (kend + 1) * psize) ;
+            GB_advise (A, A->h, kstart * hsize, kend * hsize) ;
+        }
+        if (A->b_is_packed)
+        {
+            GB_advise (A, A->b, (pstart / 64) * sizeof (uint64_t),
+                GB_ICEIL (pend, 64) * sizeof (uint64_t)) ;
+        }
+        else
+        {
+            GB_advise (A, A->b, pstart, pend) ;
+        }
+        GB_advise (A, A->i, pstart * isize, pend * isize) ;
+        if (!A->iso)
+        {
+            GB_advise (A, A->x, pstart * asize, pend * asize) ;
+        }
+    }
+}
+
@@ -0,0 +1,112 @@
+//------------------------------------------------------------------------------
+// GB_mmap_write: write a matrix to a file, for GB_mmap
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The file has the layout of an uncompressed blob, with the header and each
+// section padded to GB_MMAP_ALIGN bytes (see GB_mmap.h).  Any pending work on
+// A is finished first, and A is converted to 64-bit integers and an unpacked
+// bitmap, so that a matrix mapped from the file can be used by the kernels
+// as-is.  Each section is written directly from A, so no extra memory is
+// needed.  If the file cannot be written, it is removed.
+
+#include "GB_mmap.h"
+
+#define GB_FREE_ALL                 \
+{                                   \
+    if (f != NULL)                  \
+    {                               \
+        fclose (f) ;                \
+        remove (filename) ;         \
+    }                               \
+}
+
+// write a section of the file, padded with zeros; returns true if successful
+static bool GB_fwrite_section (FILE *f, const void *X, int64_t len)
+{
+    static const GB_void zeros [GB_MMAP_ALIGN] = { 0 } ;
+    int64_t pad = GB_BLOB_PAD (len, GB_MMAP_ALIGN) - len ;
+    return ((len == 0 || fwrite (X, 1, len, f) == (size_t) len) &&
+            (pad == 0 || fwrite (zeros, 1, pad, f) == (size_t) pad)) ;
+}
+
+GrB_Info GB_mmap_write          // write a matrix to a file for GB_mmap
+(
+    const char *filename,       // name of the file to write
+    GrB_Matrix A,               // matrix to write
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    FILE *f = NULL ;
+    ASSERT (filename != NULL) ;
+    ASSERT_MATRIX_OK (A, "A for mmap write", GB0) ;
+
+    // finish any pending work, and convert A to 64-bit integers and an
+    // unpacked bitmap
+    GB_MATRIX_WAIT (A) ;
+    ASSERT (!GB_INDEX32 (A) && !GB_BITMAP_PACKED (A)) ;
+
+    //--------------------------------------------------------------------------
+    // determine the size of each section and construct the header
+    //--------------------------------------------------------------------------
+
+    int sparsity = GB_sparsity (A) ;
+    bool is_hyper_or_sparse =
+        (sparsity == GxB_HYPERSPARSE || sparsity == GxB_SPARSE) ;
+    int64_t anz = GB_NNZ (A) ;
+    int64_t anz_held = GB_NNZ_HELD (A) ;
+
+    int64_t Ap_len = is_hyper_or_sparse ?
+        ((A->nvec + 1) * sizeof (int64_t)) : 0 ;
+    int64_t Ah_len = (sparsity == GxB_HYPERSPARSE) ?
+        (A->nvec * sizeof (int64_t)) : 0 ;
+    int64_t Ab_len = (sparsity == GxB_BITMAP) ? anz_held : 0 ;
+    int64_t Ai_len = is_hyper_or_sparse ? (anz * sizeof (int64_t)) : 0 ;
+    int64_t Ax_len = (A->x == NULL) ? 0 :
+        (A->type->size * (A->iso ? 1 : anz_held)) ;
+
+    #define GB_MMAP_PAD(len) GB_BLOB_PAD (len, GB_MMAP_ALIGN)
+    size_t file_size = GB_MMAP_PAD (sizeof (GB_blob_header))
+        + GB_MMAP_PAD (Ap_len) + GB_MMAP_PAD (Ah_len) + GB_MMAP_PAD (Ab_len)
+        + GB_MMAP_PAD (Ai_len) + GB_MMAP_PAD (Ax_len) ;
+
+    GB_blob_header header ;
+    GB_serialize_header (&header, A, file_size, Ap_len, Ah_len, Ab_len,
+        Ai_len, Ax_len, GxB_COMPRESSION_NONE, GB_MMAP_ALIGN_LOG2) ;
+
+    //--------------------------------------------------------------------------
+    // write the file
+    //--------------------------------------------------------------------------
+
+    f = fopen (filename, "wb") ;
+    if (f == NULL)
+    {
+        GB_ERROR (GrB_INVALID_VALUE, "Unable to open file [%s]", filename) ;
+    }
+
+    bool ok = GB_fwrite_section (f, &header, sizeof (GB_blob_header))
+        && GB_fwrite_section (f, A->p, Ap_len)
+        && GB_fwrite_section (f, A->h, Ah_len)
+        && GB_fwrite_section (f, A->b, Ab_len)
+        && GB_fwrite_section (f, A->i, Ai_len)
+        && GB_fwrite_section (f, A->x, Ax_len) ;
+    ok = (fclose (f) == 0) && ok ;
+    if (!ok)
+    {
+        remove (filename) ;
+        GB_ERROR (GrB_INVALID_VALUE, "Unable to write file [%s]", filename) ;
+    }
+
+    return (GrB_SUCCESS) ;
+}
+
@@ -12,8 +12,13 @@
 // This function is not user-callable.  It does the work for user-callable
 // functions GrB_mxm, GrB_mxv, and GrB_vxm.
 
+// If A, B, or M are iso, GB_mxm passes expanded copies of them to
+// GB_mxm_worker, unless only their pattern is used.  T=A*B is iso if
+// GB_iso_semiring determines that all its entries have the same value.
+
 #include "GB_mxm.h"
 #include "GB_accum_mask.h"
+#include "GB_iso.h"
 
 #define GB_FREE_ALL         \
 {                           \
@@ -21,7 +26,11 @@
     GB_Matrix_free (&T) ;   \
 }
 
-GrB_Info GB_mxm                     // C<M> = A*B
+//------------------------------------------------------------------------------
+// GB_mxm_worker: C<M> = A*B, where A, B, and M are not iso unless unused
+//------------------------------------------------------------------------------
+
+static GrB_Info GB_mxm_worker       // C<M> = A*B
 (
     GrB_Matrix C,                   // input/output matrix for results
     const bool C_replace,           // if true, clear C before writing to it
@@ -37,6 +46,7 @@ GrB_Info GB_mxm                     // C<M> = A*B
     const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
     const GrB_Desc_Value AxB_method,// for auto vs user selection of methods
     const int do_sort,              // if nonzero, try to return C unjumbled
+    const GB_void *T_iso_value,     // value of T if iso, or NULL if not iso
     GB_Context Context
 )
 {
@@ -156,6 +166,12 @@ GrB_Info GB_mxm                     // C<M> = A*B
         return (info) ;
     }
 
+    if (T_iso_value != NULL && !T->iso)
+    { 
+        // all entries of T have the same value
+        GB_OK (GB_iso_compress (T, T_iso_value, Context)) ;
+    }
+
     ASSERT_MATRIX_OK (T, "T=A*B from GB_AxB_meta", GB0) ;
     ASSERT_MATRIX_OK_OR_NULL (MT, "MT from GB_AxB_meta", GB0) ;
     ASSERT (GB_ZOMBIES_OK (T)) ;
@@ -220,3 +236,82 @@ GrB_Info GB_mxm                     // C<M> = A*B
     }
 }
 
+//------------------------------------------------------------------------------
+// GB_mxm: C<M> = A*B
+//------------------------------------------------------------------------------
+
+#undef  GB_FREE_ALL
+#define GB_FREE_ALL             \
+{                               \
+    GB_Matrix_free (&M2) ;      \
+    GB_Matrix_free (&A2) ;      \
+    GB_Matrix_free (&B2) ;      \
+}
+
+GrB_Info GB_mxm                     // C<M> = A*B
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const bool C_replace,           // if true, clear C before writing to it
+    const GrB_Matrix M,             // optional mask for C, unused if NULL
+    const bool Mask_comp,           // if true, use !M
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_Semiring semiring,    // defines '+' and '*' for C=A*B
+    const GrB_Matrix A,             // input matrix
+    const bool A_transpose,         // if true, use A' instead of A
+    const GrB_Matrix B,             // input matrix
+    const bool B_transpose,         // if true, use B' instead of B
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    const GrB_Desc_Value AxB_method,// for auto vs user selection of methods
+    const int do_sort,              // if nonzero, try to return C unjumbled
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GrB_Matrix M2 = NULL, A2 = NULL, B2 = NULL ;
+    GB_RETURN_IF_NULL_OR_FAULTY (semiring) ;
+
+    //--------------------------------------------------------------------------
+    // determine if T=A*B is iso
+    //--------------------------------------------------------------------------
+
+    GB_void T_iso_value [GB_VLA(semiring->add->op->ztype->size)] ;
+    bool T_iso = GB_iso_semiring (T_iso_value, semiring, flipxy, A, B) ;
+
+    //--------------------------------------------------------------------------
+    // expand any iso matrices whose values are used
+    //--------------------------------------------------------------------------
+
+    bool A_is_pattern, B_is_pattern, M_struct = Mask_struct ;
+    GB_AxB_pattern (&A_is_pattern, &B_is_pattern, flipxy,
+        semiring->multiply->opcode) ;
+    GB_OK (GB_iso_expand (C, Context)) ;
+    GB_OK (GB_convert_int32_to_int64 (C, Context)) ;
+    GB_OK (GB_convert_packed_to_bitmap (C, Context)) ;
+    GB_OK (GB_iso_mask (&M2, &M_struct, M, Context)) ;
+    if (!A_is_pattern)
+    { 
+        GB_OK (GB_iso_expand_copy (&A2, A, Context)) ;
+    }
+    if (!B_is_pattern)
+    { 
+        GB_OK (GB_iso_expand_copy (&B2, B, Context)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // C<M> = accum (C,A*B)
+    //--------------------------------------------------------------------------
+
+    info = GB_mxm_worker (C, C_replace,
+        (M2 == NULL) ? M : M2, Mask_comp, M_struct, accum, semiring,
+        (A2 == NULL) ? A : A2, A_transpose,
+        (B2 == NULL) ? B : B2, B_transpose,
+        flipxy, AxB_method, do_sort, T_iso ? T_iso_value : NULL, Context) ;
+    GB_FREE_ALL ;
+    return (info) ;
+}
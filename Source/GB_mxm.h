@@ -10,6 +10,7 @@
 #ifndef GB_MXM_H
 #define GB_MXM_H
 #include "GB_AxB_saxpy.h"
+#include "GB_AxB_cost.h"
 
 //------------------------------------------------------------------------------
 
@@ -36,6 +37,7 @@ GrB_Info GB_AxB_dot                 // dot product (multiple methods)
 (
     GrB_Matrix *Chandle,            // output matrix, NULL on input
     GrB_Matrix C_in_place,          // input/output matrix, if done in-place
+    const GrB_BinaryOp accum,       // accum for C_in+=A*B, or NULL if C_in=A*B
     GrB_Matrix M,                   // optional mask matrix
     const bool Mask_comp,           // if true, use !M
     const bool Mask_struct,         // if true, use the only structure of M
@@ -114,7 +116,9 @@ bool GB_AxB_semiring_builtin        // true if semiring is builtin
 GB_PUBLIC   // accessed by the MATLAB tests in GraphBLAS/Test only
 GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
 (
-    GrB_Matrix *Chandle,            // output matrix
+    GrB_Matrix *Chandle,            // output matrix, if not done in-place
+    GrB_Matrix C_in,                // input/output matrix, if done in-place
+    const GrB_BinaryOp accum,       // accum for C_in+=A*B, or NULL if C_in=A*B
     const GrB_Matrix M,             // mask matrix for C<!M>=A'*B
     const bool Mask_comp,           // if true, use !M
     const bool Mask_struct,         // if true, use the only structure of M
@@ -235,5 +239,30 @@ bool GB_AxB_dot2_control  // true: use dot2, false: use saxpy
     GB_Context Context
 ) ;
 
+//------------------------------------------------------------------------------
+// GB_AxB_outer: C=A*B' via outer products, without forming B'
+//------------------------------------------------------------------------------
+
+GrB_Info GB_AxB_outer               // C=A*B', outer product method
+(
+    GrB_Matrix *Chandle,            // output matrix
+    const GrB_Matrix A,             // input matrix
+    const GrB_Matrix B,             // input matrix
+    const GrB_Semiring semiring,    // semiring that defines C=A*B'
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    GB_Context Context
+) ;
+
+bool GB_AxB_outer_control   // true: use outer, false: use another method
+(
+    const GrB_Matrix M,             // mask matrix, may be NULL
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const GrB_Semiring semiring,
+    const GrB_Desc_Value AxB_method,
+    double *t_outer,                // estimated time of GB_AxB_outer, if known
+    GB_Context Context
+) ;
+
 #endif
 
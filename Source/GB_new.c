@@ -96,6 +96,8 @@ GrB_Info GB_new                 // create matrix, except for indices & values
     A->hyper_switch = hyper_switch ;
     A->bitmap_switch = GB_Global_bitmap_switch_matrix_get (vlen, vdim) ;
     A->sparsity = GxB_AUTO_SPARSITY ;
+    A->index32_control = GB_Global_index32_control_get ( ) ;
+    A->bitmap_pack_control = GB_Global_bitmap_pack_control_get ( ) ;
 
     if (sparsity == GxB_HYPERSPARSE)
     { 
@@ -150,6 +152,13 @@ GrB_Info GB_new                 // create matrix, except for indices & values
     A->h = NULL ;
     A->p_shallow = false ;
     A->h_shallow = false ;
+    A->p_is_32 = false ;
+    A->h_is_32 = false ;
+    A->p_size = 0 ;
+    A->h_size = 0 ;
+    A->mmap_base = NULL ;
+    A->mmap_size = 0 ;
+    A->mmap_shallow = false ;
     // #include "GB_new_mkl_template.c"
 
     A->logger = NULL ;          // no error logged yet
@@ -163,9 +172,16 @@ GrB_Info GB_new                 // create matrix, except for indices & values
     A->b_shallow = false ;
     A->i_shallow = false ;
     A->x_shallow = false ;
+    A->i_is_32 = false ;
+    A->b_is_packed = false ;
+    A->b_size = 0 ;
+    A->i_size = 0 ;
+    A->x_size = 0 ;
     A->nzombies = 0 ;
     A->jumbled = false ;
+    A->iso = false ;
     A->Pending = NULL ;
+    GB_PATTERN_CHANGED (A) ;
 
     //--------------------------------------------------------------------------
     // Allocate A->p and A->h if requested
@@ -189,11 +205,13 @@ GrB_Info GB_new                 // create matrix, except for indices & values
         // Sets the vector pointers to zero, which defines all vectors as empty
         A->magic = GB_MAGIC ;
         A->p = GB_CALLOC (A->plen+1, int64_t) ;
+        A->p_size = (A->plen+1) * sizeof (int64_t) ;
         ok = (A->p != NULL) ;
         if (A_is_hyper)
         { 
             // since nvec is zero, there is never any need to initialize A->h
             A->h = GB_MALLOC (A->plen, int64_t) ;
+            A->h_size = A->plen * sizeof (int64_t) ;
             ok = ok && (A->h != NULL) ;
         }
     }
@@ -206,10 +224,12 @@ GrB_Info GB_new                 // create matrix, except for indices & values
         // check A->nzmax == 0 since A->p [A->nvec] might be undefined.
         A->magic = GB_MAGIC2 ;
         A->p = GB_MALLOC (A->plen+1, int64_t) ;
+        A->p_size = (A->plen+1) * sizeof (int64_t) ;
         ok = (A->p != NULL) ;
         if (A_is_hyper)
         { 
             A->h = GB_MALLOC (A->plen, int64_t) ;
+            A->h_size = A->plen * sizeof (int64_t) ;
             ok = ok && (A->h != NULL) ;
         }
     }
@@ -18,7 +18,9 @@
 // is GB_NNZ_HELD (A).
 
 // nnz(A) if A is sparse or hypersparse
-#define GB_NNZ_SPARSE(A) ((A)->p [(A)->nvec])
+#define GB_NNZ_SPARSE(A)                                                \
+    ((A)->p_is_32 ? ((int64_t) ((int32_t *) (A)->p) [(A)->nvec])        \
+                  : (A)->p [(A)->nvec])
 
 // nnz(A) if A is full
 #define GB_NNZ_FULL(A) ((A)->vlen * (A)->vdim)
@@ -25,8 +25,13 @@ GrB_Info GB_nvals           // get the number of entries in a matrix
 
     GB_RETURN_IF_NULL (nvals) ;
 
-    // leave zombies alone, and leave jumbled, but assemble any pending tuples
-    GB_MATRIX_WAIT_IF_PENDING (A) ;
+    // leave zombies alone, and leave jumbled, but assemble any pending tuples.
+    // A matrix held in 32-bit integers is left as-is; see GB_NNZ_SPARSE.
+    if (GB_PENDING (A))
+    { 
+        GrB_Info info ;
+        GB_OK (GB_Matrix_wait (A, Context)) ;
+    }
 
     //--------------------------------------------------------------------------
     // return the number of entries in the matrix
@@ -58,14 +58,28 @@ int64_t GB_nvec_nonempty        // return # of non-empty vectors
     //--------------------------------------------------------------------------
 
     int64_t nvec_nonempty = 0 ;
-    const int64_t *GB_RESTRICT Ap = A->p ;
-
     int64_t k ;
-    #pragma omp parallel for num_threads(nthreads) schedule(static) \
-            reduction(+:nvec_nonempty)
-    for (k = 0 ; k < anvec ; k++)
-    { 
-        if (Ap [k] < Ap [k+1]) nvec_nonempty++ ;
+
+    if (A->p_is_32)
+    {
+        // A->p is held in 32-bit integers
+        const int32_t *GB_RESTRICT Ap = (int32_t *) A->p ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+                reduction(+:nvec_nonempty)
+        for (k = 0 ; k < anvec ; k++)
+        { 
+            if (Ap [k] < Ap [k+1]) nvec_nonempty++ ;
+        }
+    }
+    else
+    {
+        const int64_t *GB_RESTRICT Ap = A->p ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+                reduction(+:nvec_nonempty)
+        for (k = 0 ; k < anvec ; k++)
+        { 
+            if (Ap [k] < Ap [k+1]) nvec_nonempty++ ;
+        }
     }
 
     ASSERT (nvec_nonempty >= 0 && nvec_nonempty <= A->vdim) ;
@@ -391,6 +391,9 @@ struct GB_Descriptor_opaque // content of GrB_Descriptor
     double chunk ;          // chunk size for # of threads for small problems
     bool predefined ;       // if true, descriptor is predefined
     bool do_sort ;          // if nonzero, do the sort in GrB_mxm
+    GrB_Desc_Value import ; // GxB_DEFAULT or GxB_SHALLOW_IMPORT
+    GrB_Desc_Value compression ;    // GxB_DEFAULT, GxB_COMPRESSION_NONE,
+                            // or GxB_COMPRESSION_VARINT
     // #include "GB_Descriptor_opaque_mkl_template.h"
 } ;
 
@@ -399,13 +402,20 @@ struct GB_Descriptor_opaque // content of GrB_Descriptor
 //------------------------------------------------------------------------------
 
 // Pending tuples are a list of unsorted (i,j,x) tuples that have not yet been
-// added to a matrix.  The data structure is defined in GB_Pending.h.
+// added to a matrix.  The data structure is defined in GB_Pending.h.  If
+// run_size is nonzero, the list is held as a sequence of sorted runs,
+// followed by an open run in the order the tuples were added (see
+// GB_Pending_merge).
 
 struct GB_Pending_struct    // list of pending tuples for a matrix
 {
     int64_t n ;         // number of pending tuples to add to matrix
     int64_t nmax ;      // size of i,j,x
     bool sorted ;       // true if pending tuples are in sorted order
+    int64_t run_size ;  // size of each sorted run, or 0 if none
+    int nruns ;         // number of sorted runs
+    int64_t run [GB_PENDING_MAXRUNS+1] ;    // run k is run [k] to run [k+1]-1,
+                        // and the open run is run [nruns] to n-1
     int64_t *i ;        // row indices of pending tuples
     int64_t *j ;        // col indices of pending tuples; NULL if A->vdim <= 1
     GB_void *x ;        // values of pending tuples
@@ -443,7 +453,7 @@ struct GB_Matrix_opaque     // content of GrB_Matrix
 #define GBH(Ah,k)       ((Ah == NULL) ? (k) : Ah [k])
 #define GBI(Ai,p,avlen) ((Ai == NULL) ? ((p) % (avlen)) : Ai [p])
 #define GBB(Ab,p)       ((Ab == NULL) ? 1 : Ab [p])
-// #define GBX(...)     TODO: constant-valued matrices
+#define GBX(Ax,p,A_iso) ((Ax) [(A_iso) ? 0 : (p)])
 
 #endif
 
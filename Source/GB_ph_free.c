@@ -37,15 +37,20 @@ void GB_ph_free                 // free A->p and A->h of a matrix
     if (!A->p_shallow) GB_FREE (A->p) ;
     A->p = NULL ;
     A->p_shallow = false ;
+    A->p_is_32 = false ;
+    A->p_size = 0 ;
 
     // free A->h unless it is shallow
     if (!A->h_shallow) GB_FREE (A->h) ;
     A->h = NULL ;
     A->h_shallow = false ;
+    A->h_is_32 = false ;
+    A->h_size = 0 ;
 
     A->plen = 0 ;
     A->nvec = 0 ;
     A->nvec_nonempty = 0 ;
+    GB_PATTERN_CHANGED (A) ;
 
     //--------------------------------------------------------------------------
     // set the status to invalid
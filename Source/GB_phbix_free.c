@@ -9,9 +9,10 @@
 
 // Frees all allocatable content of a matrix, except for the header itself.
 // A->magic becomes GB_MAGIC2.  If this matrix is given to a user-callable
-// GraphBLAS function, it will generate a GrB_INVALID_OBJECT error.
+// GraphBLAS function, it will generate a GrB_INVALID_OBJECT error.  If A
+// owns a file mapping (see GxB_Matrix_mmap), it is unmapped.
 
-#include "GB.h"
+#include "GB_mmap.h"
 
 void GB_phbix_free              // free all content of a matrix
 (
@@ -21,5 +22,6 @@ void GB_phbix_free              // free all content of a matrix
 
     GB_ph_free (A) ;
     GB_bix_free (A) ;
+    GB_mmap_free (A) ;
 }
 
@@ -0,0 +1,39 @@
+//------------------------------------------------------------------------------
+// GB_pool_free: free workspace, or return it to the memory pool
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Frees a block allocated by GB_pool_malloc.  The block is returned to the
+// memory pool if it has a size class k, and if the pool has room for it.
+// Otherwise it is freed.  If p is NULL on input, it is not freed.
+
+#include "GB.h"
+
+void GB_pool_free
+(
+    void *p                 // pointer to block of memory to free
+)
+{
+    if (p != NULL)
+    {
+        int64_t *block = ((int64_t *) p) - GB_POOL_HEADER / sizeof (int64_t) ;
+        int k = (int) block [0] ;
+        if (k >= 0 && !GB_Global_malloc_debug_get ( ) &&
+            GB_Global_free_pool_put ((void *) block, k))
+        {
+            // the block is now held by the pool, not by GraphBLAS
+            if (GB_Global_malloc_tracking_get ( ))
+            { 
+                GB_Global_nmalloc_decrement ( ) ;
+            }
+        }
+        else
+        { 
+            GB_free_memory ((void *) block) ;
+        }
+    }
+}
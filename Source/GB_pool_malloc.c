@@ -0,0 +1,107 @@
+//------------------------------------------------------------------------------
+// GB_pool_malloc: allocate workspace, reusing a block from the memory pool
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Allocates workspace that is freed by GB_pool_free when the method that
+// allocated it returns.  If the memory pool is enabled (see GxB_MEMORY_POOL),
+// the block is rounded up to a size of 2^k bytes and taken from the pool if
+// it holds a block of that size.  Otherwise, a new block is allocated with
+// GB_malloc_memory or GB_calloc_memory.  A block allocated by GB_pool_malloc
+// must be freed by GB_pool_free, and never by GB_free_memory, since the block
+// starts with a header of GB_POOL_HEADER bytes that holds its size class k,
+// or -1 if the block cannot be returned to the pool.
+
+// Like GB_malloc_memory, a block of size zero is never allocated, so that the
+// return pointer can be checked for the out-of-memory condition.
+
+#include "GB.h"
+
+void *GB_pool_malloc        // pointer to allocated block of memory
+(
+    size_t nitems,          // number of items to allocate
+    size_t size_of_item,    // sizeof each item
+    bool do_calloc          // if true, set the block to zero
+)
+{
+
+    //--------------------------------------------------------------------------
+    // determine the size of the block
+    //--------------------------------------------------------------------------
+
+    nitems = GB_IMAX (1, nitems) ;
+    size_of_item = GB_IMAX (1, size_of_item) ;
+    size_t size ;
+    bool ok = GB_size_t_multiply (&size, nitems, size_of_item) ;
+    if (!ok || nitems > GxB_INDEX_MAX || size_of_item > GxB_INDEX_MAX)
+    { 
+        // overflow
+        return (NULL) ;
+    }
+
+    // find the smallest size class k with 2^k >= size + GB_POOL_HEADER
+    size_t bsize = size + GB_POOL_HEADER ;
+    int k = GB_POOL_KMIN ;
+    while (k < 62 && (((size_t) 1) << k) < bsize)
+    {
+        k++ ;
+    }
+
+    // The pool is bypassed when testing out-of-memory conditions, so that
+    // each allocation of workspace can be made to fail.
+    bool use_pool = (GB_Global_free_pool_limit_get ( ) > 0) &&
+        !GB_Global_malloc_debug_get ( ) && ((((size_t) 1) << k) >= bsize) ;
+
+    //--------------------------------------------------------------------------
+    // get a block from the pool, or allocate a new one
+    //--------------------------------------------------------------------------
+
+    int64_t *block = NULL ;
+    if (use_pool)
+    {
+        block = (int64_t *) GB_Global_free_pool_get (k) ;
+        if (block != NULL)
+        {
+            // the block is in use again
+            if (GB_Global_malloc_tracking_get ( ))
+            { 
+                GB_Global_nmalloc_increment ( ) ;
+            }
+            if (do_calloc)
+            { 
+                int nthreads = GB_nthreads (size, GB_Global_chunk_get ( ),
+                    GB_Global_nthreads_max_get ( )) ;
+                GB_memset (block + GB_POOL_HEADER / sizeof (int64_t), 0,
+                    size, nthreads) ;
+            }
+        }
+        else
+        { 
+            // a new block of size 2^k, so it can be returned to the pool
+            bsize = ((size_t) 1) << k ;
+        }
+    }
+
+    if (block == NULL)
+    {
+        block = (int64_t *) (do_calloc ?
+            GB_calloc_memory (bsize, sizeof (GB_void)) :
+            GB_malloc_memory (bsize, sizeof (GB_void))) ;
+        if (block == NULL)
+        { 
+            // out of memory
+            return (NULL) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // return the block, just past its header
+    //--------------------------------------------------------------------------
+
+    block [0] = use_pool ? k : (-1) ;
+    return ((void *) (block + GB_POOL_HEADER / sizeof (int64_t))) ;
+}
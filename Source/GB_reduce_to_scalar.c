@@ -22,9 +22,12 @@
 // case when nvals(A) is zero, the existence of the identity value makes the
 // code a little simpler.
 
+// If A is iso, it is reduced via an expanded copy.
+
 #include "GB_reduce.h"
 #include "GB_binop.h"
 #include "GB_atomics.h"
+#include "GB_iso.h"
 #ifndef GBCOMPACT
 #include "GB_red__include.h"
 #endif
@@ -33,6 +36,7 @@
 {                                   \
     GB_FREE (W) ;                   \
     GB_FREE (F) ;                   \
+    GB_Matrix_free (&A2) ;          \
 }
 
 GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
@@ -41,7 +45,7 @@ GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
     const GrB_Type ctype,       // the type of scalar, c
     const GrB_BinaryOp accum,   // for c = accum(c,s)
     const GrB_Monoid reduce,    // monoid to do the reduction
-    const GrB_Matrix A,         // matrix to reduce
+    const GrB_Matrix A_in,      // matrix to reduce
     GB_Context Context
 )
 {
@@ -56,6 +60,7 @@ GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
     GB_RETURN_IF_NULL (c) ;
     GB_void *GB_RESTRICT W = NULL ;
     bool    *GB_RESTRICT F = NULL ;
+    GrB_Matrix A = A_in, A2 = NULL ;
 
     ASSERT_TYPE_OK (ctype, "type of scalar c", GB0) ;
     ASSERT_MONOID_OK (reduce, "reduce for reduce_to_scalar", GB0) ;
@@ -83,6 +88,9 @@ GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
     ASSERT (GB_JUMBLED_OK (A)) ;
     ASSERT (!GB_PENDING (A)) ;
 
+    GB_OK (GB_iso_expand_copy (&A2, A_in, Context)) ;
+    if (A2 != NULL) A = A2 ;
+
     //--------------------------------------------------------------------------
     // get A
     //--------------------------------------------------------------------------
@@ -121,7 +129,7 @@ GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
         int nthreads = 0, ntasks = 0 ;
         GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
         nthreads = GB_nthreads (anz, chunk, nthreads_max) ;
-        ntasks = (nthreads == 1) ? 1 : (64 * nthreads) ;
+        ntasks = (nthreads == 1) ? 1 : (GB_NUMA_NTASKS (64) * nthreads) ;
         ntasks = GB_IMIN (ntasks, anz) ;
         ntasks = GB_IMAX (ntasks, 1) ;
 
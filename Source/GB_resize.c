@@ -8,6 +8,7 @@
 //------------------------------------------------------------------------------
 
 #include "GB_select.h"
+#include "GB_iso.h"
 
 #define GB_FREE_ALL         \
 {                           \
@@ -37,6 +38,7 @@ GrB_Info GB_resize              // change the size of a matrix
     GB_void *GB_RESTRICT Ax_new = NULL ;
     int8_t  *GB_RESTRICT Ab_new = NULL ;
     ASSERT_MATRIX_OK (A, "A to resize", GB0) ;
+    GB_PATTERN_CHANGED (A) ;
 
     //--------------------------------------------------------------------------
     // handle the CSR/CSC format
@@ -80,6 +82,14 @@ GrB_Info GB_resize              // change the size of a matrix
 
     ASSERT (!GB_JUMBLED (A)) ;
 
+    // a shallow matrix is copied and an iso matrix is expanded, since its
+    // values are moved below, its pattern is held in 64-bit integers, and its
+    // bitmap is unpacked
+    GB_OK (GB_unshallow (A, Context)) ;
+    GB_OK (GB_iso_expand (A, Context)) ;
+    GB_OK (GB_convert_int32_to_int64 (A, Context)) ;
+    GB_OK (GB_convert_packed_to_bitmap (A, Context)) ;
+
     //--------------------------------------------------------------------------
     // resize the matrix
     //--------------------------------------------------------------------------
@@ -210,6 +220,11 @@ GrB_Info GB_resize              // change the size of a matrix
         A->vdim = vdim_new ;
         A->vlen = vlen_new ;
         A->nzmax = nzmax_new ;
+        A->x_size = nzmax_new * asize ;
+        if (A_is_bitmap)
+        { 
+            A->b_size = nzmax_new * sizeof (int8_t) ;
+        }
         A->nvec = vdim_new ;
         A->nvec_nonempty = (vlen_new == 0) ? 0 : vdim_new ;
         ASSERT_MATRIX_OK (A, "A bitmap/full shrunk", GB0) ;
@@ -0,0 +1,245 @@
+//------------------------------------------------------------------------------
+// GB_rsort: parallel radix sort of the (j,i,k) or (i,k) tuples for GB_builder
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Sorts the n tuples (J [p], I [p]) in ascending order, where 0 <= I [p] <
+// vlen.  If J is NULL, the tuples are just (I [p]).  K is not accessed on
+// input.  On output, K [p] is the position in the input list of the tuple now
+// in position p.  The sort is stable, so the result is identical to sorting
+// the (j,i,k) tuples with GB_msort_3b (or the (i,k) tuples with GB_msort_2b)
+// with K [p] = p on input.
+
+// Each tuple is packed into a single 64-bit key, (j << ibits) + i, held in I,
+// where ibits is the # of bits in vlen-1.  The keys are then sorted with a
+// least-significant-digit radix sort, with the position k as the payload.
+// Each pass sorts the keys by a digit of up to GB_RSORT_DIGIT bits.  Each
+// thread counts the digits in its slice of the keys, the counts are summed
+// in order of (digit, slice) to give the position of each digit for each
+// slice, and each thread then moves its slice into place, in order, so each
+// pass is stable.  The # of passes is set by the largest key present, not by
+// the dimensions of the matrix, and a pass is skipped if all the keys have
+// the same digit.  The keys are unpacked into I and J when done.
+
+// The caller must ensure the packed keys fit in 63 bits (see GB_rsort_nbits).
+
+#include "GB_sort.h"
+
+#define GB_FREE_WORK            \
+{                               \
+    GB_FREE_POOL (W) ;          \
+    GB_FREE_POOL (Wkey) ;       \
+    GB_FREE_POOL (Count) ;      \
+}
+
+GrB_Info GB_rsort       // radix sort (J,I,K) or (I,K), using (J,I) as the key
+(
+    int64_t *J,                 // size n array, or NULL if vdim <= 1
+    int64_t *I,                 // size n array
+    int64_t *GB_RESTRICT K,     // size n array, output only
+    const int64_t n,
+    const int64_t vlen,         // 0 <= I [p] < vlen must hold
+    int nthreads                // # of threads to use
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (I != NULL && K != NULL && n >= 0) ;
+    int64_t *W = NULL, *Wkey = NULL, *Count = NULL ;
+    nthreads = GB_IMAX (GB_IMIN (nthreads, n / GB_RSORT_CHUNK), 1) ;
+    int ntasks = nthreads ;
+    int ibits = GB_rsort_nbits (vlen - 1) ;
+    int64_t imask = (((int64_t) 1) << ibits) - 1 ;
+    int64_t p ;
+    int tid ;
+
+    //--------------------------------------------------------------------------
+    // pack the (j,i) tuples into the keys, and find the # of bits they use
+    //--------------------------------------------------------------------------
+
+    int64_t kor = 0 ;
+    if (J != NULL)
+    {
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(|:kor)
+        for (p = 0 ; p < n ; p++)
+        {
+            int64_t key = (J [p] << ibits) | I [p] ;
+            I [p] = key ;
+            kor |= key ;
+        }
+    }
+    else
+    {
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(|:kor)
+        for (p = 0 ; p < n ; p++)
+        {
+            kor |= I [p] ;
+        }
+    }
+
+    int nbits = GB_rsort_nbits (kor) ;
+    int npasses = GB_ICEIL (nbits, GB_RSORT_DIGIT) ;
+    int dbits = (npasses == 0) ? 0 : GB_ICEIL (nbits, npasses) ;
+    int64_t ndigits = ((int64_t) 1) << dbits ;
+    int64_t dmask = ndigits - 1 ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    // The keys and their positions are moved back and forth between (I,K) and
+    // (J,W) on each pass.  J is used as workspace for the keys if present.
+    if (npasses > 0)
+    {
+        W = GB_MALLOC_POOL (n, int64_t) ;
+        Wkey = (J == NULL) ? GB_MALLOC_POOL (n, int64_t) : NULL ;
+        Count = GB_MALLOC_POOL (ntasks * ndigits, int64_t) ;
+        if (W == NULL || (J == NULL && Wkey == NULL) || Count == NULL)
+        {
+            // out of memory: unpack the keys and return
+            if (J != NULL)
+            {
+                #pragma omp parallel for num_threads(nthreads) schedule(static)
+                for (p = 0 ; p < n ; p++)
+                {
+                    int64_t key = I [p] ;
+                    J [p] = key >> ibits ;
+                    I [p] = key & imask ;
+                }
+            }
+            GB_FREE_WORK ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // sort the keys, one digit at a time
+    //--------------------------------------------------------------------------
+
+    int64_t *Key_in  = I ;
+    int64_t *Key_out = (J != NULL) ? J : Wkey ;
+    // the first pass creates the positions, in K or W, so that if no pass is
+    // skipped, the last pass leaves them in K
+    int64_t *K_in  = NULL ;
+    int64_t *K_out = (npasses % 2 == 1) ? K : W ;
+
+    for (int pass = 0 ; pass < npasses ; pass++)
+    {
+
+        //----------------------------------------------------------------------
+        // count the digits in each slice
+        //----------------------------------------------------------------------
+
+        int shift = pass * dbits ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (tid = 0 ; tid < ntasks ; tid++)
+        {
+            int64_t *GB_RESTRICT Count_tid = Count + tid * ndigits ;
+            memset (Count_tid, 0, ndigits * sizeof (int64_t)) ;
+            int64_t pstart, pend ;
+            GB_PARTITION (pstart, pend, n, tid, ntasks) ;
+            for (int64_t p = pstart ; p < pend ; p++)
+            {
+                Count_tid [(Key_in [p] >> shift) & dmask]++ ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // find the position of each digit in each slice
+        //----------------------------------------------------------------------
+
+        int64_t s = 0 ;
+        bool skip = false ;
+        for (int64_t d = 0 ; d < ndigits ; d++)
+        {
+            int64_t s_start = s ;
+            for (int tid = 0 ; tid < ntasks ; tid++)
+            {
+                int64_t c = Count [tid * ndigits + d] ;
+                Count [tid * ndigits + d] = s ;
+                s += c ;
+            }
+            // the pass does nothing if all the keys have the same digit
+            skip = skip || (s - s_start == n) ;
+        }
+        if (skip) continue ;
+
+        //----------------------------------------------------------------------
+        // move each slice into place
+        //----------------------------------------------------------------------
+
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (tid = 0 ; tid < ntasks ; tid++)
+        {
+            int64_t *GB_RESTRICT Count_tid = Count + tid * ndigits ;
+            int64_t pstart, pend ;
+            GB_PARTITION (pstart, pend, n, tid, ntasks) ;
+            for (int64_t p = pstart ; p < pend ; p++)
+            {
+                int64_t key = Key_in [p] ;
+                int64_t q = Count_tid [(key >> shift) & dmask]++ ;
+                Key_out [q] = key ;
+                K_out [q] = (K_in == NULL) ? p : K_in [p] ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // swap the input and output for the next pass
+        //----------------------------------------------------------------------
+
+        int64_t *T = Key_in ; Key_in = Key_out ; Key_out = T ;
+        K_in = K_out ; K_out = (K_in == K) ? W : K ;
+    }
+
+    //--------------------------------------------------------------------------
+    // place the positions in K, and unpack the keys into I and J
+    //--------------------------------------------------------------------------
+
+    if (K_in == NULL)
+    {
+        // no pass was done; the keys are already sorted
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (p = 0 ; p < n ; p++)
+        {
+            K [p] = p ;
+        }
+    }
+    else if (K_in != K)
+    {
+        GB_memcpy (K, K_in, n * sizeof (int64_t), nthreads) ;
+    }
+
+    if (J != NULL)
+    {
+        // Key_in is either I or J; each key is read before I [p] and J [p]
+        // are written
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (p = 0 ; p < n ; p++)
+        {
+            int64_t key = Key_in [p] ;
+            J [p] = key >> ibits ;
+            I [p] = key & imask ;
+        }
+    }
+    else if (Key_in != I)
+    {
+        GB_memcpy (I, Key_in, n * sizeof (int64_t), nthreads) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
+
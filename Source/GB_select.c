@@ -9,13 +9,18 @@
 
 // C<M> = accum (C, select(A,Thunk)) or select(A,Thunk)').
 
+// If A is iso, T is selected from an expanded copy of A, and is then made iso
+// with the same value as A.
+
 #define GB_FREE_ALL                         \
 {                                           \
     GB_Matrix_free (&T) ;                   \
+    GB_Matrix_free (&A2) ;                  \
 }
 
 #include "GB_select.h"
 #include "GB_accum_mask.h"
+#include "GB_iso.h"
 
 GrB_Info GB_select          // C<M> = accum (C, select(A,k)) or select(A',k)
 (
@@ -50,7 +55,7 @@ GrB_Info GB_select          // C<M> = accum (C, select(A,k)) or select(A',k)
     ASSERT_MATRIX_OK (A, "A input for GB_select", GB0) ;
     ASSERT_SCALAR_OK_OR_NULL (Thunk_in, "Thunk_in for GB_select", GB0) ;
 
-    GrB_Matrix T = NULL ;
+    GrB_Matrix T = NULL, A2 = NULL ;
 
     // check domains and dimensions for C<M> = accum (C,T)
     GrB_Info info ;
@@ -485,9 +490,17 @@ GrB_Info GB_select          // C<M> = accum (C, select(A,k)) or select(A',k)
     else
     { 
         // T = select (A, Thunk)
-        GB_OK (GB_selector (&T, opcode, op, flipij, A, ithunk,
+        GB_OK (GB_iso_expand_copy (&A2, A, Context)) ;
+        GB_OK (GB_selector (&T, opcode, op, flipij, (A2 == NULL) ? A : A2,
+            ithunk,
             (op_is_thunk_comparator || op_is_user_defined) ? Thunk_in : NULL,
             Context)) ;
+        GB_Matrix_free (&A2) ;
+        if (A->iso)
+        { 
+            // all entries of T have the same value as A
+            GB_OK (GB_iso_compress (T, (GB_void *) A->x, Context)) ;
+        }
     }
 
     T->is_csc = A_csc ;
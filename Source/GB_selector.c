@@ -214,7 +214,7 @@ GrB_Info GB_selector
 
     GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
     int nthreads = GB_nthreads (work, chunk, nthreads_max) ;
-    int ntasks = (nthreads == 1) ? 1 : (8 * nthreads) ;
+    int ntasks = (nthreads == 1) ? 1 : (GB_NUMA_NTASKS (8) * nthreads) ;
 
     //--------------------------------------------------------------------------
     // slice the entries for each task
@@ -401,6 +401,7 @@ GrB_Info GB_selector
         { 
             GB_FREE (Ap) ;
             A->p = Cp ; Cp = NULL ;
+            A->p_size = (cplen+1) * sizeof (int64_t) ;
         }
 
         ASSERT (Cp == NULL) ;
@@ -409,6 +410,8 @@ GrB_Info GB_selector
         GB_FREE (Ax) ;
         A->i = Ci ; Ci = NULL ;
         A->x = Cx ; Cx = NULL ;
+        A->i_size = cnz * sizeof (int64_t) ;
+        A->x_size = cnz * asize ;
         A->nzmax = cnz ;
         A->nvec_nonempty = C_nvec_nonempty ;
         A->jumbled = A_jumbled ;        // A remains jumbled (in-place select)
@@ -472,6 +475,10 @@ GrB_Info GB_selector
         C->h = Ch ; Ch = NULL ;
         C->i = Ci ; Ci = NULL ;
         C->x = Cx ; Cx = NULL ;
+        C->p_size = (cplen+1) * sizeof (int64_t) ;
+        C->h_size = (C->h == NULL) ? 0 : (aplen * sizeof (int64_t)) ;
+        C->i_size = cnz * sizeof (int64_t) ;
+        C->x_size = cnz * asize ;
         C->nzmax = cnz ;
         C->magic = GB_MAGIC ;
         C->nvec_nonempty = C_nvec_nonempty ;
@@ -0,0 +1,204 @@
+//------------------------------------------------------------------------------
+// GB_serialize: serialize a matrix into a blob
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The matrix A is written into a single blob, in its native format: its
+// sparsity, CSR/CSC format, 32-bit integers, packed bitmap, and iso property
+// are all preserved, so that GB_deserialize can reconstruct it without any
+// conversion.  Any pending work is finished first.  The blob is allocated with
+// the same malloc function used by GraphBLAS, as for GxB_*_export.
+
+#include "GB_serialize.h"
+
+#define GB_FREE_WORK                \
+{                                   \
+    GB_FREE_POOL (Bp) ;             \
+    GB_FREE_POOL (Bh) ;             \
+    GB_FREE_POOL (Bi) ;             \
+}
+
+#define GB_FREE_ALL                 \
+{                                   \
+    GB_FREE_WORK ;                  \
+    GB_FREE (blob) ;                \
+}
+
+GrB_Info GB_serialize           // serialize a matrix into a blob
+(
+    // output:
+    GB_void **blob_handle,      // the blob, allocated on output
+    size_t *blob_size_handle,   // size of the blob
+    // input:
+    GrB_Matrix A,               // matrix to serialize
+    int compression,            // GxB_COMPRESSION_NONE or _VARINT
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    int64_t *Bp = NULL, *Bh = NULL, *Bi = NULL ;
+    GB_void *blob = NULL ;
+    ASSERT (blob_handle != NULL && blob_size_handle != NULL) ;
+    ASSERT_MATRIX_OK (A, "A for serialize", GB0) ;
+    (*blob_handle) = NULL ;
+    (*blob_size_handle) = 0 ;
+
+    // finish any pending work.  A matrix with 32-bit integers or a packed
+    // bitmap has no pending work, and is serialized as-is.
+    if (GB_ANY_PENDING_WORK (A))
+    {
+        GB_OK (GB_Matrix_wait (A, Context)) ;
+    }
+    ASSERT (!GB_ANY_PENDING_WORK (A)) ;
+
+    //--------------------------------------------------------------------------
+    // determine the size of each section
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    bool compress = (compression != GxB_COMPRESSION_NONE) ;
+    int sparsity = GB_sparsity (A) ;
+    bool is_hyper_or_sparse =
+        (sparsity == GxB_HYPERSPARSE || sparsity == GxB_SPARSE) ;
+    int64_t anz = GB_NNZ (A) ;
+    int64_t anz_held = GB_NNZ_HELD (A) ;
+
+    // # of integers in A->p, A->h, and A->i
+    int64_t np = is_hyper_or_sparse ? (A->nvec + 1) : 0 ;
+    int64_t nh = (sparsity == GxB_HYPERSPARSE) ? A->nvec : 0 ;
+    int64_t ni = is_hyper_or_sparse ? anz : 0 ;
+    int64_t np_blocks = GB_ICEIL (np, GB_BLOB_BLOCKSIZE) ;
+    int64_t nh_blocks = GB_ICEIL (nh, GB_BLOB_BLOCKSIZE) ;
+    int64_t ni_blocks = GB_ICEIL (ni, GB_BLOB_BLOCKSIZE) ;
+    int np_threads = GB_nthreads (np, chunk, nthreads_max) ;
+    int nh_threads = GB_nthreads (nh, chunk, nthreads_max) ;
+    int ni_threads = GB_nthreads (ni, chunk, nthreads_max) ;
+
+    int64_t Ap_len, Ah_len, Ai_len ;
+    if (compress)
+    {
+        Bp = GB_MALLOC_POOL (np_blocks, int64_t) ;
+        Bh = GB_MALLOC_POOL (nh_blocks, int64_t) ;
+        Bi = GB_MALLOC_POOL (ni_blocks, int64_t) ;
+        if (Bp == NULL || Bh == NULL || Bi == NULL)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        Ap_len = GB_serialize_ints_size (Bp, A->p, A->p_is_32, np, np_blocks,
+            np_threads) ;
+        Ah_len = GB_serialize_ints_size (Bh, A->h, A->h_is_32, nh, nh_blocks,
+            nh_threads) ;
+        Ai_len = GB_serialize_ints_size (Bi, A->i, A->i_is_32, ni, ni_blocks,
+            ni_threads) ;
+    }
+    else
+    {
+        Ap_len = np * (A->p_is_32 ? sizeof (int32_t) : sizeof (int64_t)) ;
+        Ah_len = nh * (A->h_is_32 ? sizeof (int32_t) : sizeof (int64_t)) ;
+        Ai_len = ni * (A->i_is_32 ? sizeof (int32_t) : sizeof (int64_t)) ;
+    }
+
+    int64_t Ab_len = 0 ;
+    if (sparsity == GxB_BITMAP)
+    {
+        Ab_len = A->b_is_packed ?
+            (GB_BITMAP_NWORDS (anz_held) * sizeof (uint64_t)) : anz_held ;
+    }
+
+    int64_t Ax_len = 0 ;
+    if (A->x != NULL)
+    {
+        Ax_len = A->type->size * (A->iso ? 1 : anz_held) ;
+    }
+
+    size_t blob_size = sizeof (GB_blob_header)
+        + GB_BLOB_PAD (Ap_len, 8) + GB_BLOB_PAD (Ah_len, 8)
+        + GB_BLOB_PAD (Ab_len, 8) + GB_BLOB_PAD (Ai_len, 8)
+        + GB_BLOB_PAD (Ax_len, 8) ;
+
+    //--------------------------------------------------------------------------
+    // allocate the blob
+    //--------------------------------------------------------------------------
+
+    blob = GB_MALLOC (blob_size, GB_void) ;
+    if (blob == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // write the header
+    //--------------------------------------------------------------------------
+
+    GB_blob_header header ;
+    GB_serialize_header (&header, A, blob_size, Ap_len, Ah_len, Ab_len,
+        Ai_len, Ax_len,
+        compress ? GxB_COMPRESSION_VARINT : GxB_COMPRESSION_NONE, 0) ;
+    memcpy (blob, &header, sizeof (GB_blob_header)) ;
+
+    //--------------------------------------------------------------------------
+    // write each section
+    //--------------------------------------------------------------------------
+
+    size_t s = sizeof (GB_blob_header) ;
+
+    #define GB_WRITE_INTS(X,X_is_32,B,len,n,nblocks,nthreads)               \
+    {                                                                       \
+        if (compress)                                                       \
+        {                                                                   \
+            memcpy (blob + s, B, nblocks * sizeof (int64_t)) ;              \
+            GB_serialize_ints (blob + s + nblocks * sizeof (int64_t), B,    \
+                X, X_is_32, n, nblocks, nthreads) ;                         \
+        }                                                                   \
+        else if (len > 0)                                                   \
+        {                                                                   \
+            GB_memcpy (blob + s, X, len, nthreads_max) ;                    \
+        }                                                                   \
+        memset (blob + s + len, 0, GB_BLOB_PAD (len, 8) - len) ;            \
+        s += GB_BLOB_PAD (len, 8) ;                                         \
+    }
+
+    GB_WRITE_INTS (A->p, A->p_is_32, Bp, Ap_len, np, np_blocks, np_threads) ;
+    GB_WRITE_INTS (A->h, A->h_is_32, Bh, Ah_len, nh, nh_blocks, nh_threads) ;
+
+    if (Ab_len > 0)
+    {
+        GB_memcpy (blob + s, A->b, Ab_len, nthreads_max) ;
+    }
+    memset (blob + s + Ab_len, 0, GB_BLOB_PAD (Ab_len, 8) - Ab_len) ;
+    s += GB_BLOB_PAD (Ab_len, 8) ;
+
+    GB_WRITE_INTS (A->i, A->i_is_32, Bi, Ai_len, ni, ni_blocks, ni_threads) ;
+
+    if (Ax_len > 0)
+    {
+        GB_memcpy (blob + s, A->x, Ax_len, nthreads_max) ;
+    }
+    memset (blob + s + Ax_len, 0, GB_BLOB_PAD (Ax_len, 8) - Ax_len) ;
+    s += GB_BLOB_PAD (Ax_len, 8) ;
+
+    ASSERT (s == blob_size) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORK ;
+    (*blob_handle) = blob ;
+    (*blob_size_handle) = blob_size ;
+    return (GrB_SUCCESS) ;
+}
+
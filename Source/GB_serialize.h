@@ -0,0 +1,168 @@
+//------------------------------------------------------------------------------
+// GB_serialize.h: definitions for GxB_Matrix_serialize and deserialize
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A serialized matrix (a "blob") is a single contiguous block of memory that
+// holds a GB_blob_header followed by the content of A->p, A->h, A->b, A->i,
+// and A->x, in that order.  Each of the 5 sections is present only if the
+// matrix has that component.  A->b and A->x are held exactly as they appear
+// in the matrix, including a packed bitmap (A->b_is_packed) and a single
+// value for an iso matrix.  A->p, A->h, and A->i are held in one of two ways,
+// as selected by the GxB_COMPRESSION descriptor:
+
+// GxB_COMPRESSION_NONE: the array is held exactly as it appears in the
+// matrix, as an int32_t or int64_t array.
+
+// GxB_COMPRESSION_VARINT (the default): the array is split into blocks of
+// GB_BLOB_BLOCKSIZE integers.  Within each block, the difference between
+// each integer and the one before it is held as a zigzag-encoded variable
+// length integer (7 bits per byte, with the high bit of each byte set if more
+// bytes follow).  The section starts with an int64_t array of size nblocks,
+// where Bend [b] is the position just past block b in the bytes that follow.
+// Each block is compressed and decompressed independently, in parallel.
+
+// Each section starts on an 8-byte boundary, padded with zeros.  A file
+// written by GxB_Matrix_mmap_write has the same layout, with no compression,
+// but with the header and each section padded to a multiple of
+// GB_MMAP_ALIGN bytes instead, so that each array of the matrix can be used
+// directly from a mapping of the file.
+
+// The blob is held in the byte order of the machine that created it; it is a
+// checkpoint format, not an archival one.
+
+#ifndef GB_SERIALIZE_H
+#define GB_SERIALIZE_H
+#include "GB.h"
+
+#define GB_BLOB_MAGIC 0x31626F6C42427247   // "GrBBlob1"
+#define GB_BLOB_BLOCKSIZE (64*1024)     // # of integers in each block
+
+// zigzag encoding of a signed difference, and its inverse
+#define GB_ZIGZAG(d) ((((uint64_t) (d)) << 1) ^ ((uint64_t) ((d) >> 63)))
+#define GB_UNZIGZAG(z) ((int64_t) (((z) >> 1) ^ (-((z) & 1))))
+
+// size of a section of the blob, padded to a multiple of align bytes
+#define GB_BLOB_PAD(len,align) ((align) * GB_ICEIL (len, align))
+
+// get X [k] from an int32_t or int64_t array
+#define GB_GETX(X,X_is_32,k) \
+    ((X_is_32) ? ((int64_t) ((int32_t *) (X)) [k]) : ((int64_t *) (X)) [k])
+
+typedef struct
+{
+    uint64_t magic ;            // GB_BLOB_MAGIC
+    int64_t blob_size ;         // size of the entire blob, in bytes
+    int64_t typesize ;          // A->type->size
+    int64_t vlen ;              // A->vlen
+    int64_t vdim ;              // A->vdim
+    int64_t nvec ;              // A->nvec
+    int64_t nvals ;             // nvals(A)
+    int64_t blocksize ;         // # of integers in each compressed block
+    int64_t Ap_len ;            // size of each section of the blob, in bytes
+    int64_t Ah_len ;
+    int64_t Ab_len ;
+    int64_t Ai_len ;
+    int64_t Ax_len ;
+    float hyper_switch ;        // A->hyper_switch
+    float bitmap_switch ;       // A->bitmap_switch
+    int32_t typecode ;          // A->type->code
+    int32_t sparsity ;          // hypersparse, sparse, bitmap, or full
+    int32_t sparsity_control ;  // A->sparsity
+    int32_t index32_control ;   // A->index32_control
+    int32_t bitmap_pack_control ;   // A->bitmap_pack_control
+    int32_t compression ;       // GxB_COMPRESSION_NONE or _VARINT
+    int8_t is_csc ;             // A->is_csc
+    int8_t iso ;                // A->iso
+    int8_t p_is_32 ;            // A->p_is_32
+    int8_t h_is_32 ;            // A->h_is_32
+    int8_t i_is_32 ;            // A->i_is_32
+    int8_t b_is_packed ;        // A->b_is_packed
+    int8_t align_log2 ;         // log2 of the alignment of each section,
+                                // or zero for the default of 8 bytes
+    int8_t unused ;             // pad the header to a multiple of 8 bytes
+}
+GB_blob_header ;
+
+GrB_Info GB_serialize           // serialize a matrix into a blob
+(
+    // output:
+    GB_void **blob_handle,      // the blob, allocated on output
+    size_t *blob_size_handle,   // size of the blob
+    // input:
+    GrB_Matrix A,               // matrix to serialize
+    int compression,            // GxB_COMPRESSION_NONE or _VARINT
+    GB_Context Context
+) ;
+
+GrB_Info GB_deserialize         // deserialize a matrix from a blob
+(
+    // output:
+    GrB_Matrix *Chandle,        // output matrix created from the blob
+    // input:
+    GrB_Type ctype,             // type of C; may be NULL for built-in types
+    const GB_void *blob,        // serialized matrix
+    size_t blob_size,           // size of the blob
+    bool shallow,               // if true, C is a shallow view of the blob
+    GB_Context Context
+) ;
+
+void GB_serialize_header        // construct the header of a blob
+(
+    // output:
+    GB_blob_header *header,     // the header
+    // input:
+    GrB_Matrix A,               // matrix being serialized
+    size_t blob_size,           // size of the entire blob
+    int64_t Ap_len,             // size of each section, in bytes
+    int64_t Ah_len,
+    int64_t Ab_len,
+    int64_t Ai_len,
+    int64_t Ax_len,
+    int compression,            // GxB_COMPRESSION_NONE or _VARINT
+    int align_log2              // alignment of each section, 0 for 8 bytes
+) ;
+
+int64_t GB_serialize_ints_size  // return size of a compressed integer array
+(
+    // output:
+    int64_t *GB_RESTRICT Bend,  // size nblocks, cumulative size of each block
+    // input:
+    const void *X,              // integer array to compress, of size n
+    bool X_is_32,               // if true, X is int32_t, else int64_t
+    int64_t n,                  // size of X
+    int64_t nblocks,            // # of blocks of X
+    int nthreads                // # of threads to use
+) ;
+
+void GB_serialize_ints          // compress an integer array
+(
+    // output:
+    GB_void *GB_RESTRICT S,     // compressed data, of size Bend [nblocks-1]
+    // input:
+    const int64_t *GB_RESTRICT Bend,   // from GB_serialize_ints_size
+    const void *X,              // integer array to compress, of size n
+    bool X_is_32,               // if true, X is int32_t, else int64_t
+    int64_t n,                  // size of X
+    int64_t nblocks,            // # of blocks of X
+    int nthreads                // # of threads to use
+) ;
+
+bool GB_deserialize_ints        // uncompress an integer array
+(
+    // output:
+    void *X,                    // integer array, of size n
+    // input:
+    bool X_is_32,               // if true, X is int32_t, else int64_t
+    int64_t n,                  // size of X
+    const GB_void *GB_RESTRICT S,   // the compressed section of the blob
+    int64_t S_len,              // size of the section, in bytes
+    int nthreads                // # of threads to use
+) ;
+
+#endif
+
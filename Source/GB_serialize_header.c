@@ -0,0 +1,63 @@
+//------------------------------------------------------------------------------
+// GB_serialize_header: construct the header of a blob
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Constructs the header of a blob for GB_serialize, or of a file for
+// GB_mmap_write, given the size of each section.  A has no pending work.
+
+#include "GB_serialize.h"
+
+void GB_serialize_header        // construct the header of a blob
+(
+    // output:
+    GB_blob_header *header,     // the header
+    // input:
+    GrB_Matrix A,               // matrix being serialized
+    size_t blob_size,           // size of the entire blob
+    int64_t Ap_len,             // size of each section, in bytes
+    int64_t Ah_len,
+    int64_t Ab_len,
+    int64_t Ai_len,
+    int64_t Ax_len,
+    int compression,            // GxB_COMPRESSION_NONE or _VARINT
+    int align_log2              // alignment of each section, 0 for 8 bytes
+)
+{
+
+    ASSERT (!GB_ANY_PENDING_WORK (A)) ;
+    memset (header, 0, sizeof (GB_blob_header)) ;
+    header->magic = GB_BLOB_MAGIC ;
+    header->blob_size = blob_size ;
+    header->typesize = A->type->size ;
+    header->vlen = A->vlen ;
+    header->vdim = A->vdim ;
+    header->nvec = A->nvec ;
+    header->nvals = GB_NNZ (A) ;
+    header->blocksize = GB_BLOB_BLOCKSIZE ;
+    header->Ap_len = Ap_len ;
+    header->Ah_len = Ah_len ;
+    header->Ab_len = Ab_len ;
+    header->Ai_len = Ai_len ;
+    header->Ax_len = Ax_len ;
+    header->hyper_switch = A->hyper_switch ;
+    header->bitmap_switch = A->bitmap_switch ;
+    header->typecode = A->type->code ;
+    header->sparsity = GB_sparsity (A) ;
+    header->sparsity_control = A->sparsity ;
+    header->index32_control = A->index32_control ;
+    header->bitmap_pack_control = A->bitmap_pack_control ;
+    header->compression = compression ;
+    header->is_csc = A->is_csc ;
+    header->iso = A->iso ;
+    header->p_is_32 = A->p_is_32 ;
+    header->h_is_32 = A->h_is_32 ;
+    header->i_is_32 = A->i_is_32 ;
+    header->b_is_packed = A->b_is_packed ;
+    header->align_log2 = align_log2 ;
+}
+
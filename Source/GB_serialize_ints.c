@@ -0,0 +1,55 @@
+//------------------------------------------------------------------------------
+// GB_serialize_ints: compress an integer array
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The second phase of compressing A->p, A->h, or A->i for
+// GxB_Matrix_serialize (see GB_serialize.h).  Bend has been computed by
+// GB_serialize_ints_size, so each block of X is written to its place in S
+// independently, in parallel.
+
+#include "GB_serialize.h"
+
+void GB_serialize_ints          // compress an integer array
+(
+    // output:
+    GB_void *GB_RESTRICT S,     // compressed data, of size Bend [nblocks-1]
+    // input:
+    const int64_t *GB_RESTRICT Bend,   // from GB_serialize_ints_size
+    const void *X,              // integer array to compress, of size n
+    bool X_is_32,               // if true, X is int32_t, else int64_t
+    int64_t n,                  // size of X
+    int64_t nblocks,            // # of blocks of X
+    int nthreads                // # of threads to use
+)
+{
+
+    int64_t b ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (b = 0 ; b < nblocks ; b++)
+    {
+        int64_t kstart = b * GB_BLOB_BLOCKSIZE ;
+        int64_t kend = GB_IMIN (kstart + GB_BLOB_BLOCKSIZE, n) ;
+        int64_t s = (b == 0) ? 0 : Bend [b-1] ;
+        int64_t xlast = 0 ;
+        for (int64_t k = kstart ; k < kend ; k++)
+        {
+            int64_t x = GB_GETX (X, X_is_32, k) ;
+            uint64_t z = GB_ZIGZAG (x - xlast) ;
+            xlast = x ;
+            // write z, 7 bits at a time, least significant bits first
+            while (z >= 0x80)
+            {
+                S [s++] = (GB_void) ((z & 0x7F) | 0x80) ;
+                z >>= 7 ;
+            }
+            S [s++] = (GB_void) z ;
+        }
+        ASSERT (s == Bend [b]) ;
+    }
+}
+
@@ -0,0 +1,70 @@
+//------------------------------------------------------------------------------
+// GB_serialize_ints_size: determine the size of a compressed integer array
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The first phase of compressing A->p, A->h, or A->i for GxB_Matrix_serialize
+// (see GB_serialize.h).  The # of bytes required for each block of X is
+// computed, in parallel, and Bend is then replaced with its cumulative sum.
+// The size of the entire section of the blob is returned, including Bend
+// itself.  GB_serialize_ints does the second phase.
+
+#include "GB_serialize.h"
+
+int64_t GB_serialize_ints_size  // return size of a compressed integer array
+(
+    // output:
+    int64_t *GB_RESTRICT Bend,  // size nblocks, cumulative size of each block
+    // input:
+    const void *X,              // integer array to compress, of size n
+    bool X_is_32,               // if true, X is int32_t, else int64_t
+    int64_t n,                  // size of X
+    int64_t nblocks,            // # of blocks of X
+    int nthreads                // # of threads to use
+)
+{
+
+    //--------------------------------------------------------------------------
+    // count the bytes in each block
+    //--------------------------------------------------------------------------
+
+    int64_t b ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (b = 0 ; b < nblocks ; b++)
+    {
+        int64_t kstart = b * GB_BLOB_BLOCKSIZE ;
+        int64_t kend = GB_IMIN (kstart + GB_BLOB_BLOCKSIZE, n) ;
+        int64_t xlast = 0, len = 0 ;
+        for (int64_t k = kstart ; k < kend ; k++)
+        {
+            int64_t x = GB_GETX (X, X_is_32, k) ;
+            uint64_t z = GB_ZIGZAG (x - xlast) ;
+            xlast = x ;
+            // z requires one byte for each 7 bits
+            len++ ;
+            while (z >= 0x80)
+            {
+                z >>= 7 ;
+                len++ ;
+            }
+        }
+        Bend [b] = len ;
+    }
+
+    //--------------------------------------------------------------------------
+    // cumulative sum of the block sizes
+    //--------------------------------------------------------------------------
+
+    int64_t s = 0 ;
+    for (b = 0 ; b < nblocks ; b++)
+    {
+        s += Bend [b] ;
+        Bend [b] = s ;
+    }
+    return (nblocks * sizeof (int64_t) + s) ;
+}
+
@@ -25,7 +25,10 @@
 
 // Compare this function with GrB_*_extractElement_*
 
+// If C is iso, it is expanded first.
+
 #include "GB_Pending.h"
+#include "GB_iso.h"
 
 #define GB_FREE_ALL ;
 
@@ -101,6 +104,13 @@ GrB_Info GB_setElement              // set a single entry, C(row,col) = scalar
         ASSERT (!GB_ZOMBIES (C)) ;
     }
 
+    // C is modified below, so it cannot remain shallow or iso, keep 32-bit
+    // integers, or keep a packed bitmap
+    GB_OK (GB_unshallow (C, Context)) ;
+    GB_OK (GB_iso_expand (C, Context)) ;
+    GB_OK (GB_convert_int32_to_int64 (C, Context)) ;
+    GB_OK (GB_convert_packed_to_bitmap (C, Context)) ;
+
     // zombies and pending tuples are still OK, but C is no longer jumbled
     ASSERT (!GB_JUMBLED (C)) ;
     ASSERT (GB_PENDING_OK (C)) ;
@@ -195,11 +205,13 @@ GrB_Info GB_setElement              // set a single entry, C(row,col) = scalar
             // bring the zombie back to life
             C->i [pleft] = i ;
             C->nzombies-- ;
+            GB_PATTERN_CHANGED (C) ;
         }
         else if (C_is_bitmap)
         { 
             // set the entry in the C bitmap
             int8_t cb = C->b [pleft] ;
+            if (cb == 0) GB_PATTERN_CHANGED (C) ;
             C->nvals += (cb == 0) ;
             C->b [pleft] = 1 ;
         }
@@ -216,6 +228,8 @@ GrB_Info GB_setElement              // set a single entry, C(row,col) = scalar
 
         // action: ( insert )
 
+        GB_PATTERN_CHANGED (C) ;
+
         // No typecasting can be done.  The new pending tuple must either be
         // the first pending tuple, or its type must match the prior pending
         // tuples.  See GB_subassign_methods.h for a complete description.
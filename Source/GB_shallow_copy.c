@@ -68,10 +68,15 @@ GrB_Info GB_shallow_copy    // create a purely shallow matrix
     C->p_shallow = (A->p != NULL) ;     // C->p not freed when freeing C
     C->h_shallow = (A->h != NULL) ;     // C->h not freed when freeing C
     C->p = A->p ;                       // C->p is of size A->plen + 1
+    C->p_is_32 = A->p_is_32 ;
+    C->h_is_32 = A->h_is_32 ;
     C->h = A->h ;                       // C->h is of size A->plen
     C->plen = A->plen ;                 // C and A have the same hyperlist size
     C->nvec = A->nvec ;
     C->nvec_nonempty = A->nvec_nonempty ;
+    C->mmap_base = A->mmap_base ;       // C refers to any file mapping of A
+    C->mmap_size = A->mmap_size ;
+    C->mmap_shallow = (A->mmap_base != NULL) ;
     C->magic = GB_MAGIC ;
 
     //--------------------------------------------------------------------------
@@ -99,9 +104,11 @@ GrB_Info GB_shallow_copy    // create a purely shallow matrix
 
     C->b = A->b ;                   // of size A->nzmax
     C->b_shallow = (A->b != NULL) ; // C->b will not be freed when freeing C
+    C->b_is_packed = A->b_is_packed ;
     C->nvals = A->nvals ;
 
     C->i = A->i ;                   // of size A->nzmax
+    C->i_is_32 = A->i_is_32 ;
     C->i_shallow = (A->i != NULL) ; // C->i will not be freed when freeing C
 
     //--------------------------------------------------------------------------
@@ -111,6 +118,7 @@ GrB_Info GB_shallow_copy    // create a purely shallow matrix
     C->nzmax = A->nzmax ;
     C->x = A->x ;
     C->x_shallow = (A->x != NULL) ; // C->x will not be freed when freeing C
+    C->iso = A->iso ;               // C->x has size 1 if A is iso
     ASSERT_MATRIX_OK (C, "C = pure shallow (A)", GB0) ;
     (*Chandle) = C ;
     return (GrB_SUCCESS) ;
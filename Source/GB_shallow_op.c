@@ -18,6 +18,8 @@
 // The values are typically not a shallow copy, unless no typecasting is needed
 // and the operator is an identity operator.
 
+// If A is iso and the operator is not positional, then C is iso as well.
+
 // The pattern is always a shallow copy.  No errors are checked except for
 // out-of-memory conditions.  This function is not user-callable.  Shallow
 // matrices are never passed back to the user.
@@ -100,6 +102,8 @@ GrB_Info GB_shallow_op      // create shallow matrix and apply operator
     C->p_shallow = (A->p != NULL) ;     // C->p not freed when freeing C
     C->h_shallow = (A->h != NULL) ;     // C->h not freed when freeing C
     C->p = A->p ;                       // C->p is of size A->plen + 1
+    C->p_is_32 = A->p_is_32 ;
+    C->h_is_32 = A->h_is_32 ;
     C->h = A->h ;                       // C->h is of size A->plen
     C->plen = A->plen ;                 // C and A have the same hyperlist sizes
     C->nvec = A->nvec ;
@@ -131,10 +135,12 @@ GrB_Info GB_shallow_op      // create shallow matrix and apply operator
     //--------------------------------------------------------------------------
 
     C->i = A->i ;               // of size A->nzmax
+    C->i_is_32 = A->i_is_32 ;
     C->i_shallow = (A->i != NULL) ; // C->i will not be freed when freeing C
 
     C->b = A->b ;               // of size A->nzmax
     C->b_shallow = (A->b != NULL) ;  // C->b will not be freed when freeing C
+    C->b_is_packed = A->b_is_packed ;
 
     //--------------------------------------------------------------------------
     // make a shallow copy of the values, if possible
@@ -157,6 +163,7 @@ GrB_Info GB_shallow_op      // create shallow matrix and apply operator
         C->nzmax = A->nzmax ;
         C->x = A->x ;
         C->x_shallow = true ;       // C->x will not be freed when freeing C
+        C->iso = A->iso ;
         ASSERT_MATRIX_OK (C, "C = pure shallow (A)", GB0) ;
         (*Chandle) = C ;
         return (GrB_SUCCESS) ;
@@ -167,8 +174,10 @@ GrB_Info GB_shallow_op      // create shallow matrix and apply operator
     //--------------------------------------------------------------------------
 
     // allocate new space for the numerical values of C
+    C->iso = A->iso && !op_is_positional ;
     C->nzmax = GB_IMAX (anz, 1) ;
-    C->x = GB_MALLOC (C->nzmax * C->type->size, GB_void) ;
+    C->x = GB_MALLOC ((C->iso ? 1 : C->nzmax) * C->type->size, GB_void) ;
+    C->x_size = (C->iso ? 1 : C->nzmax) * C->type->size ;
     C->x_shallow = false ;          // free C->x when freeing C
     if (C->x == NULL)
     { 
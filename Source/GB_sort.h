@@ -8,9 +8,9 @@
 //------------------------------------------------------------------------------
 
 // All of the GB_qsort_* functions are single-threaded, by design.  Both
-// GB_msort_* functions are parallel.  None of these sorting methods are
-// guaranteed to be stable, but they are always used in GraphBLAS with unique
-// keys.
+// GB_msort_* functions and GB_rsort are parallel.  None of these sorting
+// methods except GB_rsort are guaranteed to be stable, but they are always
+// used in GraphBLAS with unique keys.
 
 #ifndef GB_SORT_H
 #define GB_SORT_H
@@ -111,6 +111,74 @@ GrB_Info GB_msort_3b    // sort array A of size 3-by-n, using 3 keys (A [0:2][])
     int nthreads                // # of threads to use
 ) ;
 
+//------------------------------------------------------------------------------
+// GB_rsort: radix sort for GB_builder
+//------------------------------------------------------------------------------
+
+// GB_rsort sorts the tuples for GB_builder by packing each (j,i) pair into a
+// single key, and sorting the keys with a parallel radix sort, in O(e*b/d)
+// time for e tuples, where b is the # of bits in the largest key and d is the
+// # of bits in each digit.  It is faster than GB_msort_3b unless the keys are
+// wide relative to log2(e) (see GB_rsort_select).  Unlike the other methods,
+// GB_rsort is stable.
+
+#define GB_RSORT_DIGIT 11           // max # of bits in each digit
+#define GB_RSORT_MIN 1024           // min # of tuples for GB_rsort
+#define GB_RSORT_CHUNK (16 * 1024)  // min # of tuples for each thread
+
+GB_PUBLIC   // accessed by the MATLAB tests in GraphBLAS/Test only
+GrB_Info GB_rsort       // radix sort (J,I,K) or (I,K), using (J,I) as the key
+(
+    int64_t *J,                 // size n array, or NULL if vdim <= 1
+    int64_t *I,                 // size n array
+    int64_t *GB_RESTRICT K,     // size n array, output only
+    const int64_t n,
+    const int64_t vlen,         // 0 <= I [p] < vlen must hold
+    int nthreads                // # of threads to use
+) ;
+
+// GB_rsort_nbits: return the # of bits in the integer x >= 0
+static inline int GB_rsort_nbits (int64_t x)
+{
+    int nbits = 0 ;
+    for ( ; x > 0 ; x >>= 1)
+    { 
+        nbits++ ;
+    }
+    return (nbits) ;
+}
+
+// GB_rsort_select: true if GB_builder should use GB_rsort to sort n tuples
+// (j,i), with 0 <= i < vlen and 0 <= j < vdim, rather than GB_msort_3b (or
+// GB_msort_2b if vdim <= 1)
+static inline bool GB_rsort_select
+(
+    const int64_t n,
+    const int64_t vlen,
+    const int64_t vdim
+)
+{
+    int nbits = GB_rsort_nbits (vlen - 1) + GB_rsort_nbits (vdim - 1) ;
+    int method = GB_Global_build_sort_get ( ) ;
+    if (nbits > 63 || method == GxB_BUILD_SORT_MERGE)
+    { 
+        // the keys do not fit in 63 bits, or the mergesort is required
+        return (false) ;
+    }
+    else if (method == GxB_BUILD_SORT_RADIX)
+    { 
+        return (true) ;
+    }
+    else
+    { 
+        // Each pass of the radix sort costs about the same as two levels of
+        // the mergesort, which takes log2(n) levels.  The radix sort also has
+        // a fixed cost for each pass, for the counts of each digit.
+        int npasses = GB_ICEIL (nbits, GB_RSORT_DIGIT) ;
+        return (n >= GB_RSORT_MIN && 2 * npasses <= GB_rsort_nbits (n)) ;
+    }
+}
+
 //------------------------------------------------------------------------------
 // GB_lt_1: sorting comparator function, one key
 //------------------------------------------------------------------------------
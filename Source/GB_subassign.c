@@ -22,6 +22,7 @@
 
 #include "GB_subassign.h"
 #include "GB_bitmap_assign.h"
+#include "GB_iso.h"
 
 #define GB_FREE_ALL                 \
 {                                   \
@@ -32,7 +33,7 @@
     GB_FREE (J2) ;                  \
 }
 
-GrB_Info GB_subassign               // C(Rows,Cols)<M> += A or A'
+static GrB_Info GB_subassign_worker // C(Rows,Cols)<M> += A or A'
 (
     GrB_Matrix C_in,                // input/output matrix for results
     bool C_replace,                 // descriptor for C
@@ -136,3 +137,56 @@ GrB_Info GB_subassign               // C(Rows,Cols)<M> += A or A'
     return (GB_block (C_in, Context)) ;
 }
 
+//------------------------------------------------------------------------------
+// GB_subassign: expand any iso matrices and do the subassign
+//------------------------------------------------------------------------------
+
+// The subassign methods modify C in-place, and do not exploit iso
+// matrices.  If C is iso, it is expanded.  If M or A are iso, expanded copies
+// of them are used instead.
+
+#undef  GB_FREE_ALL
+#define GB_FREE_ALL             \
+{                               \
+    GB_Matrix_free (&M2) ;      \
+    GB_Matrix_free (&A2) ;      \
+}
+
+GrB_Info GB_subassign               // C(Rows,Cols)<M> += A or A'
+(
+    GrB_Matrix C_in,                // input/output matrix for results
+    bool C_replace,                 // descriptor for C
+    const GrB_Matrix M_in,          // optional mask for C(Rows,Cols)
+    const bool Mask_comp,           // true if mask is complemented
+    const bool Mask_struct,         // if true, use the only structure of M
+    const bool M_transpose,         // true if the mask should be transposed
+    const GrB_BinaryOp accum,       // optional accum for accum(C,T)
+    const GrB_Matrix A_in,          // input matrix
+    const bool A_transpose,         // true if A is transposed
+    const GrB_Index *Rows,          // row indices
+    const GrB_Index nRows_in,       // number of row indices
+    const GrB_Index *Cols,          // column indices
+    const GrB_Index nCols_in,       // number of column indices
+    const bool scalar_expansion,    // if true, expand scalar to A
+    const void *scalar,             // scalar to be expanded
+    const GB_Type_code scalar_code, // type code of scalar to expand
+    GB_Context Context
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix M2 = NULL, A2 = NULL ;
+    bool M_struct = Mask_struct ;
+    GB_OK (GB_unshallow (C_in, Context)) ;
+    GB_OK (GB_iso_expand (C_in, Context)) ;
+    GB_OK (GB_convert_int32_to_int64 (C_in, Context)) ;
+    GB_OK (GB_convert_packed_to_bitmap (C_in, Context)) ;
+    GB_OK (GB_iso_mask (&M2, &M_struct, M_in, Context)) ;
+    GB_OK (GB_iso_expand_copy (&A2, A_in, Context)) ;
+    info = GB_subassign_worker (C_in, C_replace, (M2 == NULL) ? M_in : M2,
+        Mask_comp, M_struct, M_transpose, accum, (A2 == NULL) ? A_in : A2,
+        A_transpose, Rows, nRows_in, Cols, nCols_in, scalar_expansion, scalar,
+        scalar_code, Context) ;
+    GB_FREE_ALL ;
+    return (info) ;
+}
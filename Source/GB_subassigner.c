@@ -95,6 +95,7 @@ GrB_Info GB_subassigner             // C(I,J)<#M> = A or accum (C (I,J), A)
 
     GrB_Info info ;
     ASSERT_MATRIX_OK (C, "C input for subassigner", GB0) ;
+    GB_PATTERN_CHANGED (C) ;
 
     //--------------------------------------------------------------------------
     // methods that rely on C and A being dense assume they are not jumbled
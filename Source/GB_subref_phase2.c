@@ -83,6 +83,7 @@ GrB_Info GB_subref_phase2   // C=A(I,J)
 
     // add Cp as the vector pointers for C, from GB_subref_phase1
     C->p = (int64_t *) Cp ;
+    C->p_size = (Cnvec+1) * sizeof (int64_t) ;
     (*p_Cp) = NULL ;
 
     // add Ch as the hypersparse list for C, from GB_subref_phase0
@@ -90,6 +91,7 @@ GrB_Info GB_subref_phase2   // C=A(I,J)
     { 
         // transplant Ch into C
         C->h = (int64_t *) Ch ;
+        C->h_size = Cnvec * sizeof (int64_t) ;
         (*p_Ch) = NULL ;
         C->nvec = Cnvec ;
     }
@@ -37,6 +37,8 @@ GrB_Info GB_transplant          // transplant one matrix into another
     ASSERT (GB_ZOMBIES_OK (A)) ;    // zombies in A transplanted into C
     ASSERT (GB_JUMBLED_OK (A)) ;    // if A is jumbled, then C is jumbled
     ASSERT (GB_PENDING_OK (A)) ;    // pending tuples n A transplanted into C
+    ASSERT (!GB_INDEX32 (A)) ;      // A is held in 64-bit integers
+    ASSERT (!GB_BITMAP_PACKED (A)) ;    // the bitmap of A is not packed
 
     // C is about to be cleared, any pending work is OK
     ASSERT (C != NULL) ;
@@ -136,6 +138,8 @@ GrB_Info GB_transplant          // transplant one matrix into another
             C->nvec = anvec ;
             C->p = GB_MALLOC (C->plen+1, int64_t) ;
             C->h = GB_MALLOC (C->plen  , int64_t) ;
+            C->p_size = (C->plen+1) * sizeof (int64_t) ;
+            C->h_size = C->plen * sizeof (int64_t) ;
             if (C->p == NULL || C->h == NULL)
             { 
                 // out of memory
@@ -154,6 +158,7 @@ GrB_Info GB_transplant          // transplant one matrix into another
             C->plen = avdim ;
             C->nvec = avdim ;
             C->p = GB_MALLOC (C->plen+1, int64_t) ;
+            C->p_size = (C->plen+1) * sizeof (int64_t) ;
             if (C->p == NULL)
             { 
                 // out of memory
@@ -183,6 +188,8 @@ GrB_Info GB_transplant          // transplant one matrix into another
         ASSERT (C->h == NULL) ;
         C->p = A->p ;
         C->h = A->h ;
+        C->p_size = A->p_size ;
+        C->h_size = A->h_size ;
         C->plen = A->plen ;
         C->nvec = anvec ;
     }
@@ -215,14 +222,18 @@ GrB_Info GB_transplant          // transplant one matrix into another
 
     // C->b is allocated only if A->b exists and is shallow.
     // C->i is not allocated if C is full or bitmap.
-    // C->x is allocated if A->x is shallow, or if the type is changing
+    // C->x is allocated if A->x is shallow, or if the type is changing.  If A
+    // is iso, C->x has size 1, and C->nzmax depends only on C->b and C->i.
 
     ASSERT (C->b == NULL && C->i == NULL && C->x == NULL) ;
+    bool A_iso = A->iso ;
     bool allocate_Cb = (A->b_shallow) && (C_is_bitmap) ;
     bool allocate_Ci = (A->i_shallow) && (!(C_is_full || C_is_bitmap)) ;
     bool allocate_Cx = (A->x_shallow || C->type != A->type) ;
-    C->nzmax = (allocate_Cb || allocate_Ci || allocate_Cx) ? anz : A->nzmax ;
+    C->nzmax = (allocate_Cb || allocate_Ci || (allocate_Cx && !A_iso)) ?
+        anz : A->nzmax ;
     C->nzmax = GB_IMAX (C->nzmax, 1) ;
+    C->iso = A_iso ;
 
     // allocate new components if needed
     bool ok = true ;
@@ -231,6 +242,7 @@ GrB_Info GB_transplant          // transplant one matrix into another
     { 
         // allocate new C->b component
         C->b = GB_MALLOC (C->nzmax, int8_t) ;
+        C->b_size = C->nzmax * sizeof (int8_t) ;
         ok = ok && (C->b != NULL) ;
     }
 
@@ -238,13 +250,15 @@ GrB_Info GB_transplant          // transplant one matrix into another
     { 
         // allocate new C->i component
         C->i = GB_MALLOC (C->nzmax, int64_t) ;
+        C->i_size = C->nzmax * sizeof (int64_t) ;
         ok = ok && (C->i != NULL) ;
     }
 
     if (allocate_Cx)
     { 
         // allocate new C->x component
-        C->x = GB_MALLOC (C->nzmax * C->type->size, GB_void) ;
+        C->x = GB_MALLOC ((A_iso ? 1 : C->nzmax) * C->type->size, GB_void) ;
+        C->x_size = (A_iso ? 1 : C->nzmax) * C->type->size ;
         ok = ok && (C->x != NULL) ;
     }
 
@@ -270,6 +284,9 @@ GrB_Info GB_transplant          // transplant one matrix into another
     ASSERT_TYPE_OK (C->type, "target C->type for values", GB0) ;
     ASSERT_TYPE_OK (A->type, "source A->type for values", GB0) ;
 
+    // if A is iso, only its single value is copied or typecasted
+    int64_t anx = (A_iso) ? 1 : anz ;
+
     if (C->type == A->type)
     {
         // types match
@@ -277,13 +294,14 @@ GrB_Info GB_transplant          // transplant one matrix into another
         { 
             // A is shallow so make a deep copy; no typecast needed
             // TODO handle the bitmap better for valgrind: do not use memcpy
-            GB_memcpy (C->x, A->x, anz * C->type->size, nthreads) ;
+            GB_memcpy (C->x, A->x, anx * C->type->size, nthreads) ;
             A->x = NULL ;
         }
         else
         { 
             // OK to move pointers instead
             C->x = A->x ;
+            C->x_size = A->x_size ;
             A->x = NULL ;
         }
     }
@@ -292,8 +310,8 @@ GrB_Info GB_transplant          // transplant one matrix into another
         // types differ, must typecast from A to C.
         GB_void *GB_RESTRICT Cx = (GB_void *) C->x ;
         GB_void *GB_RESTRICT Ax = (GB_void *) A->x ;
-        GB_cast_array (Cx, C->type->code,
-            Ax, A->type->code, A->b, A->type->size, anz, nthreads) ;
+        GB_cast_array (Cx, C->type->code, Ax, A->type->code,
+            (A_iso) ? NULL : A->b, A->type->size, anx, nthreads) ;
         if (!A->x_shallow)
         { 
             GB_FREE (A->x) ;
@@ -343,6 +361,7 @@ GrB_Info GB_transplant          // transplant one matrix into another
         //----------------------------------------------------------------------
 
         C->i = A->i ;
+        C->i_size = A->i_size ;
         A->i = NULL ;
         A->i_shallow = false ;
     }
@@ -387,6 +406,7 @@ GrB_Info GB_transplant          // transplant one matrix into another
         //----------------------------------------------------------------------
 
         C->b = A->b ;
+        C->b_size = A->b_size ;
         A->b = NULL ;
         A->b_shallow = false ;
     }
@@ -76,11 +76,21 @@
 }
 
 //------------------------------------------------------------------------------
-// GB_transpose
+// GB_transposer: C=A', C=(ctype)A', C=op(A'), or the pattern of C=A'
 //------------------------------------------------------------------------------
 
-GB_PUBLIC   // accessed by the MATLAB tests in GraphBLAS/Test only
-GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
+// If pattern_only is true, no operator may be present.  The pattern of C=A'
+// is computed, and C->x is allocated with the type ctype, but its values are
+// not computed and are left uninitialized.  This is used when the caller
+// will never access the values of C: a structural mask, or an input to a
+// multiply operator that does not depend on its value (FIRST, SECOND, PAIR,
+// or a positional operator).
+
+// If A is iso, only the pattern of C=A' is computed.  C is then iso, with the
+// single value (ctype) A->x [0] or op (A->x [0]), unless the operator is
+// positional.
+
+static GrB_Info GB_transposer
 (
     GrB_Matrix *Chandle,        // output matrix C, possibly modified in-place
     GrB_Type ctype,             // desired type of C; if NULL use A->type.
@@ -92,6 +102,7 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
         const GrB_BinaryOp op2_in,      // binary operator to apply
         const GxB_Scalar scalar,        // scalar to bind to binary operator
         bool binop_bind1st,             // if true, binop(x,A) else binop(A,y)
+    bool pattern_only,          // if true, do not compute the values of C
     GB_Context Context
 )
 {
@@ -101,7 +112,7 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
     //--------------------------------------------------------------------------
 
     GrB_Info info ;
-    GBURBLE ("(transpose) ") ;
+    GBURBLE (pattern_only ? "(pattern transpose) " : "(transpose) ") ;
     GrB_Matrix A, C ;
     bool in_place_C, in_place_A ;
 
@@ -171,6 +182,7 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
     ASSERT_UNARYOP_OK_OR_NULL (op1_in, "unop for GB_transpose", GB0) ;
     ASSERT_BINARYOP_OK_OR_NULL (op2_in, "binop for GB_transpose", GB0) ;
     ASSERT_SCALAR_OK_OR_NULL (scalar, "scalar for GB_transpose", GB0) ;
+    ASSERT (GB_IMPLIES (pattern_only, op1_in == NULL && op2_in == NULL)) ;
 
     // get the current sparsity control of A
     float A_hyper_switch = A->hyper_switch ;
@@ -211,6 +223,11 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
     bool Ax_shallow = A->x_shallow ;
     bool Ab_shallow = A->b_shallow ;
 
+    size_t Ah_size = A->h_size ;
+    size_t Ab_size = A->b_size ;
+    size_t Ai_size = A->i_size ;
+    size_t Ax_size = A->x_size ;
+
     int64_t anz = GB_NNZ (A) ;
     int64_t anvec = A->nvec ;
     int64_t anvals = A->nvals ;
@@ -295,6 +312,39 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
         op1 = (ctype == GrB_INT64) ? GxB_ONE_INT64 : GxB_ONE_INT32 ;
     }
 
+    //--------------------------------------------------------------------------
+    // check for an iso matrix A
+    //--------------------------------------------------------------------------
+
+    // If A is iso, the value of C is computed here, and just the pattern of
+    // C=A' is computed below.  C->x is replaced with the iso value when done.
+
+    const bool A_iso = A->iso ;
+    GB_void cvalue [GB_VLA(csize)] ;
+    if (A_iso)
+    {
+        if (op_is_positional)
+        { 
+            // the values of C are computed from the positions of its entries
+            ;
+        }
+        else if (op1 != NULL || op2 != NULL)
+        { 
+            // cvalue = op (A->x [0])
+            info = GB_apply_op (cvalue, op1, op2, scalar, binop_bind1st, A,
+                Context) ;
+            ASSERT (info == GrB_SUCCESS) ;
+        }
+        else
+        { 
+            // cvalue = (ctype) A->x [0]
+            GB_cast_array (cvalue, ccode, Ax, acode, NULL, asize, 1, 1) ;
+        }
+        op1 = NULL ;
+        op2 = NULL ;
+        pattern_only = true ;
+    }
+
     //--------------------------------------------------------------------------
     // C = A'
     //--------------------------------------------------------------------------
@@ -392,12 +442,15 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
             // no work to do.  Transposing does not change A->b or A->x
             T->b = Ab ;
             T->x = Ax ;
+            T->iso = A_iso ;
             T->nzmax = A->nzmax ;
             if (in_place)
             { 
                 // transplant A->b and A->x into T
                 T->b_shallow = Ab_shallow ;
                 T->x_shallow = Ax_shallow ;
+                T->b_size = Ab_size ;
+                T->x_size = Ax_size ;
                 Ab = NULL ;     // do not free prior Ab
                 Ax = NULL ;     // do not free prior Ax
                 A->b = NULL ;
@@ -413,7 +466,7 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
         else if (op1 == NULL && op2 == NULL)
         { 
             // do not apply an operator; optional typecast to C->type
-            GB_transpose_ix (T, A, NULL, NULL, 0, nthreads) ;
+            GB_transpose_ix (T, A, pattern_only, NULL, NULL, 0, nthreads) ;
         }
         else
         { 
@@ -540,15 +593,21 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
             ASSERT (!GB_OP_IS_POSITIONAL (op2)) ;
             ASSERT (info == GrB_SUCCESS) ;
             C->x = Cx ;
+            C->x_size = anz * ctype->size ;
             C->x_shallow = false ;
             // prior Ax will be freed
         }
         else if (ctype != atype)
         { 
-            // copy the values from A into C and cast from atype to ctype
+            // copy the values from A into C and cast from atype to ctype,
+            // unless only the pattern of C is needed
             C->x = Cx ;
+            C->x_size = anz * ctype->size ;
             C->x_shallow = false ;
-            GB_cast_array (Cx, ccode, Ax, acode, Ab, asize, anz, 1) ;
+            if (!pattern_only)
+            { 
+                GB_cast_array (Cx, ccode, Ax, acode, Ab, asize, anz, 1) ;
+            }
             // prior Ax will be freed
         }
         else // ctype == atype
@@ -556,6 +615,7 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
             // no type change; numerical values of C are a shallow copy of A.
             C->x = Ax ;
             C->x_shallow = (in_place) ? Ax_shallow : true ;
+            C->x_size = (in_place) ? Ax_size : 0 ;
             Ax = NULL ;  // do not free prior Ax
         }
 
@@ -563,6 +623,7 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
         // C is a hypersparse 1-by-avlen matrix
         C->h = Ai ;
         C->h_shallow = (in_place) ? Ai_shallow : true ;
+        C->h_size = (in_place) ? Ai_size : 0 ;
         Ai = NULL ;     // do not free prior Ai
         // C->p = 0:anz and C->i = zeros (1,anz), newly allocated
         C->plen = anz ;
@@ -570,6 +631,8 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
         C->nvec_nonempty = anz ;
         C->i = Ci ;
         C->p = Cp ;
+        C->i_size = anz * sizeof (int64_t) ;
+        C->p_size = (anz+1) * sizeof (int64_t) ;
         // fill the vector pointers C->p
         int nthreads = GB_nthreads (anz, chunk, nthreads_max) ;
         int64_t k ;
@@ -694,15 +757,21 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
             ASSERT (!GB_OP_IS_POSITIONAL (op2)) ;
             ASSERT (info == GrB_SUCCESS) ;
             C->x = Cx ;
+            C->x_size = anz * ctype->size ;
             C->x_shallow = false ;
             // prior Ax will be freed
         }
         else if (ctype != atype)
         { 
-            // copy the values from A into C and cast from atype to ctype
+            // copy the values from A into C and cast from atype to ctype,
+            // unless only the pattern of C is needed
             C->x = Cx ;
+            C->x_size = anz * ctype->size ;
             C->x_shallow = false ;
-            GB_cast_array (Cx, ccode, Ax, acode, Ab, asize, anz, 1) ;
+            if (!pattern_only)
+            { 
+                GB_cast_array (Cx, ccode, Ax, acode, Ab, asize, anz, 1) ;
+            }
             // prior Ax will be freed
         }
         else // ctype == atype
@@ -710,6 +779,7 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
             // no type change; numerical values of C are a shallow copy of A
             C->x = Ax ;
             C->x_shallow = (in_place) ? Ax_shallow : true ;
+            C->x_size = (in_place) ? Ax_size : 0 ;
             Ax = NULL ;  // do not free prior Ax
         }
 
@@ -726,6 +796,7 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
 
             C->i = Ah ;
             C->i_shallow = (in_place) ? Ah_shallow : true ;
+            C->i_size = (in_place) ? Ah_size : 0 ;
             ASSERT (anvec == anz) ;
             Ah = NULL ;     // do not free prior Ah
 
@@ -812,6 +883,7 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
             #endif
 
             C->i = Ci ;
+            C->i_size = anz * sizeof (int64_t) ;
             C->i_shallow = false ;
         }
 
@@ -824,6 +896,7 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
         ASSERT (C->nvec == 1) ;
         ASSERT (C->h == NULL) ;
         C->p = Cp ;
+        C->p_size = 2 * sizeof (int64_t) ;
         C->p_shallow = false ;
         C->nvec_nonempty = (anz == 0) ? 0 : 1 ;
         // fill the vector pointers C->p
@@ -984,7 +1057,13 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
             }
 
             // numerical values: apply the op, typecast, or make shallow copy
-            if (op1 != NULL || op2 != NULL)
+            if (pattern_only)
+            { 
+                // T->x is allocated by GB_builder but not computed
+                S = NULL ;
+                scode = ccode ;
+            }
+            else if (op1 != NULL || op2 != NULL)
             { 
                 // Swork = op (A)
                 info = GB_apply_op ( // op1 != identity of same types
@@ -1047,7 +1126,8 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
                 anz,        // size of iwork, jwork, and Swork
                 true,       // is_matrix: unused
                 NULL, NULL, // original I,J indices: not used here
-                S,          // array of values of type scode, not modified
+                S,          // array of values of type scode, not modified,
+                            // or NULL if only the pattern of T is computed
                 anz,        // number of tuples
                 NULL,       // no dup operator needed (input has no duplicates)
                 scode,      // type of S or Swork
@@ -1095,7 +1175,7 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
             // T is also typecasted to ctype, if not NULL
             GrB_Matrix T = NULL ;
             info = GB_transpose_bucket (&T, ctype, C_is_csc, A,
-                op1, op2, scalar, binop_bind1st,
+                op1, op2, scalar, binop_bind1st, pattern_only,
                 nworkspaces_bucket, nthreads_bucket, Context) ;
 
             // free prior content, if C=A' is being done in-place
@@ -1146,6 +1226,37 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
     C = (*Chandle) ;
     ASSERT (GB_JUMBLED_OK (C)) ;
 
+    //--------------------------------------------------------------------------
+    // finalize the values of C if A is iso
+    //--------------------------------------------------------------------------
+
+    if (A_iso)
+    {
+        // C->x has not been computed, and it may be a shallow copy of A->x.
+        // Replace it with the iso value of C, or with space for the positional
+        // operator to fill in below.
+        int64_t cnx = (op_is_positional) ? GB_IMAX (C->nzmax, 1) : 1 ;
+        GB_void *Cx_new = GB_MALLOC (cnx * csize, GB_void) ;
+        if (Cx_new == NULL)
+        { 
+            // out of memory
+            GB_FREE_C ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        if (!C->x_shallow)
+        { 
+            GB_FREE (C->x) ;
+        }
+        C->x = Cx_new ;
+        C->x_size = cnx * csize ;
+        C->x_shallow = false ;
+        C->iso = !op_is_positional ;
+        if (C->iso)
+        { 
+            memcpy (Cx_new, cvalue, csize) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // apply a positional operator, after transposing the matrix
     //--------------------------------------------------------------------------
@@ -1188,3 +1299,44 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
     return (GrB_SUCCESS) ;
 }
 
+//------------------------------------------------------------------------------
+// GB_transpose: C=A', C=(ctype)A' or C=op(A')
+//------------------------------------------------------------------------------
+
+GB_PUBLIC   // accessed by the MATLAB tests in GraphBLAS/Test only
+GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
+(
+    GrB_Matrix *Chandle,        // output matrix C, possibly modified in-place
+    GrB_Type ctype,             // desired type of C; if NULL use A->type.
+                                // ignored if op is present (cast to op->ztype)
+    const bool C_is_csc,        // desired CSR/CSC format of C
+    const GrB_Matrix A_in,      // input matrix
+        // no operator is applied if both op1 and op2 are NULL
+        const GrB_UnaryOp op1_in,       // unary operator to apply
+        const GrB_BinaryOp op2_in,      // binary operator to apply
+        const GxB_Scalar scalar,        // scalar to bind to binary operator
+        bool binop_bind1st,             // if true, binop(x,A) else binop(A,y)
+    GB_Context Context
+)
+{ 
+    return (GB_transposer (Chandle, ctype, C_is_csc, A_in, op1_in, op2_in,
+        scalar, binop_bind1st, false, Context)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_transpose_cast: C=(ctype)A', or just the pattern of C=A'
+//------------------------------------------------------------------------------
+
+GrB_Info GB_transpose_cast      // C=(ctype)A', or the pattern of C=A'
+(
+    GrB_Matrix *Chandle,        // output matrix C, possibly modified in-place
+    GrB_Type ctype,             // desired type of C; if NULL use A->type
+    const bool C_is_csc,        // desired CSR/CSC format of C
+    const GrB_Matrix A_in,      // input matrix
+    const bool pattern_only,    // if true, the values of C are not computed
+    GB_Context Context
+)
+{ 
+    return (GB_transposer (Chandle, ctype, C_is_csc, A_in, NULL, NULL, NULL,
+        false, pattern_only, Context)) ;
+}
@@ -36,6 +36,16 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
     GB_Context Context
 ) ;
 
+GrB_Info GB_transpose_cast      // C=(ctype)A', or the pattern of C=A'
+(
+    GrB_Matrix *Chandle,        // output matrix C, possibly modified in-place
+    GrB_Type ctype,             // desired type of C; if NULL use A->type
+    const bool C_is_csc,        // desired CSR/CSC format of C
+    const GrB_Matrix A_in,      // input matrix
+    const bool pattern_only,    // if true, the values of C are not computed
+    GB_Context Context
+) ;
+
 GrB_Info GB_transpose_bucket    // bucket transpose; typecast and apply op
 (
     GrB_Matrix *Chandle,        // output matrix (unallocated on input)
@@ -47,6 +57,7 @@ GrB_Info GB_transpose_bucket    // bucket transpose; typecast and apply op
         const GrB_BinaryOp op2,         // binary operator to apply
         const GxB_Scalar scalar,        // scalar to bind to binary operator
         bool binop_bind1st,             // if true, binop(x,A) else binop(A,y)
+    const bool pattern_only,    // if true, do not compute the values of C
     const int nworkspaces,      // # of workspaces to use
     const int nthreads,         // # of threads to use
     GB_Context Context
@@ -56,6 +67,7 @@ void GB_transpose_ix            // transpose the pattern and values of a matrix
 (
     GrB_Matrix C,                       // output matrix
     const GrB_Matrix A,                 // input matrix
+    const bool pattern_only,            // if true, do not compute C->x
     // for sparse case:
     int64_t *GB_RESTRICT *Workspaces,   // Workspaces, size nworkspaces
     const int64_t *GB_RESTRICT A_slice, // how A is sliced, size nthreads+1
@@ -19,6 +19,9 @@
 // defined by the caller and assigned to C->is_csc, but otherwise unused.
 // A->is_csc is ignored.
 
+// If pattern_only is true, no operator is applied, and the values of C are
+// allocated but not computed.
+
 // The input can be hypersparse or non-hypersparse.  The output C is always
 // non-hypersparse, and never shallow.
 
@@ -65,6 +68,7 @@ GrB_Info GB_transpose_bucket    // bucket transpose; typecast and apply op
         const GrB_BinaryOp op2,         // binary operator to apply
         const GxB_Scalar scalar,        // scalar to bind to binary operator
         bool binop_bind1st,             // if true, binop(x,A) else binop(A,y)
+    const bool pattern_only,    // if true, do not compute the values of C
     const int nworkspaces,      // # of workspaces to use
     const int nthreads,         // # of threads to use
     GB_Context Context
@@ -84,6 +88,7 @@ GrB_Info GB_transpose_bucket    // bucket transpose; typecast and apply op
     ASSERT (GB_JUMBLED_OK (A)) ;
 
     // if op1 and op2 are NULL, then no operator is applied
+    ASSERT (GB_IMPLIES (pattern_only, op1 == NULL && op2 == NULL)) ;
 
     // This method is only be used when A is sparse or hypersparse.
     // The full and bitmap cases are handled in GB_transpose.
@@ -304,11 +309,12 @@ GrB_Info GB_transpose_bucket    // bucket transpose; typecast and apply op
     // phase2: transpose A into C
     //==========================================================================
 
-    // transpose both the pattern and the values
+    // transpose both the pattern and the values (unless pattern_only)
     if (op1 == NULL && op2 == NULL)
     { 
         // do not apply an operator; optional typecast to C->type
-        GB_transpose_ix (C, A, Workspaces, A_slice, nworkspaces, nthreads) ;
+        GB_transpose_ix (C, A, pattern_only, Workspaces, A_slice, nworkspaces,
+            nthreads) ;
     }
     else
     { 
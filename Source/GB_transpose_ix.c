@@ -8,6 +8,8 @@
 //------------------------------------------------------------------------------
 
 // The values of A are typecasted to C->type, the type of the C matrix.
+// If pattern_only is true, only the pattern of C is constructed (C->i for the
+// sparse case, or C->b for the bitmap case).  C->x is not modified.
 
 // If A is sparse or hypersparse
 //      The pattern of C is constructed.  C is sparse.
@@ -34,6 +36,7 @@ void GB_transpose_ix            // transpose the pattern and values of a matrix
 (
     GrB_Matrix C,                       // output matrix
     const GrB_Matrix A,                 // input matrix
+    const bool pattern_only,            // if true, do not compute C->x
     // for sparse case:
     int64_t *GB_RESTRICT *Workspaces,   // Workspaces, size nworkspaces
     const int64_t *GB_RESTRICT A_slice, // how A is sliced, size nthreads+1
@@ -56,6 +59,19 @@ void GB_transpose_ix            // transpose the pattern and values of a matrix
     GB_Type_code code1 = ctype->code ;          // defines ztype
     GB_Type_code code2 = A->type->code ;        // defines atype
 
+    //--------------------------------------------------------------------------
+    // pattern-only worker: transpose the pattern but not the values
+    //--------------------------------------------------------------------------
+
+    if (pattern_only)
+    { 
+        #define GB_CAST_OP(pC,pA) ;
+        #define GB_ATYPE GB_void
+        #define GB_CTYPE GB_void
+        #include "GB_unop_transpose.c"
+        return ;
+    }
+
     //--------------------------------------------------------------------------
     // built-in worker: transpose and typecast
     //--------------------------------------------------------------------------
@@ -96,6 +112,7 @@ void GB_transpose_ix            // transpose the pattern and values of a matrix
     GB_cast_function cast_A_to_X = GB_cast_factory (code1, code2) ;
 
     // Cx [pC] = (ctype) Ax [pA]
+    #undef  GB_CAST_OP
     #define GB_CAST_OP(pC,pA)  \
         cast_A_to_X (Cx +((pC)*csize), Ax +((pA)*asize), asize) ;
 
@@ -77,8 +77,16 @@ GrB_Info GB_unjumble        // unjumble a matrix
     // sort the vectors
     //--------------------------------------------------------------------------
 
-    switch (asize)
+    // if A is iso, only its pattern is sorted
+    switch (A->iso ? 0 : asize)
     {
+        case 0 : 
+            // iso matrices: the values A->x are not permuted
+            #define GB_QSORT_WORKER \
+                GB_qsort_1a (Ai+pA_start, aknz) ;
+            #include "GB_unjumbled_template.c"
+            break ;
+
         case 1 : 
             // GrB_BOOL, GrB_UINT8, GrB_INT8, and user defined types of size 1
             #define GB_QSORT_WORKER \
@@ -0,0 +1,144 @@
+//------------------------------------------------------------------------------
+// GB_unshallow: make a private copy of any shallow component of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A matrix imported with the GxB_SHALLOW_IMPORT descriptor holds the arrays
+// of the user application as shallow components, which GraphBLAS must neither
+// modify nor free.  A method that is about to modify a matrix in-place calls
+// GB_unshallow first, which replaces each shallow component with a copy owned
+// by the matrix (copy-on-write).  Methods that only read A, or that construct
+// the result in a new matrix and transplant it into A, do not need to do this.
+// If the method fails, A is unchanged, except that some of its components may
+// have been copied.
+
+#include "GB.h"
+
+GrB_Info GB_unshallow           // copy all shallow components of A
+(
+    GrB_Matrix A,               // matrix to modify, in-place
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (A != NULL) ;
+    if (!GB_is_shallow (A))
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    GBURBLE ("(unshallow) ") ;
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+
+    //--------------------------------------------------------------------------
+    // determine the size of each component
+    //--------------------------------------------------------------------------
+
+    // Only the content of A is copied, not any unused space beyond it in the
+    // arrays of the user application.  A->p and A->h are allocated with
+    // space for A->plen vectors, and A->i and A->x for A->nzmax entries.
+
+    int64_t anz = GB_NNZ_HELD (A) ;
+    int64_t anvec = A->nvec ;
+    int64_t aplen = A->plen ;
+    int64_t anzmax = A->nzmax ;
+    size_t psize = A->p_is_32 ? sizeof (int32_t) : sizeof (int64_t) ;
+    size_t hsize = A->h_is_32 ? sizeof (int32_t) : sizeof (int64_t) ;
+    size_t isize = A->i_is_32 ? sizeof (int32_t) : sizeof (int64_t) ;
+    size_t asize = A->type->size ;
+    size_t bsize = A->b_is_packed ?
+        (GB_BITMAP_NWORDS (anz) * sizeof (uint64_t)) : anz ;
+
+    //--------------------------------------------------------------------------
+    // copy each shallow component
+    //--------------------------------------------------------------------------
+
+    if (A->p_shallow)
+    {
+        void *Ap = GB_MALLOC ((aplen+1) * psize, GB_void) ;
+        if (Ap == NULL)
+        {
+            // out of memory
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        GB_memcpy (Ap, A->p, (anvec+1) * psize, nthreads_max) ;
+        A->p = Ap ;
+        A->p_size = (aplen+1) * psize ;
+        A->p_shallow = false ;
+    }
+
+    if (A->h_shallow)
+    {
+        void *Ah = GB_MALLOC (GB_IMAX (aplen, 1) * hsize, GB_void) ;
+        if (Ah == NULL)
+        {
+            // out of memory
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        GB_memcpy (Ah, A->h, anvec * hsize, nthreads_max) ;
+        A->h = Ah ;
+        A->h_size = GB_IMAX (aplen, 1) * hsize ;
+        A->h_shallow = false ;
+    }
+
+    if (A->i_shallow)
+    {
+        void *Ai = GB_MALLOC (GB_IMAX (anzmax, 1) * isize, GB_void) ;
+        if (Ai == NULL)
+        {
+            // out of memory
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        GB_memcpy (Ai, A->i, anz * isize, nthreads_max) ;
+        A->i = Ai ;
+        A->i_size = GB_IMAX (anzmax, 1) * isize ;
+        A->i_shallow = false ;
+    }
+
+    if (A->b_shallow)
+    {
+        void *Ab = GB_MALLOC (GB_IMAX (bsize, 1), GB_void) ;
+        if (Ab == NULL)
+        {
+            // out of memory
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        GB_memcpy (Ab, A->b, bsize, nthreads_max) ;
+        A->b = Ab ;
+        A->b_size = GB_IMAX (bsize, 1) ;
+        A->b_shallow = false ;
+    }
+
+    if (A->x_shallow)
+    {
+        int64_t xnz = A->iso ? 1 : GB_IMAX (anzmax, 1) ;
+        int64_t xcopy = A->iso ? 1 : anz ;
+        void *Ax = GB_MALLOC (xnz * asize, GB_void) ;
+        if (Ax == NULL)
+        {
+            // out of memory
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        GB_memcpy (Ax, A->x, xcopy * asize, nthreads_max) ;
+        A->x = Ax ;
+        A->x_size = xnz * asize ;
+        A->x_shallow = false ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    ASSERT (!GB_is_shallow (A)) ;
+    ASSERT_MATRIX_OK (A, "A unshallow", GB0) ;
+    return (GrB_SUCCESS) ;
+}
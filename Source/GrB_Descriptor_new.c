@@ -45,6 +45,8 @@ GrB_Info GrB_Descriptor_new     // create a new descriptor
     desc->in0  = GxB_DEFAULT ;     // descriptor for the first input
     desc->in1  = GxB_DEFAULT ;     // descriptor for the second input
     desc->axb  = GxB_DEFAULT ;     // descriptor for selecting the C=A*B method
+    desc->import = GxB_DEFAULT ;   // descriptor for GxB_*_import
+    desc->compression = GxB_DEFAULT ;   // descriptor for GxB_Matrix_serialize
     desc->nthreads_max = GxB_DEFAULT ;  // max # of threads to use
     desc->chunk = GxB_DEFAULT ;         // chunk for auto-tuning of # threads
     // #include "GrB_Descriptor_new_mkl_template.c"
@@ -32,6 +32,7 @@ static inline bool GB_removeElement
 
     ASSERT (!GB_IS_FULL (C)) ;
     int64_t cvlen = C->vlen ;
+    GB_PATTERN_CHANGED (C) ;
 
     //--------------------------------------------------------------------------
     // remove C(i,j)
@@ -148,11 +149,15 @@ GrB_Info GrB_Matrix_removeElement
     // if C is jumbled, wait on the matrix first.  If full, convert to nonfull
     //--------------------------------------------------------------------------
 
-    if (C->jumbled || GB_IS_FULL (C))
+    // the wait also converts C back to 64-bit integers, and unpacks its
+    // bitmap, if needed.  A shallow C is first copied, since it is modified.
+    if (C->jumbled || GB_IS_FULL (C) || GB_INDEX32 (C) ||
+        GB_BITMAP_PACKED (C) || GB_is_shallow ((GrB_Matrix) C))
     {
         GrB_Info info ;
         GB_WHERE (C, GB_WHERE_STRING) ;
         GB_BURBLE_START ("GrB_Matrix_removeElement") ;
+        GB_OK (GB_unshallow (C, Context)) ;
         if (GB_IS_FULL (C))
         { 
             // convert C from full to sparse
@@ -160,7 +165,8 @@ GrB_Info GrB_Matrix_removeElement
         }
         else
         { 
-            // C is sparse or hypersparse, and jumbled
+            // C is sparse or hypersparse, and jumbled or 32-bit, or
+            // a packed bitmap
             GB_OK (GB_Matrix_wait (C, Context)) ;
         }
         ASSERT (!GB_IS_FULL (C)) ;
@@ -40,6 +40,14 @@ GrB_Info GrB_Matrix_wait    // finish all work on a matrix
         GB_BURBLE_END ;
     }
 
+    //--------------------------------------------------------------------------
+    // hold the pattern in 32-bit integers, and pack the bitmap, if permitted
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GB_OK (GB_convert_int64_to_int32 (*A, Context)) ;
+    GB_OK (GB_convert_bitmap_to_packed (*A, Context)) ;
+
     //--------------------------------------------------------------------------
     // return result
     //--------------------------------------------------------------------------
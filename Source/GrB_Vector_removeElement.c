@@ -30,6 +30,7 @@ static inline bool GB_removeElement
     //--------------------------------------------------------------------------
 
     ASSERT (!GB_IS_FULL (V)) ;
+    GB_PATTERN_CHANGED (V) ;
 
     //--------------------------------------------------------------------------
     // remove V(i)
@@ -120,11 +121,15 @@ GrB_Info GrB_Vector_removeElement
     // if V is jumbled, wait on the vector first.  If full, convert to nonfull
     //--------------------------------------------------------------------------
 
-    if (V->jumbled || GB_IS_FULL (V))
+    // the wait also converts V back to 64-bit integers, and unpacks its
+    // bitmap, if needed.  A shallow V is first copied, since it is modified.
+    if (V->jumbled || GB_IS_FULL (V) || GB_INDEX32 (V) ||
+        GB_BITMAP_PACKED (V) || GB_is_shallow ((GrB_Matrix) V))
     {
         GrB_Info info ;
         GB_WHERE (V, GB_WHERE_STRING) ;
         GB_BURBLE_START ("GrB_Vector_removeElement") ;
+        GB_OK (GB_unshallow ((GrB_Matrix) V, Context)) ;
         if (GB_IS_FULL (V))
         { 
             // convert V from full to sparse
@@ -132,7 +137,8 @@ GrB_Info GrB_Vector_removeElement
         }
         else
         { 
-            // V is sparse and jumbled
+            // V is sparse, and jumbled or 32-bit, or
+            // a packed bitmap
             GB_OK (GB_Matrix_wait ((GrB_Matrix) V, Context)) ;
         }
         ASSERT (!GB_IS_FULL (V)) ;
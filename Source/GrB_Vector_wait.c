@@ -40,6 +40,14 @@ GrB_Info GrB_Vector_wait    // finish all work on a vector
         GB_BURBLE_END ;
     }
 
+    //--------------------------------------------------------------------------
+    // hold the pattern in 32-bit integers, and pack the bitmap, if permitted
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GB_OK (GB_convert_int64_to_int32 ((GrB_Matrix) (*v), Context)) ;
+    GB_OK (GB_convert_bitmap_to_packed ((GrB_Matrix) (*v), Context)) ;
+
     //--------------------------------------------------------------------------
     // return result
     //--------------------------------------------------------------------------
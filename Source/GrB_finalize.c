@@ -12,13 +12,17 @@
 // Results are undefined if more than one thread calls this function at the
 // same time.
 
-// However, in the current version of SuiteSparse:GraphBLAS, this function has
-// nothing to do.
+// In the current version of SuiteSparse:GraphBLAS, this function only frees
+// the task schedules held in the saxpy3 plan cache (see GxB_PLAN_CACHE), and
+// the blocks of workspace held in the memory pool (see GxB_MEMORY_POOL).
 
 #include "GB.h"
+#include "GB_AxB_saxpy3.h"
 
 GrB_Info GrB_finalize ( )
 { 
+    GB_AxB_saxpy3_plan_clear ( ) ;
+    GB_Global_free_pool_dump ( ) ;
     return (GrB_SUCCESS) ;
 }
 
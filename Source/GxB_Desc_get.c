@@ -122,6 +122,28 @@ GrB_Info GxB_Desc_get           // get a parameter from a descriptor
             }
             break ;
 
+        case GxB_IMPORT : 
+
+            {
+                va_start (ap, field) ;
+                GrB_Desc_Value *value = va_arg (ap, GrB_Desc_Value *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (value) ;
+                (*value) = (desc == NULL) ? GxB_DEFAULT : desc->import ;
+            }
+            break ;
+
+        case GxB_COMPRESSION : 
+
+            {
+                va_start (ap, field) ;
+                GrB_Desc_Value *value = va_arg (ap, GrB_Desc_Value *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (value) ;
+                (*value) = (desc == NULL) ? GxB_DEFAULT : desc->compression ;
+            }
+            break ;
+
         // #include "GxB_Desc_get_mkl_template.c"
 
         default : 
@@ -152,16 +152,19 @@ GrB_Info GxB_Desc_set           // set a parameter in a descriptor
                 va_end (ap) ;
                 if (! (value == GxB_DEFAULT  || value == GxB_AxB_GUSTAVSON
                     || value == GxB_AxB_DOT
-                    || value == GxB_AxB_HASH || value == GxB_AxB_SAXPY))
+                    || value == GxB_AxB_HASH || value == GxB_AxB_SAXPY
+                    || value == GxB_AxB_OUTER))
                 { 
                     GB_ERROR (GrB_INVALID_VALUE,
                         "invalid descriptor value [%d] for GrB_AxB_METHOD"
                         " field;\nmust be GxB_DEFAULT [%d], GxB_AxB_GUSTAVSON"
                         " [%d]\nGxB_AxB_DOT [%d]"
-                        " GxB_AxB_HASH [%d] or GxB_AxB_SAXPY [%d]",
+                        " GxB_AxB_HASH [%d], GxB_AxB_SAXPY [%d]"
+                        " or GxB_AxB_OUTER [%d]",
                         value, (int) GxB_DEFAULT, (int) GxB_AxB_GUSTAVSON,
                         (int) GxB_AxB_DOT,
-                        (int) GxB_AxB_HASH, (int) GxB_AxB_SAXPY) ;
+                        (int) GxB_AxB_HASH, (int) GxB_AxB_SAXPY,
+                        (int) GxB_AxB_OUTER) ;
                 }
                 desc->axb = (GrB_Desc_Value) value ;
             }
@@ -176,6 +179,44 @@ GrB_Info GxB_Desc_set           // set a parameter in a descriptor
             }
             break ;
 
+        case GxB_IMPORT : 
+
+            {
+                va_start (ap, field) ;
+                int value = va_arg (ap, int) ;
+                va_end (ap) ;
+                if (! (value == GxB_DEFAULT || value == GxB_SHALLOW_IMPORT))
+                { 
+                    GB_ERROR (GrB_INVALID_VALUE,
+                        "invalid descriptor value [%d] for GxB_IMPORT field;\n"
+                        "must be GxB_DEFAULT [%d] or GxB_SHALLOW_IMPORT [%d]",
+                        value, (int) GxB_DEFAULT, (int) GxB_SHALLOW_IMPORT) ;
+                }
+                desc->import = (GrB_Desc_Value) value ;
+            }
+            break ;
+
+        case GxB_COMPRESSION : 
+
+            {
+                va_start (ap, field) ;
+                int value = va_arg (ap, int) ;
+                va_end (ap) ;
+                if (! (value == GxB_DEFAULT || value == GxB_COMPRESSION_NONE
+                    || value == GxB_COMPRESSION_VARINT))
+                { 
+                    GB_ERROR (GrB_INVALID_VALUE,
+                        "invalid descriptor value [%d] for GxB_COMPRESSION "
+                        "field;\nmust be GxB_DEFAULT [%d], "
+                        "GxB_COMPRESSION_NONE [%d], or\n"
+                        "GxB_COMPRESSION_VARINT [%d]",
+                        value, (int) GxB_DEFAULT, (int) GxB_COMPRESSION_NONE,
+                        (int) GxB_COMPRESSION_VARINT) ;
+                }
+                desc->compression = (GrB_Desc_Value) value ;
+            }
+            break ;
+
         // #include "GxB_Desc_set_mkl_template.c"
 
         default : 
@@ -184,10 +225,11 @@ GrB_Info GxB_Desc_set           // set a parameter in a descriptor
                 "invalid descriptor field [%d], must be one of:\n"
                 "GrB_OUTP [%d], GrB_MASK [%d], GrB_INP0 [%d], GrB_INP1 [%d]\n"
                 "GxB_NTHREADS [%d], GxB_CHUNK [%d], GxB_AxB_METHOD [%d]\n"
-                "or GxB_SORT [%d]\n",
+                "GxB_SORT [%d], GxB_IMPORT [%d], or GxB_COMPRESSION [%d]\n",
                 (int) field, (int) GrB_OUTP, (int) GrB_MASK, (int) GrB_INP0,
                 (int) GrB_INP1, (int) GxB_NTHREADS, (int) GxB_CHUNK,
-                (int) GxB_AxB_METHOD, (int) GxB_SORT) ;
+                (int) GxB_AxB_METHOD, (int) GxB_SORT, (int) GxB_IMPORT,
+                (int) GxB_COMPRESSION) ;
     }
 
     return (GrB_SUCCESS) ;
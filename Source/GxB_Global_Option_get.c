@@ -277,6 +277,225 @@ GrB_Info GxB_Global_Option_get      // gets the current global option
             }
             break ;
 
+        //----------------------------------------------------------------------
+        // plan cache for saxpy3
+        //----------------------------------------------------------------------
+
+        case GxB_PLAN_CACHE : 
+
+            {
+                va_start (ap, field) ;
+                bool *plan_cache = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (plan_cache) ;
+                (*plan_cache) = GB_Global_plan_cache_get ( ) ;
+            }
+            break ;
+
+        case GxB_PLAN_CACHE_HITS : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *hits = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (hits) ;
+                (*hits) = GB_Global_plan_cache_hits_get ( ) ;
+            }
+            break ;
+
+        case GxB_PLAN_CACHE_MISSES : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *misses = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (misses) ;
+                (*misses) = GB_Global_plan_cache_misses_get ( ) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // memory pool for workspace
+        //----------------------------------------------------------------------
+
+        case GxB_MEMORY_POOL : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *limit = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (limit) ;
+                (*limit) = GB_Global_free_pool_limit_get ( ) ;
+            }
+            break ;
+
+        case GxB_MEMORY_POOL_HITS : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *hits = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (hits) ;
+                (*hits) = GB_Global_free_pool_hits_get ( ) ;
+            }
+            break ;
+
+        case GxB_MEMORY_POOL_MISSES : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *misses = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (misses) ;
+                (*misses) = GB_Global_free_pool_misses_get ( ) ;
+            }
+            break ;
+
+        case GxB_MEMORY_POOL_SIZE : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *size = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (size) ;
+                (*size) = GB_Global_free_pool_size_get ( ) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // first touch, huge pages, and NUMA policy for large blocks of memory
+        //----------------------------------------------------------------------
+
+        case GxB_MEMORY_FIRST_TOUCH : 
+
+            {
+                va_start (ap, field) ;
+                bool *first_touch = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (first_touch) ;
+                (*first_touch) = GB_Global_first_touch_get ( ) ;
+            }
+            break ;
+
+        case GxB_MEMORY_HUGE_PAGES : 
+
+            {
+                va_start (ap, field) ;
+                bool *huge_pages = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (huge_pages) ;
+                (*huge_pages) = GB_Global_huge_pages_get ( ) ;
+            }
+            break ;
+
+        case GxB_NUMA_POLICY : 
+
+            {
+                va_start (ap, field) ;
+                int *numa_policy = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (numa_policy) ;
+                (*numa_policy) = GB_Global_numa_policy_get ( ) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // 32-bit integer control for new matrices
+        //----------------------------------------------------------------------
+
+        case GxB_INDEX32_CONTROL : 
+
+            {
+                va_start (ap, field) ;
+                int *index32_control = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (index32_control) ;
+                (*index32_control) = GB_Global_index32_control_get ( ) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // packed bitmap control for new matrices
+        //----------------------------------------------------------------------
+
+        case GxB_BITMAP_PACK_CONTROL : 
+
+            {
+                va_start (ap, field) ;
+                int *bitmap_pack_control = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (bitmap_pack_control) ;
+                (*bitmap_pack_control) = GB_Global_bitmap_pack_control_get ( ) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // cost model for C=A*B
+        //----------------------------------------------------------------------
+
+        case GxB_AxB_COST_MODEL : 
+
+            {
+                va_start (ap, field) ;
+                bool *cost_model = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (cost_model) ;
+                (*cost_model) = GB_Global_axb_cost_model_get ( ) ;
+            }
+            break ;
+
+        case GxB_AxB_COST_PREDICTED : 
+
+            {
+                va_start (ap, field) ;
+                double *predicted = va_arg (ap, double *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (predicted) ;
+                (*predicted) = GB_Global_axb_cost_predicted_get ( ) ;
+            }
+            break ;
+
+        case GxB_AxB_COST_ACTUAL : 
+
+            {
+                va_start (ap, field) ;
+                double *actual = va_arg (ap, double *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (actual) ;
+                (*actual) = GB_Global_axb_cost_actual_get ( ) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // sorting method for GrB_Matrix_build and GrB_wait
+        //----------------------------------------------------------------------
+
+        case GxB_BUILD_SORT : 
+
+            {
+                va_start (ap, field) ;
+                int *build_sort = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (build_sort) ;
+                (*build_sort) = GB_Global_build_sort_get ( ) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // size of the sorted runs of pending tuples
+        //----------------------------------------------------------------------
+
+        case GxB_PENDING_RUN_SIZE : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *pending_run_size = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (pending_run_size) ;
+                (*pending_run_size) = GB_Global_pending_run_size_get ( ) ;
+            }
+            break ;
+
         //----------------------------------------------------------------------
         // CUDA (DRAFT: in progress, do not use)
         //----------------------------------------------------------------------
@@ -8,6 +8,8 @@
 //------------------------------------------------------------------------------
 
 #include "GB.h"
+#include "GB_AxB_saxpy3.h"
+#include "GB_AxB_cost.h"
 
 GrB_Info GxB_Global_Option_set      // set a global default option
 (
@@ -121,6 +123,168 @@ GrB_Info GxB_Global_Option_set      // set a global default option
             }
             break ;
 
+        //----------------------------------------------------------------------
+        // plan cache for saxpy3
+        //----------------------------------------------------------------------
+
+        case GxB_PLAN_CACHE : 
+
+            { 
+                va_start (ap, field) ;
+                int plan_cache = va_arg (ap, int) ;
+                va_end (ap) ;
+                // discard all cached plans and reset the statistics
+                GB_AxB_saxpy3_plan_clear ( ) ;
+                GB_Global_plan_cache_stats_clear ( ) ;
+                GB_Global_plan_cache_set ((bool) plan_cache) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // memory pool for workspace
+        //----------------------------------------------------------------------
+
+        case GxB_MEMORY_POOL : 
+
+            { 
+                va_start (ap, field) ;
+                int64_t limit = va_arg (ap, int64_t) ;
+                va_end (ap) ;
+                // free all blocks in the pool and reset the statistics
+                GB_Global_free_pool_limit_set (limit) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // first touch, huge pages, and NUMA policy for large blocks of memory
+        //----------------------------------------------------------------------
+
+        case GxB_MEMORY_FIRST_TOUCH : 
+
+            { 
+                va_start (ap, field) ;
+                int first_touch = va_arg (ap, int) ;
+                va_end (ap) ;
+                GB_Global_first_touch_set ((bool) first_touch) ;
+            }
+            break ;
+
+        case GxB_MEMORY_HUGE_PAGES : 
+
+            { 
+                va_start (ap, field) ;
+                int huge_pages = va_arg (ap, int) ;
+                va_end (ap) ;
+                GB_Global_huge_pages_set ((bool) huge_pages) ;
+            }
+            break ;
+
+        case GxB_NUMA_POLICY : 
+
+            {
+                va_start (ap, field) ;
+                int numa_policy = va_arg (ap, int) ;
+                va_end (ap) ;
+                if (!GB_NUMA_POLICY_OK (numa_policy))
+                { 
+                    return (GrB_INVALID_VALUE) ;
+                }
+                GB_Global_numa_policy_set (numa_policy) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // 32-bit integer control for new matrices
+        //----------------------------------------------------------------------
+
+        case GxB_INDEX32_CONTROL : 
+
+            {
+                va_start (ap, field) ;
+                int index32_control = va_arg (ap, int) ;
+                va_end (ap) ;
+                if (!GB_INDEX32_CONTROL_OK (index32_control))
+                { 
+                    return (GrB_INVALID_VALUE) ;
+                }
+                GB_Global_index32_control_set (index32_control) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // packed bitmap control for new matrices
+        //----------------------------------------------------------------------
+
+        case GxB_BITMAP_PACK_CONTROL : 
+
+            {
+                va_start (ap, field) ;
+                int bitmap_pack_control = va_arg (ap, int) ;
+                va_end (ap) ;
+                if (!GB_BITMAP_PACK_CONTROL_OK (bitmap_pack_control))
+                { 
+                    return (GrB_INVALID_VALUE) ;
+                }
+                GB_Global_bitmap_pack_control_set (bitmap_pack_control) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // cost model for C=A*B
+        //----------------------------------------------------------------------
+
+        case GxB_AxB_COST_MODEL : 
+
+            { 
+                va_start (ap, field) ;
+                int cost_model = va_arg (ap, int) ;
+                va_end (ap) ;
+                if (cost_model)
+                { 
+                    // measure the coefficients of the model on this host
+                    GB_AxB_cost_calibrate ( ) ;
+                }
+                GB_Global_axb_cost_telemetry_set (0, 0) ;
+                GB_Global_axb_cost_model_set ((bool) cost_model) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // sorting method for GrB_Matrix_build and GrB_wait
+        //----------------------------------------------------------------------
+
+        case GxB_BUILD_SORT : 
+
+            {
+                va_start (ap, field) ;
+                int build_sort = va_arg (ap, int) ;
+                va_end (ap) ;
+                if (!GB_BUILD_SORT_OK (build_sort))
+                { 
+                    return (GrB_INVALID_VALUE) ;
+                }
+                GB_Global_build_sort_set (build_sort) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // size of the sorted runs of pending tuples
+        //----------------------------------------------------------------------
+
+        case GxB_PENDING_RUN_SIZE : 
+
+            {
+                va_start (ap, field) ;
+                int64_t pending_run_size = va_arg (ap, int64_t) ;
+                va_end (ap) ;
+                if (pending_run_size < 0)
+                { 
+                    return (GrB_INVALID_VALUE) ;
+                }
+                GB_Global_pending_run_size_set (pending_run_size) ;
+            }
+            break ;
+
         //----------------------------------------------------------------------
         // CUDA (DRAFT: in progress, do not use)
         //----------------------------------------------------------------------
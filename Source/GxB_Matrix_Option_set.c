@@ -29,6 +29,13 @@ GrB_Info GxB_Matrix_Option_set      // set an option in a matrix
     GB_RETURN_IF_NULL_OR_FAULTY (A) ;
     ASSERT_MATRIX_OK (A, "A to set option", GB0) ;
 
+    // hold the pattern of A in 64-bit integers, and unpack its bitmap, while
+    // it is conformed below
+    bool A_is_32 = GB_INDEX32 (A) ;
+    bool A_is_packed = GB_BITMAP_PACKED (A) ;
+    GB_OK (GB_convert_int32_to_int64 (A, Context)) ;
+    GB_OK (GB_convert_packed_to_bitmap (A, Context)) ;
+
     //--------------------------------------------------------------------------
     // set the matrix option
     //--------------------------------------------------------------------------
@@ -68,6 +75,36 @@ GrB_Info GxB_Matrix_Option_set      // set an option in a matrix
             }
             break ;
 
+        case GxB_INDEX32_CONTROL : 
+
+            {
+                va_start (ap, field) ;
+                int index32_control = va_arg (ap, int) ;
+                va_end (ap) ;
+                if (!GB_INDEX32_CONTROL_OK (index32_control))
+                { 
+                    return (GrB_INVALID_VALUE) ;
+                }
+                A->index32_control = index32_control ;
+                A_is_32 = true ;
+            }
+            break ;
+
+        case GxB_BITMAP_PACK_CONTROL : 
+
+            {
+                va_start (ap, field) ;
+                int bitmap_pack_control = va_arg (ap, int) ;
+                va_end (ap) ;
+                if (!GB_BITMAP_PACK_CONTROL_OK (bitmap_pack_control))
+                { 
+                    return (GrB_INVALID_VALUE) ;
+                }
+                A->bitmap_pack_control = bitmap_pack_control ;
+                A_is_packed = true ;
+            }
+            break ;
+
         case GxB_FORMAT : 
 
             {
@@ -105,6 +142,16 @@ GrB_Info GxB_Matrix_Option_set      // set an option in a matrix
     //--------------------------------------------------------------------------
 
     GB_OK (GB_conform (A, Context)) ;
+    if (A_is_32)
+    { 
+        // return A to 32-bit integers, if its control permits
+        GB_OK (GB_convert_int64_to_int32 (A, Context)) ;
+    }
+    if (A_is_packed)
+    { 
+        // pack the bitmap of A again, if its control permits
+        GB_OK (GB_convert_bitmap_to_packed (A, Context)) ;
+    }
     GB_BURBLE_END ;
     ASSERT_MATRIX_OK (A, "A set", GB0) ;
     return (GrB_SUCCESS) ;
@@ -0,0 +1,49 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_deserialize: create a matrix from a blob
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The blob was created by GxB_Matrix_serialize, and is not modified.
+
+#include "GB_serialize.h"
+
+GrB_Info GxB_Matrix_deserialize     // deserialize blob into a GrB_Matrix
+(
+    // output:
+    GrB_Matrix *C,                  // output matrix created from the blob
+    // input:
+    GrB_Type type,                  // type of C; required if the blob holds a
+                                    // matrix of user-defined type, and may be
+                                    // NULL otherwise
+    const void *blob,               // the blob
+    GrB_Index blob_size,            // size of the blob, in bytes
+    const GrB_Descriptor desc       // to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs and get the descriptor
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_deserialize (&C, type, blob, blob_size, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_deserialize") ;
+    GB_RETURN_IF_NULL (C) ;
+    (*C) = NULL ;
+    GB_RETURN_IF_NULL (blob) ;
+    GB_RETURN_IF_FAULTY (type) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    //--------------------------------------------------------------------------
+    // deserialize the blob into a new matrix
+    //--------------------------------------------------------------------------
+
+    info = GB_deserialize (C, type, (const GB_void *) blob, (size_t) blob_size,
+        false, Context) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
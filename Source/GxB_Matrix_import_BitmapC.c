@@ -34,6 +34,7 @@ GrB_Info GxB_Matrix_import_BitmapC  // import a bitmap matrix, held by column
         "&Ab, &Ax, Ab_size, Ax_size, nvals, desc)") ;
     GB_BURBLE_START ("GxB_Matrix_import_BitmapC") ;
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    bool shallow = (desc != NULL && desc->import == GxB_SHALLOW_IMPORT) ;
 
     //--------------------------------------------------------------------------
     // import the matrix
@@ -45,8 +46,8 @@ GrB_Info GxB_Matrix_import_BitmapC  // import a bitmap matrix, held by column
         Ab,   Ab_size,  // Ab
         NULL, 0,        // Ai
         Ax,   Ax_size,  // Ax
-        nvals, false, 0,                    // nvals for bitmap
-        GxB_BITMAP, true, Context) ;        // bitmap by col
+        nvals, false, 0,                        // nvals for bitmap
+        GxB_BITMAP, true, shallow, Context) ;   // bitmap by col
 
     GB_BURBLE_END ;
     return (info) ;
@@ -34,6 +34,7 @@ GrB_Info GxB_Matrix_import_BitmapR  // import a bitmap matrix, held by row
         "&Ab, &Ax, Ab_size, Ax_size, nvals, desc)") ;
     GB_BURBLE_START ("GxB_Matrix_import_BitmapR") ;
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    bool shallow = (desc != NULL && desc->import == GxB_SHALLOW_IMPORT) ;
 
     //--------------------------------------------------------------------------
     // import the matrix
@@ -45,8 +46,8 @@ GrB_Info GxB_Matrix_import_BitmapR  // import a bitmap matrix, held by row
         Ab,   Ab_size,  // Ab
         NULL, 0,        // Ai
         Ax,   Ax_size,  // Ax
-        nvals, false, 0,                    // nvals for bitmap
-        GxB_BITMAP, false, Context) ;       // bitmap by row
+        nvals, false, 0,                        // nvals for bitmap
+        GxB_BITMAP, false, shallow, Context) ;  // bitmap by row
 
     GB_BURBLE_END ;
     return (info) ;
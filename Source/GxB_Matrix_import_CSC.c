@@ -36,6 +36,7 @@ GrB_Info GxB_Matrix_import_CSC      // import a CSC matrix
         "&Ap, &Ai, &Ax, Ap_size, Ai_size, Ax_size, jumbled, desc)") ;
     GB_BURBLE_START ("GxB_Matrix_import_CSC") ;
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    bool shallow = (desc != NULL && desc->import == GxB_SHALLOW_IMPORT) ;
 
     //--------------------------------------------------------------------------
     // import the matrix
@@ -47,8 +48,8 @@ GrB_Info GxB_Matrix_import_CSC      // import a CSC matrix
         NULL, 0,        // Ab
         Ai,   Ai_size,  // Ai
         Ax,   Ax_size,  // Ax
-        0, jumbled, 0,                      // jumbled or not
-        GxB_SPARSE, true, Context) ;        // sparse by col
+        0, jumbled, 0,                          // jumbled or not
+        GxB_SPARSE, true, shallow, Context) ;   // sparse by col
 
     GB_BURBLE_END ;
     return (info) ;
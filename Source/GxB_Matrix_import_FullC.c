@@ -31,6 +31,7 @@ GrB_Info GxB_Matrix_import_FullC  // import a full matrix, held by column
         "&Ax, Ax_size, desc)") ;
     GB_BURBLE_START ("GxB_Matrix_import_FullC") ;
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    bool shallow = (desc != NULL && desc->import == GxB_SHALLOW_IMPORT) ;
 
     //--------------------------------------------------------------------------
     // import the matrix
@@ -43,7 +44,7 @@ GrB_Info GxB_Matrix_import_FullC  // import a full matrix, held by column
         NULL, 0,        // Ai
         Ax,   Ax_size,  // Ax
         0, false, 0,
-        GxB_FULL, true, Context) ;          // full by col
+        GxB_FULL, true, shallow, Context) ;     // full by col
 
     GB_BURBLE_END ;
     return (info) ;
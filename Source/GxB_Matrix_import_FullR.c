@@ -31,6 +31,7 @@ GrB_Info GxB_Matrix_import_FullR  // import a full matrix, held by row
         "&Ax, Ax_size, desc)") ;
     GB_BURBLE_START ("GxB_Matrix_import_FullR") ;
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    bool shallow = (desc != NULL && desc->import == GxB_SHALLOW_IMPORT) ;
 
     //--------------------------------------------------------------------------
     // import the matrix
@@ -43,7 +44,7 @@ GrB_Info GxB_Matrix_import_FullR  // import a full matrix, held by row
         NULL, 0,        // Ai
         Ax,   Ax_size,  // Ax
         0, false, 0,
-        GxB_FULL, false, Context) ;         // full by row
+        GxB_FULL, false, shallow, Context) ;    // full by row
 
     GB_BURBLE_END ;
     return (info) ;
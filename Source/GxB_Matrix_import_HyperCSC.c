@@ -40,6 +40,7 @@ GrB_Info GxB_Matrix_import_HyperCSC      // import a hypersparse CSC matrix
         "nvec, jumbled, desc)") ;
     GB_BURBLE_START ("GxB_Matrix_import_HyperCSC") ;
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    bool shallow = (desc != NULL && desc->import == GxB_SHALLOW_IMPORT) ;
 
     //--------------------------------------------------------------------------
     // import the matrix
@@ -51,8 +52,8 @@ GrB_Info GxB_Matrix_import_HyperCSC      // import a hypersparse CSC matrix
         NULL, 0,        // Ab
         Ai,   Ai_size,  // Ai
         Ax,   Ax_size,  // Ax
-        0, jumbled, nvec,                   // jumbled or not
-        GxB_HYPERSPARSE, true, Context) ;   // hypersparse by col
+        0, jumbled, nvec,                       // jumbled or not
+        GxB_HYPERSPARSE, true, shallow, Context) ; // hypersparse by col
 
     GB_BURBLE_END ;
     return (info) ;
@@ -40,6 +40,7 @@ GrB_Info GxB_Matrix_import_HyperCSR      // import a hypersparse CSR matrix
         "nvec, jumbled, desc)") ;
     GB_BURBLE_START ("GxB_Matrix_import_HyperCSR") ;
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    bool shallow = (desc != NULL && desc->import == GxB_SHALLOW_IMPORT) ;
 
     //--------------------------------------------------------------------------
     // import the matrix
@@ -51,8 +52,8 @@ GrB_Info GxB_Matrix_import_HyperCSR      // import a hypersparse CSR matrix
         NULL, 0,        // Ab
         Aj,   Aj_size,  // Aj
         Ax,   Ax_size,  // Ax
-        0, jumbled, nvec,                   // jumbled or not
-        GxB_HYPERSPARSE, false, Context) ;  // hypersparse by row
+        0, jumbled, nvec,                       // jumbled or not
+        GxB_HYPERSPARSE, false, shallow, Context) ; // hypersparse by row
 
     GB_BURBLE_END ;
     return (info) ;
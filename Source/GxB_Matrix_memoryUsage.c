@@ -0,0 +1,54 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_memoryUsage: return the memory held by a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The memory held by a matrix is the size of its header, the allocated sizes
+// of each of its components, and the size of its list of pending tuples.
+// Components that are shallow are not counted, since they are owned by
+// another object.  Any pending work is left pending.
+
+#include "GB.h"
+
+GrB_Info GxB_Matrix_memoryUsage     // return # of bytes used for a matrix
+(
+    size_t *size,           // # of bytes used by the matrix A
+    const GrB_Matrix A      // matrix to query
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_memoryUsage (&size, A)") ;
+    GB_RETURN_IF_NULL (size) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+
+    //--------------------------------------------------------------------------
+    // sum up the memory held by A
+    //--------------------------------------------------------------------------
+
+    size_t s = sizeof (struct GB_Matrix_opaque) ;
+    if (!A->p_shallow) s += A->p_size ;
+    if (!A->h_shallow) s += A->h_size ;
+    if (!A->b_shallow) s += A->b_size ;
+    if (!A->i_shallow) s += A->i_size ;
+    if (!A->x_shallow) s += A->x_size ;
+
+    GB_Pending Pending = A->Pending ;
+    if (Pending != NULL)
+    { 
+        s += sizeof (struct GB_Pending_struct) ;
+        s += Pending->nmax * sizeof (int64_t) ;
+        if (Pending->j != NULL) s += Pending->nmax * sizeof (int64_t) ;
+        if (Pending->x != NULL) s += Pending->nmax * Pending->size ;
+    }
+
+    (*size) = s ;
+    return (GrB_SUCCESS) ;
+}
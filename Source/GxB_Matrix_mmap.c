@@ -0,0 +1,49 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_mmap: create a matrix held in a read-only mapping of a file
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The file was written by GxB_Matrix_mmap_write, and must not be modified
+// while C exists.  C is freed with GrB_Matrix_free, which also unmaps the
+// file.
+
+#include "GB_mmap.h"
+
+GrB_Info GxB_Matrix_mmap            // map a file into a GrB_Matrix
+(
+    // output:
+    GrB_Matrix *C,                  // output matrix mapped from the file
+    // input:
+    GrB_Type type,                  // type of C; required if the file holds a
+                                    // matrix of user-defined type, and may be
+                                    // NULL otherwise
+    const char *filename,           // name of the file to map
+    const GrB_Descriptor desc       // to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs and get the descriptor
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_mmap (&C, type, filename, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_mmap") ;
+    GB_RETURN_IF_NULL (C) ;
+    (*C) = NULL ;
+    GB_RETURN_IF_NULL (filename) ;
+    GB_RETURN_IF_FAULTY (type) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    //--------------------------------------------------------------------------
+    // map the file into a new matrix
+    //--------------------------------------------------------------------------
+
+    info = GB_mmap (C, type, filename, Context) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
@@ -0,0 +1,42 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_mmap_write: write a matrix to a file, for GxB_Matrix_mmap
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The file can be mapped into memory by GxB_Matrix_mmap, or read into memory
+// and passed to GxB_Matrix_deserialize.  Any pending work on A is finished,
+// and A is converted to 64-bit integers and an unpacked bitmap.
+
+#include "GB_mmap.h"
+
+GrB_Info GxB_Matrix_mmap_write      // write a GrB_Matrix to a file
+(
+    const char *filename,           // name of the file to write
+    GrB_Matrix A,                   // matrix to write
+    const GrB_Descriptor desc       // to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs and get the descriptor
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (A, "GxB_Matrix_mmap_write (filename, A, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_mmap_write") ;
+    GB_RETURN_IF_NULL (filename) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    //--------------------------------------------------------------------------
+    // write the matrix to the file
+    //--------------------------------------------------------------------------
+
+    info = GB_mmap_write (filename, A, Context) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
@@ -0,0 +1,50 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_serialize: serialize a matrix into a blob
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The blob is allocated with the same malloc function used by GraphBLAS, and
+// must be freed by the user application with the corresponding free function.
+
+#include "GB_serialize.h"
+
+GrB_Info GxB_Matrix_serialize       // serialize a GrB_Matrix to a blob
+(
+    // output:
+    void **blob_handle,             // the blob, allocated on output
+    GrB_Index *blob_size_handle,    // size of the blob, in bytes
+    // input:
+    GrB_Matrix A,                   // matrix to serialize
+    const GrB_Descriptor desc       // descriptor to select compression method
+                                    // and to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs and get the descriptor
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_serialize (&blob, &blob_size, A, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_serialize") ;
+    GB_RETURN_IF_NULL (blob_handle) ;
+    GB_RETURN_IF_NULL (blob_size_handle) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    int compression = (desc == NULL) ? GxB_DEFAULT : desc->compression ;
+
+    //--------------------------------------------------------------------------
+    // serialize the matrix
+    //--------------------------------------------------------------------------
+
+    size_t blob_size = 0 ;
+    info = GB_serialize ((GB_void **) blob_handle, &blob_size, A,
+        compression, Context) ;
+    (*blob_size_handle) = (GrB_Index) blob_size ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
@@ -56,6 +56,50 @@ GrB_Info GxB_Vector_Option_get      // gets the current option of a vector
             }
             break ;
 
+        case GxB_INDEX32_CONTROL : 
+
+            {
+                va_start (ap, field) ;
+                int *index32_control = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (index32_control) ;
+                (*index32_control) = v->index32_control ;
+            }
+            break ;
+
+        case GxB_INDEX32_STATUS : 
+
+            {
+                va_start (ap, field) ;
+                bool *is32 = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (is32) ;
+                (*is32) = GB_INDEX32 (v) ;
+            }
+            break ;
+
+        case GxB_BITMAP_PACK_CONTROL : 
+
+            {
+                va_start (ap, field) ;
+                int *bitmap_pack_control = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (bitmap_pack_control) ;
+                (*bitmap_pack_control) = v->bitmap_pack_control ;
+            }
+            break ;
+
+        case GxB_BITMAP_PACK_STATUS : 
+
+            {
+                va_start (ap, field) ;
+                bool *is_packed = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (is_packed) ;
+                (*is_packed) = GB_BITMAP_PACKED (v) ;
+            }
+            break ;
+
         case GxB_SPARSITY_STATUS : 
 
             {
@@ -29,6 +29,13 @@ GrB_Info GxB_Vector_Option_set      // set an option in a vector
     GB_RETURN_IF_NULL_OR_FAULTY (v) ;
     ASSERT_VECTOR_OK (v, "v to set option", GB0) ;
 
+    // hold the pattern of v in 64-bit integers, and unpack its bitmap, while
+    // it is conformed below
+    bool v_is_32 = GB_INDEX32 (v) ;
+    bool v_is_packed = GB_BITMAP_PACKED (v) ;
+    GB_OK (GB_convert_int32_to_int64 ((GrB_Matrix) v, Context)) ;
+    GB_OK (GB_convert_packed_to_bitmap ((GrB_Matrix) v, Context)) ;
+
     //--------------------------------------------------------------------------
     // set the vector option
     //--------------------------------------------------------------------------
@@ -58,6 +65,36 @@ GrB_Info GxB_Vector_Option_set      // set an option in a vector
             }
             break ;
 
+        case GxB_INDEX32_CONTROL : 
+
+            {
+                va_start (ap, field) ;
+                int index32_control = va_arg (ap, int) ;
+                va_end (ap) ;
+                if (!GB_INDEX32_CONTROL_OK (index32_control))
+                { 
+                    return (GrB_INVALID_VALUE) ;
+                }
+                v->index32_control = index32_control ;
+                v_is_32 = true ;
+            }
+            break ;
+
+        case GxB_BITMAP_PACK_CONTROL : 
+
+            {
+                va_start (ap, field) ;
+                int bitmap_pack_control = va_arg (ap, int) ;
+                va_end (ap) ;
+                if (!GB_BITMAP_PACK_CONTROL_OK (bitmap_pack_control))
+                { 
+                    return (GrB_INVALID_VALUE) ;
+                }
+                v->bitmap_pack_control = bitmap_pack_control ;
+                v_is_packed = true ;
+            }
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -68,6 +105,16 @@ GrB_Info GxB_Vector_Option_set      // set an option in a vector
     //--------------------------------------------------------------------------
 
     GB_OK (GB_conform ((GrB_Matrix) v, Context)) ;
+    if (v_is_32)
+    { 
+        // return v to 32-bit integers, if its control permits
+        GB_OK (GB_convert_int64_to_int32 ((GrB_Matrix) v, Context)) ;
+    }
+    if (v_is_packed)
+    { 
+        // pack the bitmap of v again, if its control permits
+        GB_OK (GB_convert_bitmap_to_packed ((GrB_Matrix) v, Context)) ;
+    }
     GB_BURBLE_END ;
     ASSERT_VECTOR_OK (v, "v set", GB0) ;
     return (info) ;
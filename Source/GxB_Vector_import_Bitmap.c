@@ -33,6 +33,7 @@ GrB_Info GxB_Vector_import_Bitmap // import a bitmap vector
         " &vb, &vx, vb_size, vx_size, nvals, desc)") ;
     GB_BURBLE_START ("GxB_Vector_import_Bitmap") ;
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    bool shallow = (desc != NULL && desc->import == GxB_SHALLOW_IMPORT) ;
 
     //--------------------------------------------------------------------------
     // import the vector
@@ -44,8 +45,8 @@ GrB_Info GxB_Vector_import_Bitmap // import a bitmap vector
         vb,   vb_size,  // Ab
         NULL, 0,        // Ai
         vx,   vx_size,  // Ax
-        nvals, false, 0,                    // nvals for bitmap
-        GxB_BITMAP, true, Context) ;        // bitmap by col
+        nvals, false, 0,                        // nvals for bitmap
+        GxB_BITMAP, true, shallow, Context) ;   // bitmap by col
 
     GB_BURBLE_END ;
     return (info) ;
@@ -34,6 +34,7 @@ GrB_Info GxB_Vector_import_CSC  // import a vector in CSC format
         " &vi, &vx, vi_size, vx_size, nvals, jumbled, desc)") ;
     GB_BURBLE_START ("GxB_Vector_import_CSC") ;
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    bool shallow = (desc != NULL && desc->import == GxB_SHALLOW_IMPORT) ;
 
     //--------------------------------------------------------------------------
     // import the vector
@@ -54,8 +55,16 @@ GrB_Info GxB_Vector_import_CSC  // import a vector in CSC format
         NULL, 0,        // Ab
         vi,   vi_size,  // Ai
         vx,   vx_size,  // Ax
-        0, jumbled, 0,                      // jumbled or not
-        GxB_SPARSE, true, Context) ;        // sparse by col
+        0, jumbled, 0,                          // jumbled or not
+        GxB_SPARSE, true, shallow, Context) ;   // sparse by col
+
+    if (info == GrB_SUCCESS && shallow)
+    { 
+        // vp is not owned by the user application, so transplant it into v
+        (*v)->p_shallow = false ;
+        (*v)->p_size = 2 * sizeof (int64_t) ;
+        vp = NULL ;
+    }
 
     GB_FREE (vp) ;
     GB_BURBLE_END ;
@@ -30,6 +30,7 @@ GrB_Info GxB_Vector_import_Full // import a full vector
         "&vx, vx_size, desc)") ;
     GB_BURBLE_START ("GxB_Vector_import_Full") ;
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    bool shallow = (desc != NULL && desc->import == GxB_SHALLOW_IMPORT) ;
 
     //--------------------------------------------------------------------------
     // import the vector
@@ -42,7 +43,7 @@ GrB_Info GxB_Vector_import_Full // import a full vector
         NULL, 0,        // Ai
         vx,   vx_size,  // Ax
         0, false, 0,
-        GxB_FULL, true, Context) ;          // full by col
+        GxB_FULL, true, shallow, Context) ;     // full by col
 
     GB_BURBLE_END ;
     return (info) ;
@@ -9,15 +9,37 @@
 
 #define GB_DOT2
 
+// tile sizes for GB_AxB_dot2_tiled_template: the panel A(k1:k2-1,i1:i2-1) has
+// at most GB_DOT2_TILE_K * GB_DOT2_TILE_I entries, and should fit in L2 cache.
+#ifndef GB_DOT2_TILE_K
+#define GB_DOT2_TILE_K 1024
+#endif
+#ifndef GB_DOT2_TILE_I
+#define GB_DOT2_TILE_I 32
+#endif
+
 #include "GB_unused.h"
 #include "GB_AxB_dot_cij.h"
 
-// GB_DOT_ALWAYS_SAVE_CIJ: C(i,j) = cij
+// GB_DOT2_GET_CB: cb = 1 if C(i,j) is present on input, which can only occur
+// if C is computed in-place.  Any mask entry scattered into Cb [pC] is cleared.
+#define GB_DOT2_GET_CB                                      \
+    const int8_t cb = (C_in_place) ? (Cb [pC] & 1) : 0 ;    \
+    Cb [pC] = cb ;
+
+// GB_DOT_ALWAYS_SAVE_CIJ: C(i,j) = cij, or C(i,j) += cij if already present
 #define GB_DOT_ALWAYS_SAVE_CIJ      \
 {                                   \
-    GB_PUTC (cij, pC) ;             \
-    Cb [pC] = 1 ;                   \
-    task_cnvals++ ;                 \
+    if (cb)                         \
+    {                               \
+        GB_CIJ_UPDATE (pC, cij) ;   \
+    }                               \
+    else                            \
+    {                               \
+        GB_PUTC (cij, pC) ;         \
+        Cb [pC] = 1 ;               \
+        task_cnvals++ ;             \
+    }                               \
 }
 
 // GB_DOT_SAVE_CIJ: C(i,j) = cij, unless already done by GB_DOT
@@ -50,9 +72,13 @@
     // dimensions.  The C bitmap matrix is unpacked into a sparse or
     // hypersparse matrix when done.
 
-    int64_t cnvals = 0 ;
+    // If C is computed in-place, its prior entries are kept and accumulated
+    // into the result.  Otherwise, C->nvals is zero on input and all of Cb is
+    // overwritten.
 
     ASSERT (GB_IS_BITMAP (C)) ;
+    int64_t cnvals = C->nvals ;
+    const bool C_in_place = (cnvals > 0) ;
     int8_t   *GB_RESTRICT Cb = C->b ;
     GB_CTYPE *GB_RESTRICT Cx = (GB_CTYPE *) C->x ;
     const int64_t cvlen = C->vlen ;
@@ -174,6 +200,7 @@
 #undef A_is_hyper
 #undef B_is_hyper
 
+#undef GB_DOT2_GET_CB
 #undef GB_DOT_ALWAYS_SAVE_CIJ
 #undef GB_DOT_SAVE_CIJ
 
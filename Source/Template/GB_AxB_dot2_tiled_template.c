@@ -0,0 +1,166 @@
+//------------------------------------------------------------------------------
+// GB_AxB_dot2_tiled_template:  C=A'*B via tiled dot products, A,B bitmap/full
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C=A'*B where A and B are both bitmap or full, C is bitmap, and no mask is
+// present.  This method is used when A->vlen is large.  The untiled method in
+// GB_AxB_dot2_template computes each C(i,j) with a single dot product across
+// all of A(:,i) and B(:,j), so A(:,i) is reloaded from memory for each j.
+// Here, the k dimension is split into panels of GB_DOT2_TILE_K entries, and
+// each task sweeps its block of A' in groups of GB_DOT2_TILE_I vectors.  The
+// panel A(k1:k2-1,i1:i2-1) stays in the L2 cache while it is used for all
+// vectors B(k1:k2-1,j) in the task, and B(k1:k2-1,j) stays in the L1 cache
+// while it is used for all A(:,i1:i2-1).  The partial result cij is held in
+// Cx [pC] between panels, and Cb [pC] records if C(i,j) exists so far.  If C
+// is computed in-place, its prior entries are the starting values of cij.
+
+// The ANY monoid is not used here, since its dot products terminate early.
+// The PAIR multiplier with A and B both full is also not used, since then
+// each C(i,j) is computed in O(1) time.
+
+{
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
+        reduction(+:cnvals)
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+
+        //----------------------------------------------------------------------
+        // get the task descriptor
+        //----------------------------------------------------------------------
+
+        const int a_tid = tid / nbslice ;
+        const int b_tid = tid % nbslice ;
+        const int64_t kA_start = A_slice [a_tid] ;
+        const int64_t kA_end   = A_slice [a_tid+1] ;
+        const int64_t kB_start = B_slice [b_tid] ;
+        const int64_t kB_end   = B_slice [b_tid+1] ;
+        int64_t task_cnvals = 0 ;
+
+        //----------------------------------------------------------------------
+        // clear the bitmap of C(kA_start:kA_end-1,kB_start:kB_end-1)
+        //----------------------------------------------------------------------
+
+        if (!C_in_place)
+        {
+            for (int64_t j = kB_start ; j < kB_end ; j++)
+            { 
+                memset (&Cb [j * cvlen + kA_start], 0, kA_end - kA_start) ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // C(i,j) += A(k1:k2-1,i)'*B(k1:k2-1,j), one panel at a time
+        //----------------------------------------------------------------------
+
+        for (int64_t k1 = 0 ; k1 < vlen ; k1 += GB_DOT2_TILE_K)
+        {
+            const int64_t k2 = GB_IMIN (k1 + GB_DOT2_TILE_K, vlen) ;
+            for (int64_t i1 = kA_start ; i1 < kA_end ; i1 += GB_DOT2_TILE_I)
+            {
+                const int64_t i2 = GB_IMIN (i1 + GB_DOT2_TILE_I, kA_end) ;
+                for (int64_t j = kB_start ; j < kB_end ; j++)
+                {
+                    const int64_t pC_start = j * cvlen ;
+                    const int64_t pB = j * vlen ;
+                    for (int64_t i = i1 ; i < i2 ; i++)
+                    {
+
+                        //------------------------------------------------------
+                        // get the partial result C(i,j), if it exists
+                        //------------------------------------------------------
+
+                        const int64_t pA = i * vlen ;
+                        const int64_t pC = pC_start + i ;
+                        bool cij_exists = (Cb [pC] != 0) ;
+                        GB_CIJ_DECLARE (cij) ;
+                        if (cij_exists)
+                        {
+                            GB_GETC (cij, pC) ;
+                        }
+
+                        //------------------------------------------------------
+                        // cij += A(k1:k2-1,i)'*B(k1:k2-1,j)
+                        //------------------------------------------------------
+
+                        #if ( GB_A_IS_FULL && GB_B_IS_FULL )
+                        {
+                            int64_t kfirst = k1 ;
+                            if (!cij_exists)
+                            {
+                                // cij = A(k1,i) * B(k1,j)
+                                GB_GETA (aki, Ax, pA+k1) ;      // aki = A(k1,i)
+                                GB_GETB (bkj, Bx, pB+k1) ;      // bkj = B(k1,j)
+                                GB_MULT (cij, aki, bkj, i, k1, j) ;
+                                cij_exists = true ;
+                                kfirst++ ;
+                            }
+                            GB_PRAGMA_SIMD_DOT (cij)
+                            for (int64_t k = kfirst ; k < k2 ; k++)
+                            {
+                                GB_DOT_TERMINAL (cij) ;     // break if terminal
+                                // cij += A(k,i) * B(k,j)
+                                GB_GETA (aki, Ax, pA+k) ;       // aki = A(k,i)
+                                GB_GETB (bkj, Bx, pB+k) ;       // bkj = B(k,j)
+                                GB_MULTADD (cij, aki, bkj, i, k, j) ;
+                            }
+                        }
+                        #elif ( GB_A_IS_FULL && GB_B_IS_BITMAP )
+                        {
+                            for (int64_t k = k1 ; k < k2 ; k++)
+                            {
+                                if (Bb [pB+k])
+                                {
+                                    GB_DOT (k, pA+k, pB+k) ;
+                                }
+                            }
+                        }
+                        #elif ( GB_A_IS_BITMAP && GB_B_IS_FULL )
+                        {
+                            for (int64_t k = k1 ; k < k2 ; k++)
+                            {
+                                if (Ab [pA+k])
+                                {
+                                    GB_DOT (k, pA+k, pB+k) ;
+                                }
+                            }
+                        }
+                        #else
+                        {
+                            // both A and B are bitmap
+                            for (int64_t k = k1 ; k < k2 ; k++)
+                            {
+                                if (Ab [pA+k] && Bb [pB+k])
+                                {
+                                    GB_DOT (k, pA+k, pB+k) ;
+                                }
+                            }
+                        }
+                        #endif
+
+                        //------------------------------------------------------
+                        // save the partial result C(i,j)
+                        //------------------------------------------------------
+
+                        if (GB_CIJ_EXISTS)
+                        {
+                            if (!Cb [pC])
+                            {
+                                Cb [pC] = 1 ;
+                                task_cnvals++ ;
+                            }
+                            GB_PUTC (cij, pC) ;
+                        }
+                    }
+                }
+            }
+        }
+        cnvals += task_cnvals ;
+    }
+}
@@ -66,7 +66,8 @@
 
     #else
 
-        // for the dot2 method: C is bitmap
+        // for the dot2 method: C is bitmap.  If C(i,j) is already present
+        // (cb is 1), any value can be kept, so it is simply overwritten.
         #define GB_DOT(k,pA,pB)                                         \
         {                                                               \
             GB_GETA (aki, Ax, pA) ;  /* aki = A(k,i) */                 \
@@ -75,8 +76,12 @@
             GB_MULT (cij, aki, bkj, i, k, j) ;                          \
             int64_t pC = pC_start + i ;                                 \
             GB_PUTC (cij, pC) ;                                         \
-            Cb [pC] = 1 ;                                               \
-            task_cnvals++ ;                                             \
+            if (!cb)                                                    \
+            {                                                           \
+                /* C(i,j) is a new entry */                             \
+                Cb [pC] = 1 ;                                           \
+                task_cnvals++ ;                                         \
+            }                                                           \
             break ;                                                     \
         }
 
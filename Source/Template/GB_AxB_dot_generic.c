@@ -98,6 +98,9 @@
         // Cx [p] = cij
         #define GB_PUTC(cij,p) Cx [p] = cij
 
+        // C(i,j) += cij
+        #define GB_CIJ_UPDATE(p,cij) fadd (GB_CX (p), GB_CX (p), &cij)
+
         // break if cij reaches the terminal value
         #define GB_DOT_TERMINAL(cij)                                    \
             if (is_terminal && cij == cij_terminal)                     \
@@ -255,6 +258,10 @@
         #undef  GB_PUTC
         #define GB_PUTC(cij,p) memcpy (GB_CX (p), cij, csize)
 
+        // C(i,j) += cij
+        #undef  GB_CIJ_UPDATE
+        #define GB_CIJ_UPDATE(p,cij) fadd (GB_CX (p), GB_CX (p), cij)
+
         // break if cij reaches the terminal value
         #undef  GB_DOT_TERMINAL
         #define GB_DOT_TERMINAL(cij)                                    \
@@ -120,6 +120,10 @@
         bool use_Gustavson = (hash_size == cvlen) ;
         int64_t pB     = TaskList [taskid].start ;
         int64_t pB_end = TaskList [taskid].end + 1 ;
+        const int64_t pB_first = pB ;
+        const int64_t pB_last  = pB_end - 1 ;
+        const int64_t askip_first = TaskList [taskid].askip_first ;
+        const int64_t askip_last  = TaskList [taskid].askip_last ;
         int64_t pleft = 0, pright = anvec-1 ;
         int64_t j = GBH (Bh, kk) ;
 
@@ -178,7 +182,7 @@
                 for ( ; pB < pB_end ; pB++)     // scan B(:,j)
                 {
                     GB_GET_B_kj_INDEX ;         // get index k of B(k,j)
-                    GB_GET_A_k ;                // get A(:,k)
+                    GB_GET_A_k_FINE ;           // get A(:,k)
                     if (aknz == 0) continue ;
                     GB_GET_B_kj ;               // bkj = B(k,j)
                     // scan A(:,k)
@@ -265,7 +269,7 @@
                 for ( ; pB < pB_end ; pB++)     // scan B(:,j)
                 { 
                     GB_GET_B_kj_INDEX ;         // get index k of B(k,j)
-                    GB_GET_A_k ;                // get A(:,k)
+                    GB_GET_A_k_FINE ;           // get A(:,k)
                     if (aknz == 0) continue ;
                     GB_GET_B_kj ;               // bkj = B(k,j)
 
@@ -351,7 +355,7 @@
                 for ( ; pB < pB_end ; pB++)     // scan B(:,j)
                 {
                     GB_GET_B_kj_INDEX ;         // get index k of B(k,j)
-                    GB_GET_A_k ;                // get A(:,k)
+                    GB_GET_A_k_FINE ;           // get A(:,k)
                     if (aknz == 0) continue ;
                     GB_GET_B_kj ;               // bkj = B(k,j)
                     // scan A(:,k)
@@ -548,7 +552,7 @@
                 for ( ; pB < pB_end ; pB++)     // scan B(:,j)
                 { 
                     GB_GET_B_kj_INDEX ;         // get index k of B(k,j)
-                    GB_GET_A_k ;                // get A(:,k)
+                    GB_GET_A_k_FINE ;           // get A(:,k)
                     if (aknz == 0) continue ;
                     GB_GET_B_kj ;               // bkj = B(k,j)
                     #define GB_IKJ                                             \
@@ -687,7 +691,7 @@
                 for ( ; pB < pB_end ; pB++)     // scan B(:,j)
                 {
                     GB_GET_B_kj_INDEX ;         // get index k of B(k,j)
-                    GB_GET_A_k ;                // get A(:,k)
+                    GB_GET_A_k_FINE ;           // get A(:,k)
                     if (aknz == 0) continue ;
                     GB_GET_B_kj ;               // bkj = B(k,j)
                     // scan A(:,k)
@@ -769,9 +773,10 @@
     // phase5: numeric phase for coarse tasks, gather for fine tasks
     //==========================================================================
 
-    // allocate Ci and Cx
+    // allocate Ci and Cx; Cx has size 1 if C is iso
     int64_t cnz = Cp [cnvec] ;
-    GrB_Info info = GB_bix_alloc (C, cnz, false, false, true, true, Context) ;
+    GrB_Info info = GB_bix_alloc (C, cnz, false, false, true,
+        !GB_IS_ANY_PAIR_SEMIRING, Context) ;
     if (info != GrB_SUCCESS)
     { 
         // out of memory
@@ -779,19 +784,20 @@
     }
 
     int64_t  *GB_RESTRICT Ci = C->i ;
-    GB_CTYPE *GB_RESTRICT Cx = (GB_CTYPE *) C->x ;
 
     #if GB_IS_ANY_PAIR_SEMIRING
 
-        // TODO: create C as a constant-value matrix.
-
-        // ANY_PAIR semiring: result is purely symbolic
-        int64_t pC ;
-        #pragma omp parallel for num_threads(nthreads) schedule(static)
-        for (pC = 0 ; pC < cnz ; pC++)
+        // ANY_PAIR semiring: result is purely symbolic, and C is iso
+        GB_CTYPE *GB_RESTRICT Cx = GB_MALLOC (1, GB_CTYPE) ;
+        if (Cx == NULL)
         { 
-            Cx [pC] = GB_CTYPE_CAST (1, 0) ;
+            // out of memory
+            return (GrB_OUT_OF_MEMORY) ;
         }
+        Cx [0] = GB_CTYPE_CAST (1, 0) ;
+        C->x = Cx ;
+        C->x_size = sizeof (GB_CTYPE) ;
+        C->iso = true ;
 
         // Just a precaution; these variables are not used below.  Any attempt
         // to access them will lead to a compile error.
@@ -806,6 +812,10 @@
         // MIN_PAIR
         // TIMES_PAIR
 
+    #else
+
+        GB_CTYPE *GB_RESTRICT Cx = (GB_CTYPE *) C->x ;
+
     #endif
 
 // ttt = omp_get_wtime ( ) - ttt ;
@@ -204,6 +204,20 @@ break ;
         &pA_start, &pA_end) ;                                               \
     int64_t aknz = pA_end - pA_start
 
+//------------------------------------------------------------------------------
+// GB_GET_A_k_FINE: get the part of A(:,k) for this fine task
+//------------------------------------------------------------------------------
+
+// An ultra-fine task computes only part of A(:,k)*B(k,j) for the first and
+// last entries B(k,j) in its slice of B(:,j).  The index i of A(i,k) is
+// derived from pA itself, so only pA_start and pA_end need to be trimmed.
+
+#define GB_GET_A_k_FINE                                                     \
+    GB_GET_A_k ;                                                            \
+    if (pB == pB_last ) pA_end   -= askip_last ;                            \
+    if (pB == pB_first) pA_start += askip_first ;                           \
+    aknz = pA_end - pA_start
+
 //------------------------------------------------------------------------------
 // GB_GET_M_ij: get the numeric value of M(i,j)
 //------------------------------------------------------------------------------
@@ -92,24 +92,31 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = A(row,col)
 
     if (Ap != NULL)
     { 
-        // A is sparse or hypersparse
-        const int64_t *GB_RESTRICT Ai = A->i ;
+        // A is sparse or hypersparse, with A->p, A->h, and A->i held in
+        // either 32-bit or 64-bit integers
 
         // extract from vector j of a GrB_Matrix
         int64_t k ;
         if (A->h != NULL)
         {
             // A is hypersparse: look for j in hyperlist A->h [0 ... A->nvec-1]
-            const int64_t *GB_RESTRICT Ah = A->h ;
             int64_t pleft = 0 ;
             int64_t pright = A->nvec-1 ;
-            GB_BINARY_SEARCH (j, Ah, pleft, pright, found) ;
+            if (A->h_is_32)
+            { 
+                const int32_t *GB_RESTRICT Ah = (int32_t *) A->h ;
+                GB_BINARY_SEARCH (j, Ah, pleft, pright, found) ;
+            }
+            else
+            { 
+                const int64_t *GB_RESTRICT Ah = A->h ;
+                GB_BINARY_SEARCH (j, Ah, pleft, pright, found) ;
+            }
             if (!found)
             { 
                 // vector j is empty
                 return (GrB_NO_VALUE) ;
             }
-            ASSERT (j == Ah [pleft]) ;
             k = pleft ;
         }
         else
@@ -118,19 +125,44 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = A(row,col)
             k = j ;
         }
 
-        pleft = Ap [k] ;
-        int64_t pright = Ap [k+1] - 1 ;
+        int64_t pright ;
+        if (A->p_is_32)
+        { 
+            const int32_t *GB_RESTRICT Ap32 = (int32_t *) Ap ;
+            pleft = Ap32 [k] ;
+            pright = Ap32 [k+1] - 1 ;
+        }
+        else
+        { 
+            pleft = Ap [k] ;
+            pright = Ap [k+1] - 1 ;
+        }
 
         // binary search in kth vector for index i
         // Time taken for this step is at most O(log(nnz(A(:,j))).
-        GB_BINARY_SEARCH (i, Ai, pleft, pright, found) ;
+        if (A->i_is_32)
+        { 
+            const int32_t *GB_RESTRICT Ai = (int32_t *) A->i ;
+            GB_BINARY_SEARCH (i, Ai, pleft, pright, found) ;
+        }
+        else
+        { 
+            const int64_t *GB_RESTRICT Ai = A->i ;
+            GB_BINARY_SEARCH (i, Ai, pleft, pright, found) ;
+        }
     }
     else
     {
         // A is bitmap or full
         pleft = i + j * A->vlen ;
         const int8_t *GB_RESTRICT Ab = A->b ;
-        if (Ab != NULL)
+        if (A->b_is_packed)
+        { 
+            // A is a packed bitmap
+            const uint64_t *GB_RESTRICT Ab64 = (const uint64_t *) Ab ;
+            found = (GB_BITMAP_PACKED_GET (Ab64, pleft) == 1) ;
+        }
+        else if (Ab != NULL)
         { 
             // A is bitmap
             found = (Ab [pleft] == 1) ;
@@ -148,6 +180,8 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = A(row,col)
 
     if (found)
     {
+        // the value of an iso matrix is held in A->x [0]
+        if (A->iso) pleft = 0 ;
         #if !defined ( GB_UDT_EXTRACT )
         if (GB_XCODE == acode)
         { 
@@ -31,8 +31,9 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry from S
     GB_RETURN_IF_NULL_OR_FAULTY (S) ;
     GB_RETURN_IF_NULL (x) ;
 
-    // delete any lingering zombies, assemble any pending tuples, and unjumble
-    if (GB_ANY_PENDING_WORK (S))
+    // delete any lingering zombies, assemble any pending tuples, and unjumble;
+    // also return S to 64-bit integers and unpack its bitmap, if needed
+    if (GB_ANY_PENDING_WORK (S) || GB_INDEX32 (S) || GB_BITMAP_PACKED (S))
     { 
         // extract scalar with pending tuples or zombies.  It cannot be
         // actually jumbled, but S->jumbled might true anyway.
@@ -75,21 +75,35 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = V(i)
     if (Vp != NULL)
     { 
         // V is sparse
-        const int64_t *GB_RESTRICT Vi = V->i ;
-
         pleft = 0 ;
-        int64_t pright = Vp [1] - 1 ;
+        int64_t pright = GB_NNZ_SPARSE (V) - 1 ;
 
         // binary search for index i
         // Time taken for this step is at most O(log(nnz(V))).
-        GB_BINARY_SEARCH (i, Vi, pleft, pright, found) ;
+        if (V->i_is_32)
+        { 
+            // V->i is held in 32-bit integers
+            const int32_t *GB_RESTRICT Vi = (int32_t *) V->i ;
+            GB_BINARY_SEARCH (i, Vi, pleft, pright, found) ;
+        }
+        else
+        { 
+            const int64_t *GB_RESTRICT Vi = V->i ;
+            GB_BINARY_SEARCH (i, Vi, pleft, pright, found) ;
+        }
     }
     else
     {
         // V is bitmap or full
         pleft = i ;
         const int8_t *GB_RESTRICT Vb = V->b ;
-        if (Vb != NULL)
+        if (V->b_is_packed)
+        { 
+            // V is a packed bitmap
+            const uint64_t *GB_RESTRICT Vb64 = (const uint64_t *) Vb ;
+            found = (GB_BITMAP_PACKED_GET (Vb64, pleft) == 1) ;
+        }
+        else if (Vb != NULL)
         { 
             // V is bitmap
             found = (Vb [pleft] == 1) ;
@@ -107,6 +121,8 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = V(i)
 
     if (found)
     {
+        // the value of an iso vector is held in V->x [0]
+        if (V->iso) pleft = 0 ;
         #if !defined ( GB_UDT_EXTRACT )
         if (GB_XCODE == vcode)
         { 
@@ -455,12 +455,6 @@
                         }
                         else
                         {
-                            // Currently, the matrix C is a newly allocated
-                            // matrix, not the C_in input matrix to GrB_mxm.
-                            // As a result, this condition is not used.  It
-                            // will be in the future when this method is
-                            // modified to modify C in-place.
-                            ASSERT (GB_DEAD_CODE) ;
                             // C(i,j) += H(ii,kk)
                             GB_CIJ_GATHER_UPDATE (pC, pH) ;
                         }
@@ -361,12 +361,6 @@
                         }
                         else
                         {
-                            // Currently, the matrix C is a newly allocated
-                            // matrix, not the C_in input matrix to GrB_mxm.
-                            // As a result, this condition is not used.  It
-                            // will be in the future when this method is
-                            // modified to modify C in-place.
-                            ASSERT (GB_DEAD_CODE) ;
                             // C(i,j) += H(i,jj)
                             GB_CIJ_GATHER_UPDATE (pC, pH) ;
                         }
@@ -404,6 +398,12 @@
             int fine_tid = tid % nfine_tasks_per_vector ;
             int64_t kfirst = A_slice [fine_tid] ;
             int64_t klast = A_slice [fine_tid + 1] ;
+            if (j == 0)
+            { 
+                // read ahead in A, if it is held in a file mapping
+                GB_mmap_readahead (A, A_slice, true, fine_tid,
+                    nfine_tasks_per_vector, nthreads) ;
+            }
             int64_t pB_start = j * bvlen ;      // pointer to B(:,j)
             int64_t pC_start = j * avlen ;      // pointer to C(:,j)
             GB_GET_T_FOR_SECONDJ ;              // t = j or j+1 for SECONDJ*
@@ -645,6 +645,12 @@
             int fine_tid = tid % nfine_tasks_per_vector ;
             int64_t kfirst = A_slice [fine_tid] ;
             int64_t klast = A_slice [fine_tid + 1] ;
+            if (j == 0)
+            { 
+                // read ahead in A, if it is held in a file mapping
+                GB_mmap_readahead (A, A_slice, true, fine_tid,
+                    nfine_tasks_per_vector, nthreads) ;
+            }
             int64_t pB_start = j * bvlen ;      // pointer to B(:,j)
             int64_t pC_start = j * avlen ;      // pointer to C(:,j), for bitmap
             int64_t pW_start = tid * avlen ;    // pointer to W(:,tid)
@@ -246,6 +246,72 @@ int8_t *b ;             // size nzmax; bitmap
 int64_t nzmax ;         // size of i and x arrays
 int64_t nvals ;         // nvals(A) if A is bitmap
 
+//------------------------------------------------------------------------------
+// allocated sizes
+//------------------------------------------------------------------------------
+
+// The size in bytes of each component of A is kept with the matrix, so that
+// space left over by GB_import or by a prior reallocation can be reused by
+// GB_ix_realloc, and so that GxB_Matrix_memoryUsage can report the memory held
+// by A.  A size is zero if the component is NULL or shallow.  A component that
+// is transplanted into A from another array (from a workspace of a kernel, for
+// example) may have a size smaller than the block actually allocated, but
+// never larger, and never less than the content it holds: plen+1 integers
+// for A->p, plen for A->h, nnz(A) for A->i, nnz(A) or 1 (if iso) entries for
+// A->x, and vlen*vdim bytes for A->b (ceil(vlen*vdim/64) words if packed).
+
+size_t p_size ;         // size of A->p in bytes
+size_t h_size ;         // size of A->h in bytes
+size_t b_size ;         // size of A->b in bytes
+size_t i_size ;         // size of A->i in bytes
+size_t x_size ;         // size of A->x in bytes
+
+//------------------------------------------------------------------------------
+// iso-valued matrices
+//------------------------------------------------------------------------------
+
+// If A->iso is true, all entries in the matrix have the same value, and A->x
+// has size 1 (a single entry of size A->type->size) instead of nzmax.  The
+// value of the entry at position p is then A->x [0], which is accessed with
+// the GBX (Ax,p,A_iso) macro.  An iso matrix is typically an unweighted graph,
+// where only the pattern of the matrix is of interest.  See GB_iso.h.
+
+bool iso ;              // true if all entries have the same value, in x [0]
+
+//------------------------------------------------------------------------------
+// 32-bit integers
+//------------------------------------------------------------------------------
+
+// A sparse or hypersparse matrix with no pending work can hold its pattern in
+// 32-bit integers, which halves its size.  If A->p_is_32 is true, A->p is
+// actually an int32_t array of size plen+1, and nnz(A) < 2^31.  If A->h_is_32
+// or A->i_is_32 are true, A->h or A->i are int32_t arrays of size plen or
+// nzmax, and A->vdim or A->vlen are less than 2^31.  The matrix is converted
+// when it is built or when the user application calls GrB_wait, as controlled
+// by A->index32_control, and it is converted back to 64-bit integers by the
+// next method that needs its pattern.  See GB_convert_int64_to_int32.
+
+bool p_is_32 ;          // true if p is int32_t
+bool h_is_32 ;          // true if h is int32_t
+bool i_is_32 ;          // true if i is int32_t
+int index32_control ;   // GxB_INDEX32_AUTO, GxB_INDEX32_ALWAYS, or
+                        // GxB_INDEX32_NEVER
+
+//------------------------------------------------------------------------------
+// packed bitmap
+//------------------------------------------------------------------------------
+
+// A bitmap matrix can hold A->b with one bit per position instead of one
+// byte.  If A->b_is_packed is true, A->b is actually a uint64_t array of size
+// ceil(vlen*vdim/64), where bit (p%64) of word p/64 is A->b [p].  The matrix
+// is packed when the user application calls GrB_wait, as controlled by
+// A->bitmap_pack_control, and it is unpacked by the next method that needs its
+// bitmap.  See GB_convert_bitmap_to_packed.
+
+bool b_is_packed ;      // true if b is a packed uint64_t bitmap
+int bitmap_pack_control ;   // GxB_BITMAP_PACK_AUTO, GxB_BITMAP_PACK_ALWAYS,
+                        // or GxB_BITMAP_PACK_NEVER
+
 //------------------------------------------------------------------------------
 // pending tuples
 //------------------------------------------------------------------------------
@@ -413,7 +479,10 @@ int sparsity ;          // controls sparsity structure: hypersparse,
 // components.  These are pointers A->p, A->h, A->i, A->b, and A->x that point
 // to the content of another matrix.  Using shallow components speeds up
 // computations and saves memory, but shallow matrices are never passed back to
-// the user application.
+// the user application, with one exception: a matrix imported with the
+// GxB_SHALLOW_IMPORT descriptor holds the arrays of the user application as
+// shallow components.  Such a matrix is copied by GB_unshallow before any
+// method modifies it in-place.
 
 // If the following are true, then the corresponding component of the
 // object is a pointer into components of another object.  They must not
@@ -425,6 +494,21 @@ bool b_shallow ;        // true if b is a shallow copy
 bool i_shallow ;        // true if i is a shallow copy
 bool x_shallow ;        // true if x is a shallow copy
 
+//------------------------------------------------------------------------------
+// file-backed matrices
+//------------------------------------------------------------------------------
+
+// A matrix created by GxB_Matrix_mmap holds its components as shallow
+// pointers into a read-only mapping of a file.  The matrix owns the mapping,
+// which is unmapped by GB_phbix_free.  A shallow copy of such a matrix refers
+// to the same mapping, with mmap_shallow true, so that the kernels can advise
+// the operating system of the parts of the file they will access next (see
+// GB_mmap_readahead).
+
+void *mmap_base ;       // start of the file mapping, or NULL if none
+size_t mmap_size ;      // size of the file mapping, in bytes
+bool mmap_shallow ;     // true if the mapping belongs to another matrix
+
 //------------------------------------------------------------------------------
 // other bool content
 //------------------------------------------------------------------------------
@@ -433,6 +517,17 @@ bool is_csc ;           // true if stored by column, false if by row
 bool jumbled ;          // true if the matrix may be jumbled.  bitmap and full
                         // matrices are never jumbled.
 
+//------------------------------------------------------------------------------
+// pattern version
+//------------------------------------------------------------------------------
+
+// Each time the pattern of the matrix may change, it is given a new version
+// number, unique across all matrices, via GB_PATTERN_CHANGED.  This is used
+// by the saxpy3 plan cache to decide if the tasks constructed for a prior
+// C=A*B can be reused.
+
+uint64_t pattern_version ;  // version of the pattern of this matrix
+
 //------------------------------------------------------------------------------
 // iterating through a matrix
 //------------------------------------------------------------------------------
@@ -63,6 +63,8 @@
         {
             int64_t pstart, pend ;
             GB_PARTITION (pstart, pend, anz, tid, ntasks) ;
+            // read ahead in A, if it is held in a file mapping
+            GB_mmap_readahead (A, NULL, false, tid, ntasks, nthreads) ;
             // ztype t = identity
             GB_SCALAR_IDENTITY (t) ;
             bool my_exit, found = false ;
@@ -106,7 +106,7 @@
 %   test41   - test AxB
 %   test42   - test GrB_Matrix_build
 %   test43   - test subref
-%   test44   - test qsort
+%   test44   - test qsort, msort, and rsort
 %   test45   - test GrB_*_setElement and GrB_*_*build
 %   test46   - performance test of GxB_subassign
 %   test46b  - performance test of GrB_assign
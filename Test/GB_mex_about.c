@@ -1147,8 +1147,8 @@ void mexFunction
     OK (GrB_Matrix_new (&B, GrB_FP32, 0, n)) ;
     expected = GrB_OUT_OF_MEMORY ;
     bool ignore ;
-    ERR (GB_bitmap_AxB_saxpy (&C, GxB_BITMAP, NULL, false, false, A, B,
-        GrB_PLUS_TIMES_SEMIRING_FP32, false, &ignore, NULL)) ;
+    ERR (GB_bitmap_AxB_saxpy (&C, NULL, NULL, GxB_BITMAP, NULL, false, false,
+        A, B, GrB_PLUS_TIMES_SEMIRING_FP32, false, &ignore, &ignore, NULL)) ;
     GrB_Matrix_free_(&A) ;
     GrB_Matrix_free_(&B) ;
     CHECK (C == NULL) ;
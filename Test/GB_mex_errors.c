@@ -2039,8 +2039,8 @@ void mexFunction
     GB_Matrix_check (HugeRow, "huge row", G3, NULL) ;
     GxB_Matrix_fprint (HugeRow, "HugeRow", G3, ff) ;
 
-    OK (GB_AxB_dot2 (&HugeMatrix, NULL, false, false, HugeRow, HugeRow,
-        GxB_PLUS_TIMES_FP64, false, Context)) ;
+    OK (GB_AxB_dot2 (&HugeMatrix, NULL, NULL, NULL, false, false, HugeRow,
+        HugeRow, GxB_PLUS_TIMES_FP64, false, Context)) ;
 
     GxB_Matrix_fprint (HugeMatrix, "HugeMatrix", G3, ff) ;
     GrB_Matrix_free_(&HugeMatrix) ;
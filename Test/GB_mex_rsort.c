@@ -0,0 +1,73 @@
+//------------------------------------------------------------------------------
+// GB_mex_rsort: sort using GB_rsort
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Sorts the tuples (I,J) with I as the primary key and 0 <= J < jlen, with
+// GB_rsort.  K is returned as the 0-based position of each tuple on input.
+
+#include "GB_mex.h"
+
+#define USAGE "[I,J,K] = GB_mex_rsort (I,J,jlen,nthreads)"
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+    bool malloc_debug = GB_mx_get_global (true) ;
+
+    // check inputs
+    if (nargin != 4 || nargout != 3)
+    {
+        mexErrMsgTxt ("Usage: " USAGE) ;
+    }
+    if (!mxIsClass (pargin [0], "int64"))
+    {
+        mexErrMsgTxt ("I must be a int64 array") ;
+    }
+    if (!mxIsClass (pargin [1], "int64"))
+    {
+        mexErrMsgTxt ("J must be a int64 array") ;
+    }
+
+    int64_t *I = mxGetData (pargin [0]) ;
+    int64_t n = (uint64_t) mxGetNumberOfElements (pargin [0]) ;
+
+    int64_t *J = mxGetData (pargin [1]) ;
+    if (n != (uint64_t) mxGetNumberOfElements (pargin [1])) 
+    {
+        mexErrMsgTxt ("I and J must be the same length") ;
+    }
+
+    int64_t GET_SCALAR (2, int64_t, jlen, 1) ;
+    int GET_SCALAR (3, int, nthreads, 1) ;
+
+    pargout [0] = GB_mx_create_full (n, 1, GrB_INT64) ;
+    int64_t *Iout = mxGetData (pargout [0]) ;
+    memcpy (Iout, I, n * sizeof (int64_t)) ;
+
+    pargout [1] = GB_mx_create_full (n, 1, GrB_INT64) ;
+    int64_t *Jout = mxGetData (pargout [1]) ;
+    memcpy (Jout, J, n * sizeof (int64_t)) ;
+
+    pargout [2] = GB_mx_create_full (n, 1, GrB_INT64) ;
+    int64_t *Kout = mxGetData (pargout [2]) ;
+
+    GB_MEX_TIC ;
+    GrB_Info info = GB_rsort (Iout, Jout, Kout, n, jlen, nthreads) ;
+    GB_MEX_TOC ;
+    if (info != GrB_SUCCESS)
+    {
+        mexErrMsgTxt ("GB_rsort failed") ;
+    }
+
+    GB_mx_put_global (true) ;   
+}
@@ -1,5 +1,5 @@
 function test44(longtests)
-%TEST44 test qsort
+%TEST44 test qsort, msort, and rsort
 
 % SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
 % SPDX-License-Identifier: Apache-2.0
@@ -114,6 +114,31 @@ for nthreads = [1 2 4 8 16 20 32 40 64 128 256]
     fprintf ('speedup vs MATLAB: %8.3f\n', t / tp) ;
 end
 
+fprintf ('\n----------------------- rsort\n') ;
+
+% rsort is stable, and returns the original position of each tuple in K
+jlen = floor (n/10) + 1 ;
+K = int64 ((0:n-1)') ;
+IJKout = sortrows ([I J K]) ;
+
+for nthreads = [1 2 4 8 16 20 32 40 64 128 256]
+    if (nthreads > 2*nthreads_max)
+        break ;
+    end
+    [Iout, Jout, Kout] = GB_mex_msort_3 (I, J, K, nthreads) ;
+    tm = grbresults ;
+    assert (isequal ([Iout Jout Kout], IJKout));
+    [Iout, Jout, Kout] = GB_mex_rsort (I, J, jlen, nthreads) ;
+    tp = grbresults ;
+    if (nthreads == 1)
+        tp1 = tp ;
+    end
+    assert (isequal ([Iout Jout Kout], IJKout));
+    fprintf ('rsort:  %3d: %10.4g ', nthreads, tp) ;
+    fprintf ('speedup vs 1: %8.3f ', tp1 / tp) ;
+    fprintf ('speedup vs msort3: %8.3f\n', tm / tp) ;
+end
+
 end
 
 fprintf ('\ntest44: all tests passed\n') ;